@@ -59,6 +59,16 @@ fi
 
 bash test-common.sh "${dims}" "$PROG"
 
+# Build, and test with the optional int32, and float16 dtypes, and the fused clip kernel.
+make -C micropython/ports/unix -j${NPROC} USER_C_MODULES="${HERE}" DEBUG=1 STRIP=: MICROPY_PY_FFI=0 MICROPY_PY_BTREE=0 CFLAGS_EXTRA=-DULAB_MAX_DIMS=$dims CFLAGS_EXTRA+=-DULAB_HAS_INT32=1 CFLAGS_EXTRA+=-DULAB_HAS_FLOAT16=1 CFLAGS_EXTRA+=-DULAB_NUMPY_CLIP_IS_FUSED=1 CFLAGS_EXTRA+=-DULAB_HASH=$GIT_HASH BUILD=build-features-$dims PROG=micropython-features-$dims
+
+PROG="micropython/ports/unix/build-features-$dims/micropython-features-$dims"
+if [ ! -e "$PROG" ]; then
+  PROG="micropython/ports/unix/micropython-features-$dims"
+fi
+
+bash test-common.sh "${dims}" "$PROG"
+
 # Build with single-precision float.
 make -C micropython/ports/unix -j${NPROC} USER_C_MODULES="${HERE}" DEBUG=1 STRIP=: MICROPY_PY_FFI=0 MICROPY_PY_BTREE=0 CFLAGS_EXTRA=-DMICROPY_FLOAT_IMPL=MICROPY_FLOAT_IMPL_FLOAT CFLAGS_EXTRA+=-DULAB_MAX_DIMS=$dims CFLAGS_EXTRA+=-DULAB_HASH=$GIT_HASH BUILD=build-nanbox-$dims PROG=micropython-nanbox-$dims
 
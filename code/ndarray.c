@@ -21,6 +21,7 @@
 #include "py/obj.h"
 #include "py/objtuple.h"
 #include "py/objint.h"
+#include "py/objarray.h"
 
 #include "ulab_tools.h"
 #include "ndarray.h"
@@ -61,6 +62,23 @@ void ndarray_set_complex_value(void *p, size_t index, mp_obj_t value) {
     }
 }
 
+#if ULAB_HAS_FLOAT16
+mp_obj_t ndarray_get_value(char typecode, void *p, size_t index) {
+    if(typecode == NDARRAY_FLOAT16) {
+        return mp_obj_new_float(ulab_float16_to_float(((uint16_t *)p)[index]));
+    }
+    return mp_binary_get_val_array(typecode, p, index);
+}
+
+void ndarray_set_value(char typecode, void *p, size_t index, mp_obj_t value) {
+    if(typecode == NDARRAY_FLOAT16) {
+        ((uint16_t *)p)[index] = ulab_float_to_float16(mp_obj_get_float(value));
+    } else {
+        mp_binary_set_val_array(typecode, p, index, value);
+    }
+}
+#endif
+
 void ndarray_fill_array_iterable(mp_float_t *array, mp_obj_t iterable) {
     mp_obj_iter_buf_t x_buf;
     mp_obj_t x_item, x_iterable = mp_getiter(iterable, &x_buf);
@@ -159,6 +177,18 @@ void ndarray_dtype_print(const mp_print_t *print, mp_obj_t self_in, mp_print_kin
     } else if(self->dtype == NDARRAY_INT16) {
         mp_print_str(print, "int16')");
     }
+    #if ULAB_HAS_INT32
+    else if(self->dtype == NDARRAY_UINT32) {
+        mp_print_str(print, "uint32')");
+    } else if(self->dtype == NDARRAY_INT32) {
+        mp_print_str(print, "int32')");
+    }
+    #endif
+    #if ULAB_HAS_FLOAT16
+    else if(self->dtype == NDARRAY_FLOAT16) {
+        mp_print_str(print, "float16')");
+    }
+    #endif
     #if ULAB_SUPPORTS_COMPLEX
     else if(self->dtype == NDARRAY_COMPLEX) {
         mp_print_str(print, "complex')");
@@ -198,7 +228,14 @@ mp_obj_t ndarray_dtype_make_new(const mp_obj_type_t *type, size_t n_args, size_t
             _dtype = mp_obj_get_int(_args[0].u_obj);
             if((_dtype != NDARRAY_BOOL) && (_dtype != NDARRAY_UINT8)
                 && (_dtype != NDARRAY_INT8) && (_dtype != NDARRAY_UINT16)
-                && (_dtype != NDARRAY_INT16) && (_dtype != NDARRAY_FLOAT)) {
+                && (_dtype != NDARRAY_INT16) && (_dtype != NDARRAY_FLOAT)
+                #if ULAB_HAS_INT32
+                && (_dtype != NDARRAY_UINT32) && (_dtype != NDARRAY_INT32)
+                #endif
+                #if ULAB_HAS_FLOAT16
+                && (_dtype != NDARRAY_FLOAT16)
+                #endif
+                ) {
                 mp_raise_TypeError(MP_ERROR_TEXT("data type not understood"));
             }
         } else {
@@ -211,7 +248,21 @@ mp_obj_t ndarray_dtype_make_new(const mp_obj_type_t *type, size_t n_args, size_t
                 _dtype = NDARRAY_UINT16;
             } else if(memcmp(_dtype_, "int16", 5) == 0) {
                 _dtype = NDARRAY_INT16;
-            } else if(memcmp(_dtype_, "float", 5) == 0) {
+            }
+            #if ULAB_HAS_INT32
+            else if(memcmp(_dtype_, "uint32", 6) == 0) {
+                _dtype = NDARRAY_UINT32;
+            } else if(memcmp(_dtype_, "int32", 5) == 0) {
+                _dtype = NDARRAY_INT32;
+            }
+            #endif
+            #if ULAB_HAS_FLOAT16
+            // this has to come before float, otherwise the comparison would stop at the first five characters
+            else if((len == 7) && (memcmp(_dtype_, "float16", 7) == 0)) {
+                _dtype = NDARRAY_FLOAT16;
+            }
+            #endif
+            else if(memcmp(_dtype_, "float", 5) == 0) {
                 _dtype = NDARRAY_FLOAT;
             }
             #if ULAB_SUPPORTS_COMPLEX
@@ -248,6 +299,12 @@ mp_obj_t ndarray_dtype(mp_obj_t self_in) {
         if((len != 1) || ((*_dtype != NDARRAY_BOOL) && (*_dtype != NDARRAY_UINT8)
             && (*_dtype != NDARRAY_INT8) && (*_dtype != NDARRAY_UINT16)
             && (*_dtype != NDARRAY_INT16) && (*_dtype != NDARRAY_FLOAT)
+            #if ULAB_HAS_INT32
+                && (*_dtype != NDARRAY_UINT32) && (*_dtype != NDARRAY_INT32)
+            #endif
+            #if ULAB_HAS_FLOAT16
+                && (*_dtype != NDARRAY_FLOAT16)
+            #endif
             #if ULAB_SUPPORTS_COMPLEX
                 && (*_dtype != NDARRAY_COMPLEX)
             #endif
@@ -302,7 +359,7 @@ mp_obj_t ndarray_get_item(ndarray_obj_t *ndarray, void *array) {
             return mp_obj_new_complex(real, imag);
         }
         #endif
-        return mp_binary_get_val_array(ndarray->dtype, array, 0);
+        return ndarray_get_value(ndarray->dtype, array, 0);
     } else {
         if(*(uint8_t *)array) {
             return mp_const_true;
@@ -445,6 +502,18 @@ void ndarray_print(const mp_print_t *print, mp_obj_t self_in, mp_print_kind_t ki
     } else if(self->dtype == NDARRAY_INT16) {
         mp_print_str(print, "int16)");
     }
+    #if ULAB_HAS_INT32
+    else if(self->dtype == NDARRAY_UINT32) {
+        mp_print_str(print, "uint32)");
+    } else if(self->dtype == NDARRAY_INT32) {
+        mp_print_str(print, "int32)");
+    }
+    #endif
+    #if ULAB_HAS_FLOAT16
+    else if(self->dtype == NDARRAY_FLOAT16) {
+        mp_print_str(print, "float16)");
+    }
+    #endif
     #if ULAB_SUPPORTS_COMPLEX
     else if(self->dtype == NDARRAY_COMPLEX) {
         mp_print_str(print, "complex)");
@@ -501,6 +570,19 @@ bool ndarray_is_dense(ndarray_obj_t *ndarray) {
     return stride == ndarray->strides[ULAB_MAX_DIMS-ndarray->ndim] ? true : false;
 }
 
+bool ndarray_is_contiguous(ndarray_obj_t *ndarray) {
+    // returns true, if the elements follow each other in C order without gaps;
+    // in contrast to ndarray_is_dense, all strides are inspected
+    int32_t stride = ndarray->itemsize;
+    for(uint8_t i = ULAB_MAX_DIMS; i > ULAB_MAX_DIMS - ndarray->ndim; i--) {
+        if((ndarray->shape[i - 1] > 1) && (ndarray->strides[i - 1] != stride)) {
+            return false;
+        }
+        stride *= ndarray->shape[i - 1];
+    }
+    return true;
+}
+
 static size_t multiply_size(size_t a, size_t b) {
     size_t result;
     if (__builtin_mul_overflow(a, b, &result)) {
@@ -509,9 +591,7 @@ static size_t multiply_size(size_t a, size_t b) {
     return result;
 }
 
-ndarray_obj_t *ndarray_new_ndarray(uint8_t ndim, size_t *shape, int32_t *strides, uint8_t dtype, uint8_t *buffer) {
-    // Creates the base ndarray with shape, and initialises the values to straight 0s
-    // optionally, values can be supplied via the last argument
+static ndarray_obj_t *ndarray_new_ndarray_(uint8_t ndim, size_t *shape, int32_t *strides, uint8_t dtype, uint8_t *buffer, bool initialise) {
     ndarray_obj_t *ndarray = m_new_obj(ndarray_obj_t);
     ndarray->base.type = &ulab_ndarray_type;
     ndarray->dtype = dtype == NDARRAY_BOOL ? NDARRAY_UINT8 : dtype;
@@ -540,15 +620,32 @@ ndarray_obj_t *ndarray_new_ndarray(uint8_t ndim, size_t *shape, int32_t *strides
     uint8_t *array;
     array = buffer;
     if(array == NULL) {
-        // this should set all elements to 0, irrespective of the of the dtype (all bits are zero)
-        // we could, perhaps, leave this step out, and initialise the array only, when needed
-        array = m_new0(byte, len);
+        // this should set all elements to 0, irrespective of the of the dtype (all bits are zero);
+        // the single item of an empty array is always zeroed, because contractions might read it
+        if(initialise || (ndarray->len == 0)) {
+            array = m_new0(byte, len);
+        } else {
+            array = m_new(byte, len);
+        }
     }
     ndarray->array = array;
     ndarray->origin = array;
     return ndarray;
 }
 
+ndarray_obj_t *ndarray_new_ndarray(uint8_t ndim, size_t *shape, int32_t *strides, uint8_t dtype, uint8_t *buffer) {
+    // Creates the base ndarray with shape, and initialises the values to straight 0s
+    // optionally, values can be supplied via the last argument
+    return ndarray_new_ndarray_(ndim, shape, strides, dtype, buffer, true);
+}
+
+ndarray_obj_t *ndarray_new_dense_ndarray_uninitialised(uint8_t ndim, size_t *shape, uint8_t dtype) {
+    // creates a dense array without zeroing the data; the caller must write each element
+    // note that this saves a pass over the memory only, if the firmware is compiled with
+    // MICROPY_GC_CONSERVATIVE_CLEAR = 0, otherwise, gc_alloc clears the block anyway
+    return ndarray_new_ndarray_(ndim, shape, NULL, dtype, NULL, false);
+}
+
 ndarray_obj_t *ndarray_new_dense_ndarray(uint8_t ndim, size_t *shape, uint8_t dtype) {
     // creates a dense array, i.e., one, where the strides are derived directly from the shapes
     // the function should work in the general n-dimensional case
@@ -625,7 +722,7 @@ ndarray_obj_t *ndarray_copy_view(ndarray_obj_t *source) {
     if(source->boolean) {
         dtype = NDARRAY_BOOL;
     }
-    ndarray_obj_t *ndarray = ndarray_new_ndarray(source->ndim, source->shape, strides, dtype, NULL);
+    ndarray_obj_t *ndarray = ndarray_new_ndarray_(source->ndim, source->shape, strides, dtype, NULL, false);
     ndarray_copy_array(source, ndarray, 0);
     return ndarray;
 }
@@ -635,7 +732,7 @@ ndarray_obj_t *ndarray_copy_view_convert_type(ndarray_obj_t *source, uint8_t dty
     if(dtype == source->dtype) {
         return ndarray_copy_view(source);
     }
-    ndarray_obj_t *ndarray = ndarray_new_dense_ndarray(source->ndim, source->shape, dtype);
+    ndarray_obj_t *ndarray = ndarray_new_dense_ndarray_uninitialised(source->ndim, source->shape, dtype);
     uint8_t *sarray = (uint8_t *)source->array;
     uint8_t *array = (uint8_t *)ndarray->array;
 
@@ -654,12 +751,12 @@ ndarray_obj_t *ndarray_copy_view_convert_type(ndarray_obj_t *source, uint8_t dty
             }
         } else {
         #endif
-            if((source->dtype == NDARRAY_FLOAT) && (dtype != NDARRAY_FLOAT)) {
+            if(NDARRAY_IS_FLOATING(source->dtype) && !NDARRAY_IS_FLOATING(dtype)) {
                 // floats must be treated separately, because they can't directly be converted to integer types
                 mp_float_t f = ndarray_get_float_value(sarray, source->dtype);
                 item = mp_obj_new_int((int32_t)MICROPY_FLOAT_C_FUN(round)(f));
             } else {
-                item = mp_binary_get_val_array(source->dtype, sarray, 0);
+                item = ndarray_get_value(source->dtype, sarray, 0);
             }
         #if ULAB_SUPPORTS_COMPLEX
             if(dtype == NDARRAY_COMPLEX) {
@@ -739,90 +836,202 @@ ndarray_obj_t *ndarray_new_linear_array(size_t len, uint8_t dtype) {
     return ndarray_new_dense_ndarray(1, shape, dtype);
 }
 
+#define NDARRAY_ASSIGN_ITEMS(type, ndarray, items, len, idx)\
+({\
+    type *array = (type *)(ndarray)->array + *(idx);\
+    for(size_t i = 0; i < (len); i++) {\
+        mp_obj_t item = (items)[i];\
+        if(mp_obj_is_small_int(item)) {\
+            *array = (type)MP_OBJ_SMALL_INT_VALUE(item);\
+        } else {\
+            ndarray_set_value((ndarray)->dtype, (ndarray)->array, *(idx) + i, item);\
+        }\
+        array++;\
+    }\
+})
+
+static void ndarray_assign_row(ndarray_obj_t *ndarray, mp_obj_t row, size_t len, size_t *idx) {
+    // fills the next len elements of ndarray from a single row of the input
+    // lists and tuples are read directly, and small integers and floats are
+    // written into the buffer without going through mp_binary_set_val_array
+    size_t n;
+    mp_obj_t *items;
+    if(mp_obj_is_type(row, &mp_type_list) || mp_obj_is_type(row, &mp_type_tuple)) {
+        mp_obj_get_array(row, &n, &items);
+    } else {
+        if(mp_obj_is_int(row) || mp_obj_is_float(row) || mp_obj_is_bool(row) || (row == mp_const_none)) {
+            // a scalar, where the shape of the first element requires a row, e.g., [[1, 2], 3]
+            mp_raise_ValueError(MP_ERROR_TEXT("inhomogeneous shape"));
+        }
+        mp_obj_iter_buf_t iter_buf;
+        mp_obj_t iterable = mp_getiter(row, &iter_buf);
+        size_t start = *idx;
+        ndarray_assign_elements(ndarray, iterable, ndarray->dtype, idx);
+        n = (*idx - start);
+        #if ULAB_SUPPORTS_COMPLEX
+        if(ndarray->dtype == NDARRAY_COMPLEX) {
+            n /= 2;
+        }
+        #endif
+        if(n != len) {
+            mp_raise_ValueError(MP_ERROR_TEXT("iterables are not of the same length"));
+        }
+        return;
+    }
+    if(n != len) {
+        mp_raise_ValueError(MP_ERROR_TEXT("iterables are not of the same length"));
+    }
+
+    if(ndarray->boolean) {
+        uint8_t *array = (uint8_t *)ndarray->array + *idx;
+        for(size_t i = 0; i < n; i++) {
+            *array++ = mp_obj_is_true(items[i]) ? 1 : 0;
+        }
+    } else if(ndarray->dtype == NDARRAY_UINT8) {
+        NDARRAY_ASSIGN_ITEMS(uint8_t, ndarray, items, n, idx);
+    } else if(ndarray->dtype == NDARRAY_INT8) {
+        NDARRAY_ASSIGN_ITEMS(int8_t, ndarray, items, n, idx);
+    } else if(ndarray->dtype == NDARRAY_UINT16) {
+        NDARRAY_ASSIGN_ITEMS(uint16_t, ndarray, items, n, idx);
+    } else if(ndarray->dtype == NDARRAY_INT16) {
+        NDARRAY_ASSIGN_ITEMS(int16_t, ndarray, items, n, idx);
+    #if ULAB_HAS_INT32
+    } else if(ndarray->dtype == NDARRAY_UINT32) {
+        NDARRAY_ASSIGN_ITEMS(uint32_t, ndarray, items, n, idx);
+    } else if(ndarray->dtype == NDARRAY_INT32) {
+        NDARRAY_ASSIGN_ITEMS(int32_t, ndarray, items, n, idx);
+    #endif
+    } else if(ndarray->dtype == NDARRAY_FLOAT) {
+        mp_float_t *array = (mp_float_t *)ndarray->array + *idx;
+        for(size_t i = 0; i < n; i++) {
+            mp_obj_t item = items[i];
+            if(mp_obj_is_small_int(item)) {
+                *array = (mp_float_t)MP_OBJ_SMALL_INT_VALUE(item);
+            } else if(mp_obj_is_float(item)) {
+                *array = mp_obj_float_get(item);
+            } else {
+                *array = mp_obj_get_float(item);
+            }
+            array++;
+        }
+    } else {
+        // complex arrays take the slow path
+        mp_obj_iter_buf_t iter_buf;
+        ndarray_assign_elements(ndarray, mp_getiter(row, &iter_buf), ndarray->dtype, idx);
+        return;
+    }
+    *idx += n;
+}
+
+static void ndarray_fill_from_iterable(ndarray_obj_t *ndarray, mp_obj_t obj, size_t *shape, uint8_t level, uint8_t ndim, size_t *idx) {
+    // descends into the hierarchy of nested iterables, and checks the length at each level
+    if(level == ndim - 1) {
+        ndarray_assign_row(ndarray, obj, shape[level], idx);
+        return;
+    }
+    mp_obj_t len = mp_obj_len_maybe(obj);
+    if((len == MP_OBJ_NULL) || ((size_t)MP_OBJ_SMALL_INT_VALUE(len) != shape[level])) {
+        mp_raise_ValueError(MP_ERROR_TEXT("iterables are not of the same length"));
+    }
+    if(mp_obj_is_type(obj, &mp_type_list) || mp_obj_is_type(obj, &mp_type_tuple)) {
+        size_t n;
+        mp_obj_t *items;
+        mp_obj_get_array(obj, &n, &items);
+        for(size_t i = 0; i < n; i++) {
+            ndarray_fill_from_iterable(ndarray, items[i], shape, level + 1, ndim, idx);
+        }
+    } else {
+        mp_obj_iter_buf_t iter_buf;
+        mp_obj_t iterable = mp_getiter(obj, &iter_buf);
+        mp_obj_t item;
+        while((item = mp_iternext(iterable)) != MP_OBJ_STOP_ITERATION) {
+            ndarray_fill_from_iterable(ndarray, item, shape, level + 1, ndim, idx);
+        }
+    }
+}
+
+static ndarray_obj_t *ndarray_from_buffer(mp_obj_t obj, uint8_t dtype) {
+    // returns a dense, linear array, if obj exposes the buffer protocol with a
+    // typecode that is known to ulab, and NULL otherwise
+    if(mp_obj_is_str(obj) || (dtype == NDARRAY_BOOL)) {
+        return NULL;
+    }
+    mp_buffer_info_t bufinfo;
+    if(!mp_get_buffer(obj, &bufinfo, MP_BUFFER_READ)) {
+        return NULL;
+    }
+    uint8_t typecode = bufinfo.typecode == BYTEARRAY_TYPECODE ? NDARRAY_UINT8 : bufinfo.typecode;
+    if((typecode != NDARRAY_UINT8) && (typecode != NDARRAY_INT8) && (typecode != NDARRAY_UINT16) &&
+        #if ULAB_HAS_INT32
+        (typecode != NDARRAY_UINT32) && (typecode != NDARRAY_INT32) &&
+        #endif
+        (typecode != NDARRAY_INT16) && (typecode != NDARRAY_FLOAT)) {
+        return NULL;
+    }
+    size_t len = bufinfo.len / ulab_binary_get_size(typecode);
+    if(typecode == dtype) {
+        ndarray_obj_t *ndarray = ndarray_new_dense_ndarray_uninitialised(len == 0 ? 0 : 1, ndarray_shape_vector(0, 0, 0, len), dtype);
+        memcpy(ndarray->array, bufinfo.buf, len * ndarray->itemsize);
+        return ndarray;
+    }
+    // the source is wrapped in a view, and converted in a single pass
+    ndarray_obj_t *source = ndarray_new_ndarray(1, ndarray_shape_vector(0, 0, 0, len), NULL, typecode, bufinfo.buf);
+    return ndarray_copy_view_convert_type(source, dtype);
+}
+
 ndarray_obj_t *ndarray_from_iterable(mp_obj_t obj, uint8_t dtype) {
     // returns an ndarray from an iterable micropython object
     // if the input is an ndarray, returns the input...
     if(mp_obj_is_type(obj, &ulab_ndarray_type)) {
         return MP_OBJ_TO_PTR(obj);
     }
+    // ... if the input exposes a buffer, copies the buffer in a single step...
+    if(!mp_obj_is_type(obj, &mp_type_list) && !mp_obj_is_type(obj, &mp_type_tuple)) {
+        ndarray_obj_t *ndarray = ndarray_from_buffer(obj, dtype);
+        if(ndarray != NULL) {
+            return ndarray;
+        }
+    }
     // ... otherwise, takes the values from the iterable, and creates the corresponding ndarray
 
     // First, we have to figure out, whether the elements of the iterable are iterables themself
+    // The shape is inferred from the first element in each dimension, and the length
+    // of all other elements is checked against it, when the values are copied
     uint8_t ndim = 0;
     size_t shape[ULAB_MAX_DIMS];
-    mp_obj_iter_buf_t iter_buf[ULAB_MAX_DIMS];
-    mp_obj_t iterable[ULAB_MAX_DIMS];
-    // inspect only the very first element in each dimension; this is fast,
-    // but not completely safe, e.g., length compatibility is not checked
+    size_t lengths[ULAB_MAX_DIMS];
     mp_obj_t item = obj;
 
     while(1) {
-        if(mp_obj_len_maybe(item) == MP_OBJ_NULL) {
+        mp_obj_t len = mp_obj_len_maybe(item);
+        if(len == MP_OBJ_NULL) {
             break;
         }
         if(ndim == ULAB_MAX_DIMS) {
             mp_raise_ValueError(MP_ERROR_TEXT("too many dimensions"));
         }
-        shape[ndim] = MP_OBJ_SMALL_INT_VALUE(mp_obj_len_maybe(item));
-        if(shape[ndim] == 0) {
+        lengths[ndim] = MP_OBJ_SMALL_INT_VALUE(len);
+        if(lengths[ndim] == 0) {
             ndim++;
             break;
         }
-        iterable[ndim] = mp_getiter(item, &iter_buf[ndim]);
-        item = mp_iternext(iterable[ndim]);
+        mp_obj_iter_buf_t iter_buf;
+        item = mp_iternext(mp_getiter(item, &iter_buf));
         ndim++;
     }
+    if(ndim == 0) {
+        mp_raise_TypeError(MP_ERROR_TEXT("wrong input type"));
+    }
     for(uint8_t i = 0; i < ndim; i++) {
         // align all values to the right
-        shape[ULAB_MAX_DIMS - i - 1] = shape[ndim - 1 - i];
+        shape[ULAB_MAX_DIMS - i - 1] = lengths[ndim - 1 - i];
     }
 
     ndarray_obj_t *ndarray = ndarray_new_dense_ndarray(ndim, shape, dtype);
-    item = obj;
-    for(uint8_t i = 0; i < ndim - 1; i++) {
-        // if ndim > 1, descend into the hierarchy
-        iterable[ULAB_MAX_DIMS - ndim + i] = mp_getiter(item, &iter_buf[ULAB_MAX_DIMS - ndim + i]);
-        item = mp_iternext(iterable[ULAB_MAX_DIMS - ndim + i]);
+    if(ndarray->len != 0) {
+        size_t idx = 0;
+        ndarray_fill_from_iterable(ndarray, obj, lengths, 0, ndim, &idx);
     }
-
-    size_t idx = 0;
-    // TODO: this could surely be done in a more elegant way...
-    #if ULAB_MAX_DIMS > 3
-    do {
-    #endif
-        #if ULAB_MAX_DIMS > 2
-        do {
-        #endif
-            #if ULAB_MAX_DIMS > 1
-            do {
-            #endif
-                iterable[ULAB_MAX_DIMS - 1] = mp_getiter(item, &iter_buf[ULAB_MAX_DIMS - 1]);
-                ndarray_assign_elements(ndarray, iterable[ULAB_MAX_DIMS - 1], ndarray->dtype, &idx);
-            #if ULAB_MAX_DIMS > 1
-                item = ndim > 1 ? mp_iternext(iterable[ULAB_MAX_DIMS - 2]) : MP_OBJ_STOP_ITERATION;
-            } while(item != MP_OBJ_STOP_ITERATION);
-            #endif
-        #if ULAB_MAX_DIMS > 2
-            item = ndim > 2 ? mp_iternext(iterable[ULAB_MAX_DIMS - 3]) : MP_OBJ_STOP_ITERATION;
-            if(item != MP_OBJ_STOP_ITERATION) {
-                iterable[ULAB_MAX_DIMS - 2] = mp_getiter(item, &iter_buf[ULAB_MAX_DIMS - 2]);
-                item = mp_iternext(iterable[ULAB_MAX_DIMS - 2]);
-            } else {
-                iterable[ULAB_MAX_DIMS - 2] = MP_OBJ_STOP_ITERATION;
-            }
-        } while(iterable[ULAB_MAX_DIMS - 2] != MP_OBJ_STOP_ITERATION);
-        #endif
-    #if ULAB_MAX_DIMS > 3
-        item = ndim > 3 ? mp_iternext(iterable[ULAB_MAX_DIMS - 4]) : MP_OBJ_STOP_ITERATION;
-        if(item != MP_OBJ_STOP_ITERATION) {
-            iterable[ULAB_MAX_DIMS - 3] = mp_getiter(item, &iter_buf[ULAB_MAX_DIMS - 3]);
-            item = mp_iternext(iterable[ULAB_MAX_DIMS - 3]);
-        } else {
-            iterable[ULAB_MAX_DIMS - 3] = MP_OBJ_STOP_ITERATION;
-        }
-    } while(iterable[ULAB_MAX_DIMS - 3] != MP_OBJ_STOP_ITERATION);
-    #endif
-
     return ndarray;
 }
 
@@ -932,6 +1141,262 @@ bool ndarray_can_broadcast_inplace(ndarray_obj_t *lhs, ndarray_obj_t *rhs, int32
 }
 #endif
 
+#if NDARRAY_IS_SLICEABLE | ULAB_NUMPY_HAS_TAKE
+size_t *ndarray_get_indices(mp_obj_t obj, size_t *len, size_t axis_len, uint8_t mode) {
+    // converts an integer ndarray, or an iterable of integers into a vector of non-negative
+    // indices; mode determines, how indices outside the range of the axis are treated
+    ndarray_obj_t *ndarray = NULL;
+    if(mp_obj_is_type(obj, &ulab_ndarray_type)) {
+        ndarray = MP_OBJ_TO_PTR(obj);
+        if(ndarray->boolean || NDARRAY_IS_FLOATING(ndarray->dtype)
+        #if ULAB_SUPPORTS_COMPLEX
+            || (ndarray->dtype == NDARRAY_COMPLEX)
+        #endif
+        ) {
+            mp_raise_msg(&mp_type_IndexError, MP_ERROR_TEXT("indices must be integers"));
+        }
+        if(ndarray->ndim > 1) {
+            mp_raise_NotImplementedError(MP_ERROR_TEXT("index arrays must be one-dimensional"));
+        }
+        *len = ndarray->len;
+    } else {
+        *len = (size_t)mp_obj_get_int(mp_obj_len(obj));
+    }
+    if((*len > 0) && (axis_len == 0)) {
+        mp_raise_msg(&mp_type_IndexError, MP_ERROR_TEXT("index is out of bounds"));
+    }
+
+    size_t *indices = m_new(size_t, MAX(1, *len));
+    uint8_t *array = NULL;
+    mp_obj_iter_buf_t buf;
+    mp_obj_t iterable = MP_OBJ_NULL;
+    if(ndarray != NULL) {
+        array = (uint8_t *)ndarray->array;
+    } else {
+        iterable = mp_getiter(obj, &buf);
+    }
+
+    for(size_t i = 0; i < *len; i++) {
+        mp_int_t index;
+        if(ndarray != NULL) {
+            index = (mp_int_t)ndarray_get_float_value(array, ndarray->dtype);
+            array += ndarray->strides[ULAB_MAX_DIMS - 1];
+        } else {
+            index = mp_obj_get_int(mp_iternext(iterable));
+        }
+        if(mode == NDARRAY_INDEX_RAISE) {
+            if(index < 0) {
+                index += axis_len;
+            }
+            if((index < 0) || (index >= (mp_int_t)axis_len)) {
+                m_del(size_t, indices, MAX(1, *len));
+                mp_raise_msg(&mp_type_IndexError, MP_ERROR_TEXT("index is out of bounds"));
+            }
+        } else if(mode == NDARRAY_INDEX_WRAP) {
+            index %= (mp_int_t)axis_len;
+            if(index < 0) {
+                index += axis_len;
+            }
+        } else { // mode == NDARRAY_INDEX_CLIP
+            if(index < 0) {
+                m_del(size_t, indices, MAX(1, *len));
+                mp_raise_ValueError(MP_ERROR_TEXT("index must not be negative"));
+            }
+            if(index >= (mp_int_t)axis_len) {
+                index = axis_len - 1;
+            }
+        }
+        indices[i] = (size_t)index;
+    }
+    return indices;
+}
+
+#define NDARRAY_COPY_ITEMS(size)\
+    for(size_t i = 0; i < n; i++) {\
+        memcpy(dst, src, (size));\
+        dst += dstride;\
+        src += sstride;\
+    }
+
+static void ndarray_copy_row(uint8_t *dst, int32_t dstride, uint8_t *src, int32_t sstride, size_t n, uint8_t itemsize) {
+    if((dstride == itemsize) && (sstride == itemsize)) {
+        memcpy(dst, src, n * itemsize);
+        return;
+    }
+    // with a constant size, the compiler can replace memcpy by a single load and store
+    switch(itemsize) {
+        case 1:
+            NDARRAY_COPY_ITEMS(1);
+            break;
+        case 2:
+            NDARRAY_COPY_ITEMS(2);
+            break;
+        case 4:
+            NDARRAY_COPY_ITEMS(4);
+            break;
+        case 8:
+            NDARRAY_COPY_ITEMS(8);
+            break;
+        default:
+            NDARRAY_COPY_ITEMS(itemsize);
+            break;
+    }
+}
+
+#define NDARRAY_GATHER_ITEMS(size)\
+    for(size_t k = 0; k < len; k++) {\
+        size_t x = order == NULL ? k : order[k];\
+        memcpy(oarray + x * ostride, sarray + indices[x] * sstride, (size));\
+    }
+
+static void ndarray_copy_slab(uint8_t *dst, int32_t *dstrides, uint8_t *src, int32_t *sstrides, size_t *shape, uint8_t ndim, uint8_t itemsize) {
+    // copies a block of ndim dimensions; shape and the strides are aligned to the right
+    if(ndim == 0) {
+        ndarray_copy_row(dst, 0, src, 0, 1, itemsize);
+        return;
+    }
+    size_t rows = 1;
+    for(uint8_t i = ULAB_MAX_DIMS - ndim; i < ULAB_MAX_DIMS - 1; i++) {
+        rows *= shape[i];
+    }
+    #if ULAB_MAX_DIMS > 1
+    size_t coords[ULAB_MAX_DIMS] = { 0 };
+    #endif
+    for(size_t r = 0; r < rows; r++) {
+        ndarray_copy_row(dst, dstrides[ULAB_MAX_DIMS - 1], src, sstrides[ULAB_MAX_DIMS - 1], shape[ULAB_MAX_DIMS - 1], itemsize);
+        #if ULAB_MAX_DIMS > 1
+        if(r + 1 < rows) {
+            uint8_t i = ULAB_MAX_DIMS - 2;
+            dst += dstrides[i];
+            src += sstrides[i];
+            coords[i]++;
+            while((coords[i] == shape[i]) && (i > ULAB_MAX_DIMS - ndim)) {
+                dst -= dstrides[i] * shape[i];
+                src -= sstrides[i] * shape[i];
+                coords[i] = 0;
+                i--;
+                dst += dstrides[i];
+                src += sstrides[i];
+                coords[i]++;
+            }
+        }
+        #endif
+    }
+}
+
+static uint8_t ndarray_slab_geometry(ndarray_obj_t *ndarray, uint8_t axis, size_t *shape, int32_t *strides) {
+    // removes axis from the shape and strides of ndarray, aligns the rest to the right,
+    // and returns the number of remaining dimensions
+    uint8_t k = ULAB_MAX_DIMS;
+    for(uint8_t i = ULAB_MAX_DIMS; i > ULAB_MAX_DIMS - ndarray->ndim; i--) {
+        if(i - 1 == ULAB_MAX_DIMS - ndarray->ndim + axis) {
+            continue;
+        }
+        k--;
+        if(shape != NULL) {
+            shape[k] = ndarray->shape[i - 1];
+        }
+        strides[k] = ndarray->strides[i - 1];
+    }
+    return ndarray->ndim - 1;
+}
+
+#if NDARRAY_GATHER_SORT_THRESHOLD
+static size_t *ndarray_sort_indices(size_t *indices, size_t len) {
+    // returns the permutation that sorts the indices, or NULL, if they are sorted already
+    bool sorted = true;
+    for(size_t i = 1; i < len; i++) {
+        if(indices[i] < indices[i - 1]) {
+            sorted = false;
+            break;
+        }
+    }
+    if(sorted) {
+        return NULL;
+    }
+    size_t *order = m_new(size_t, len);
+    for(size_t i = 0; i < len; i++) {
+        order[i] = i;
+    }
+    // shell sort with halving gaps
+    for(size_t gap = len / 2; gap > 0; gap /= 2) {
+        for(size_t i = gap; i < len; i++) {
+            size_t tmp = order[i];
+            size_t j = i;
+            while((j >= gap) && (indices[order[j - gap]] > indices[tmp])) {
+                order[j] = order[j - gap];
+                j -= gap;
+            }
+            order[j] = tmp;
+        }
+    }
+    return order;
+}
+#endif
+
+ndarray_obj_t *ndarray_gather(ndarray_obj_t *source, uint8_t axis, size_t *indices, size_t len, ndarray_obj_t *out) {
+    // collects the slabs of source at the given indices along axis; if out is not NULL,
+    // it must have the shape of the source, with len at the position of axis
+    uint8_t ax = ULAB_MAX_DIMS - source->ndim + axis;
+    if(out == NULL) {
+        size_t shape[ULAB_MAX_DIMS];
+        memcpy(shape, source->shape, ULAB_MAX_DIMS * sizeof(size_t));
+        shape[ax] = len;
+        out = ndarray_new_dense_ndarray(source->ndim, shape, source->boolean ? NDARRAY_BOOL : source->dtype);
+    }
+    if(len == 0) {
+        return out;
+    }
+
+    size_t shape[ULAB_MAX_DIMS];
+    int32_t sstrides[ULAB_MAX_DIMS], ostrides[ULAB_MAX_DIMS];
+    uint8_t ndim = ndarray_slab_geometry(source, axis, shape, sstrides);
+    ndarray_slab_geometry(out, axis, NULL, ostrides);
+
+    uint8_t *sarray = (uint8_t *)source->array;
+    uint8_t *oarray = (uint8_t *)out->array;
+    size_t *order = NULL;
+    #if NDARRAY_GATHER_SORT_THRESHOLD
+    if(len >= NDARRAY_GATHER_SORT_THRESHOLD) {
+        order = ndarray_sort_indices(indices, len);
+    }
+    #endif
+
+    if(ndim == 0) {
+        // the source is one-dimensional, hence, the slabs are single elements
+        int32_t sstride = source->strides[ax];
+        int32_t ostride = out->strides[ax];
+        switch(source->itemsize) {
+            case 1:
+                NDARRAY_GATHER_ITEMS(1);
+                break;
+            case 2:
+                NDARRAY_GATHER_ITEMS(2);
+                break;
+            case 4:
+                NDARRAY_GATHER_ITEMS(4);
+                break;
+            case 8:
+                NDARRAY_GATHER_ITEMS(8);
+                break;
+            default:
+                NDARRAY_GATHER_ITEMS(source->itemsize);
+                break;
+        }
+    } else {
+        for(size_t k = 0; k < len; k++) {
+            size_t x = order == NULL ? k : order[k];
+            ndarray_copy_slab(oarray + x * out->strides[ax], ostrides, sarray + indices[x] * source->strides[ax],
+                                sstrides, shape, ndim, source->itemsize);
+        }
+    }
+    if(order != NULL) {
+        m_del(size_t, order, len);
+    }
+    return out;
+}
+#endif /* NDARRAY_IS_SLICEABLE | ULAB_NUMPY_HAS_TAKE */
+
 #if NDARRAY_IS_SLICEABLE
 static size_t slice_length(mp_bound_slice_t slice) {
     ssize_t len, correction = 1;
@@ -1073,154 +1538,309 @@ void ndarray_assign_view(ndarray_obj_t *view, ndarray_obj_t *values) {
     return;
 }
 
-static mp_obj_t ndarray_from_boolean_index(ndarray_obj_t *ndarray, ndarray_obj_t *index) {
-    // returns a 1D array, indexed by a Boolean array
-    if(ndarray->len != index->len) {
-        mp_raise_ValueError(MP_ERROR_TEXT("array and index length must be equal"));
+enum NDARRAY_BOOLEAN_MODE {
+    NDARRAY_BOOLEAN_COUNT,
+    NDARRAY_BOOLEAN_GET,
+    NDARRAY_BOOLEAN_SET,
+    NDARRAY_BOOLEAN_FILL,
+};
+
+static ndarray_obj_t *ndarray_boolean_target(ndarray_obj_t *ndarray, ndarray_obj_t *index) {
+    // returns the array that is to be walked together with the mask: a mask of the same
+    // shape is applied directly, while a 1D mask selects from a contiguous array as if it were flat
+    if(!index->boolean) {
+        mp_raise_NotImplementedError(MP_ERROR_TEXT("operation is implemented for Boolean arrays only"));
+    }
+    if(index->ndim == ndarray->ndim) {
+        bool same_shape = true;
+        for(uint8_t i = ULAB_MAX_DIMS; i > ULAB_MAX_DIMS - ndarray->ndim; i--) {
+            if(index->shape[i - 1] != ndarray->shape[i - 1]) {
+                same_shape = false;
+            }
+        }
+        if(same_shape) {
+            return ndarray;
+        }
     }
-    uint8_t *iarray = (uint8_t *)index->array;
-    // first we have to find out how many trues there are
+    if((index->ndim == 1) && (index->len == ndarray->len) && ndarray_is_contiguous(ndarray)) {
+        size_t shape[ULAB_MAX_DIMS];
+        int32_t strides[ULAB_MAX_DIMS];
+        shape[ULAB_MAX_DIMS - 1] = ndarray->len;
+        strides[ULAB_MAX_DIMS - 1] = ndarray->itemsize;
+        return ndarray_new_view(ndarray, 1, shape, strides, 0);
+    }
+    mp_raise_msg(&mp_type_IndexError, MP_ERROR_TEXT("Boolean index does not match the shape of the array"));
+}
+
+static size_t ndarray_boolean_walk(ndarray_obj_t *ndarray, ndarray_obj_t *index, uint8_t *buffer, uint8_t mode) {
+    // walks the array and the mask of the same shape row by row, and moves the selected elements
+    // between the array, and the packed buffer; runs of Trues in rows, whose elements follow
+    // each other, are moved with a single memcpy; returns the number of selected elements
     size_t count = 0;
-    for(size_t i=0; i < index->len; i++) {
-        count += *iarray;
-        iarray += index->strides[ULAB_MAX_DIMS - 1];
+    if(ndarray->len == 0) {
+        return count;
     }
-    ndarray_obj_t *results = ndarray_new_linear_array(count, ndarray->dtype);
-    uint8_t *rarray = (uint8_t *)results->array;
+    uint8_t itemsize = ndarray->itemsize;
     uint8_t *array = (uint8_t *)ndarray->array;
-    // re-wind the index array
-    iarray = index->array;
-    for(size_t i=0; i < index->len; i++) {
-        if(*iarray) {
-            memcpy(rarray, array, results->itemsize);
-            rarray += results->itemsize;
-            count++;
+    uint8_t *iarray = (uint8_t *)index->array;
+    int32_t astride = ndarray->strides[ULAB_MAX_DIMS - 1];
+    int32_t istride = index->strides[ULAB_MAX_DIMS - 1];
+    size_t n = ndarray->shape[ULAB_MAX_DIMS - 1];
+    size_t rows = ndarray->len / n;
+    #if ULAB_MAX_DIMS > 1
+    size_t coords[ULAB_MAX_DIMS] = { 0 };
+    #endif
+
+    for(size_t r = 0; r < rows; r++) {
+        size_t l = 0;
+        while(l < n) {
+            if(!iarray[l * istride]) {
+                l++;
+                continue;
+            }
+            size_t start = l;
+            while((l < n) && iarray[l * istride]) {
+                l++;
+            }
+            size_t run = l - start;
+            count += run;
+            uint8_t *rarray = array + start * astride;
+            if(mode == NDARRAY_BOOLEAN_GET) {
+                if(astride == itemsize) {
+                    memcpy(buffer, rarray, run * itemsize);
+                    buffer += run * itemsize;
+                } else {
+                    for(size_t k = 0; k < run; k++) {
+                        memcpy(buffer, rarray, itemsize);
+                        buffer += itemsize;
+                        rarray += astride;
+                    }
+                }
+            } else if(mode == NDARRAY_BOOLEAN_SET) {
+                if(astride == itemsize) {
+                    memcpy(rarray, buffer, run * itemsize);
+                    buffer += run * itemsize;
+                } else {
+                    for(size_t k = 0; k < run; k++) {
+                        memcpy(rarray, buffer, itemsize);
+                        buffer += itemsize;
+                        rarray += astride;
+                    }
+                }
+            } else if(mode == NDARRAY_BOOLEAN_FILL) {
+                if((itemsize == 1) && (astride == 1)) {
+                    memset(rarray, *buffer, run);
+                } else {
+                    for(size_t k = 0; k < run; k++) {
+                        memcpy(rarray, buffer, itemsize);
+                        rarray += astride;
+                    }
+                }
+            }
         }
-        array += ndarray->strides[ULAB_MAX_DIMS - 1];
-        iarray += index->strides[ULAB_MAX_DIMS - 1];
+        #if ULAB_MAX_DIMS > 1
+        if(r + 1 < rows) {
+            // move to the next row, and carry into the higher dimensions
+            uint8_t i = ULAB_MAX_DIMS - 2;
+            array += ndarray->strides[i];
+            iarray += index->strides[i];
+            coords[i]++;
+            while((coords[i] == ndarray->shape[i]) && (i > ULAB_MAX_DIMS - ndarray->ndim)) {
+                array -= ndarray->strides[i] * ndarray->shape[i];
+                iarray -= index->strides[i] * index->shape[i];
+                coords[i] = 0;
+                i--;
+                array += ndarray->strides[i];
+                iarray += index->strides[i];
+                coords[i]++;
+            }
+        }
+        #endif
+    }
+    return count;
+}
+
+static mp_obj_t ndarray_from_boolean_index(ndarray_obj_t *ndarray, ndarray_obj_t *index) {
+    // returns a 1D array, indexed by a Boolean array
+    ndarray_obj_t *target = ndarray_boolean_target(ndarray, index);
+    size_t count = ndarray_boolean_walk(index, index, NULL, NDARRAY_BOOLEAN_COUNT);
+    uint8_t dtype = ndarray->boolean ? NDARRAY_BOOL : ndarray->dtype;
+    ndarray_obj_t *results = ndarray_new_linear_array(count, dtype);
+    if(count) {
+        ndarray_boolean_walk(target, index, (uint8_t *)results->array, NDARRAY_BOOLEAN_GET);
     }
     return MP_OBJ_FROM_PTR(results);
 }
 
+static void ndarray_convert_scalar(uint8_t dtype, void *buffer, mp_obj_t value) {
+    // converts a scalar to dtype in the same way, as ndarray_copy_view_convert_type would,
+    // and writes it into buffer
+    #if ULAB_SUPPORTS_COMPLEX
+    if(dtype == NDARRAY_COMPLEX) {
+        mp_float_t *cbuffer = (mp_float_t *)buffer;
+        mp_obj_get_complex(value, &cbuffer[0], &cbuffer[1]);
+        return;
+    }
+    #endif
+    if(mp_obj_is_float(value) && !NDARRAY_IS_FLOATING(dtype)) {
+        value = mp_obj_new_int((int32_t)MICROPY_FLOAT_C_FUN(round)(mp_obj_get_float(value)));
+    }
+    ndarray_set_value(dtype, buffer, 0, value);
+}
+
+static void ndarray_fill_from_boolean_index(ndarray_obj_t *ndarray, ndarray_obj_t *index, mp_obj_t value) {
+    // assigns a scalar to a Boolean-indexed array without creating an array for the value
+    ndarray_obj_t *target = ndarray_boolean_target(ndarray, index);
+    mp_float_t buffer[2];
+    ndarray_convert_scalar(ndarray->dtype, buffer, value);
+    ndarray_boolean_walk(target, index, (uint8_t *)buffer, NDARRAY_BOOLEAN_FILL);
+}
+
 static mp_obj_t ndarray_assign_from_boolean_index(ndarray_obj_t *ndarray, ndarray_obj_t *index, ndarray_obj_t *values) {
     // assigns values to a Boolean-indexed array
-    // first we have to find out how many trues there are
-    uint8_t *iarray = (uint8_t *)index->array;
-    size_t istride = index->strides[ULAB_MAX_DIMS - 1];
-    size_t count = 0;
-    for(size_t i=0; i < index->len; i++) {
-        count += *iarray;
-        iarray += istride;
-    }
-    // re-wind the index array
-    iarray = index->array;
-    uint8_t *varray = (uint8_t *)values->array;
-    size_t vstride;
-
-    if(count == values->len) {
-        // there are as many values as true indices
-        vstride = values->strides[ULAB_MAX_DIMS - 1];
-    } else {
-        // there is a single value
-        vstride = 0;
+    ndarray_obj_t *target = ndarray_boolean_target(ndarray, index);
+    #if ULAB_SUPPORTS_COMPLEX
+    if((values->dtype == NDARRAY_COMPLEX) && (ndarray->dtype != NDARRAY_COMPLEX)) {
+        mp_raise_TypeError(MP_ERROR_TEXT("cannot convert complex to dtype"));
+    }
+    #endif
+    if(values->len == 1) {
+        // a single value is broadcast to all selected positions
+        ndarray_fill_from_boolean_index(ndarray, index, ndarray_get_item(values, values->array));
+        return MP_OBJ_FROM_PTR(ndarray);
     }
+    size_t count = ndarray_boolean_walk(index, index, NULL, NDARRAY_BOOLEAN_COUNT);
+    if(count != values->len) {
+        mp_raise_ValueError(MP_ERROR_TEXT("operands could not be broadcast together"));
+    }
+    if((values->dtype != ndarray->dtype) || !ndarray_is_contiguous(values)) {
+        // the values are packed, and converted to the dtype of the array
+        values = ndarray_copy_view_convert_type(values, ndarray->dtype);
+    }
+    ndarray_boolean_walk(target, index, (uint8_t *)values->array, NDARRAY_BOOLEAN_SET);
+    return MP_OBJ_FROM_PTR(ndarray);
+}
 
-    #if ULAB_SUPPORTS_COMPLEX
-    if(values->dtype == NDARRAY_COMPLEX) {
-        if(ndarray->dtype != NDARRAY_COMPLEX) {
+static void ndarray_scatter(ndarray_obj_t *target, uint8_t axis, size_t *indices, size_t len, mp_obj_t value) {
+    // writes value into the slabs of target at the given indices along axis; value is either
+    // a scalar, a single-element array, or an array of the shape of the selection
+    uint8_t ax = ULAB_MAX_DIMS - target->ndim + axis;
+    size_t shape[ULAB_MAX_DIMS];
+    int32_t tstrides[ULAB_MAX_DIMS], vstrides[ULAB_MAX_DIMS] = { 0 };
+    uint8_t ndim = ndarray_slab_geometry(target, axis, shape, tstrides);
+
+    mp_float_t buffer[2];
+    uint8_t *varray = (uint8_t *)buffer;
+    int32_t vstride = 0;
+
+    if(mp_obj_is_type(value, &ulab_ndarray_type)) {
+        ndarray_obj_t *values = MP_OBJ_TO_PTR(value);
+        #if ULAB_SUPPORTS_COMPLEX
+        if((values->dtype == NDARRAY_COMPLEX) && (target->dtype != NDARRAY_COMPLEX)) {
             mp_raise_TypeError(MP_ERROR_TEXT("cannot convert complex to dtype"));
+        }
+        #endif
+        if(values->len == 1) {
+            value = ndarray_get_item(values, values->array);
         } else {
-            uint8_t *array = (uint8_t *)ndarray->array;
-            for(size_t i = 0; i < ndarray->len; i++) {
-                if(*iarray) {
-                    memcpy(array, varray, ndarray->itemsize);
-                    varray += vstride;
-                }
-                array += ndarray->strides[ULAB_MAX_DIMS - 1];
-                iarray += istride;
-            } while(0);
-            return MP_OBJ_FROM_PTR(ndarray);
+            bool same_shape = values->ndim == target->ndim;
+            for(uint8_t i = ULAB_MAX_DIMS; same_shape && (i > ULAB_MAX_DIMS - target->ndim); i--) {
+                size_t n = i - 1 == ax ? len : target->shape[i - 1];
+                same_shape = values->shape[i - 1] == n;
+            }
+            if(!same_shape) {
+                mp_raise_ValueError(MP_ERROR_TEXT("operands could not be broadcast together"));
+            }
+            if(values->dtype != target->dtype) {
+                values = ndarray_copy_view_convert_type(values, target->dtype);
+            }
+            varray = (uint8_t *)values->array;
+            vstride = values->strides[ax];
+            ndarray_slab_geometry(values, axis, NULL, vstrides);
+            value = MP_OBJ_NULL;
         }
     }
-    #endif
+    if(value != MP_OBJ_NULL) {
+        // the scalar is converted only once, and its strides are all 0
+        ndarray_convert_scalar(target->dtype, buffer, value);
+    }
 
-    int32_t lstrides = ndarray->strides[ULAB_MAX_DIMS - 1] / ndarray->itemsize;
+    uint8_t *tarray = (uint8_t *)target->array;
+    for(size_t x = 0; x < len; x++) {
+        ndarray_copy_slab(tarray + indices[x] * target->strides[ax], tstrides, varray + x * vstride, vstrides,
+                            shape, ndim, target->itemsize);
+    }
+}
 
-    if(ndarray->dtype == NDARRAY_UINT8) {
-        if(values->dtype == NDARRAY_UINT8) {
-            BOOLEAN_ASSIGNMENT_LOOP(uint8_t, uint8_t, ndarray, lstrides, iarray, istride, varray, vstride);
-        } else if(values->dtype == NDARRAY_INT8) {
-            BOOLEAN_ASSIGNMENT_LOOP(uint8_t, int8_t, ndarray, lstrides, iarray, istride, varray, vstride);
-        } else if(values->dtype == NDARRAY_UINT16) {
-            BOOLEAN_ASSIGNMENT_LOOP(uint8_t, uint16_t, ndarray, lstrides, iarray, istride, varray, vstride);
-        } else if(values->dtype == NDARRAY_INT16) {
-            BOOLEAN_ASSIGNMENT_LOOP(uint8_t, int16_t, ndarray, lstrides, iarray, istride, varray, vstride);
-        } else if(values->dtype == NDARRAY_FLOAT) {
-            BOOLEAN_ASSIGNMENT_LOOP(uint8_t, mp_float_t, ndarray, lstrides, iarray, istride, varray, vstride);
-        }
-    } else if(ndarray->dtype == NDARRAY_INT8) {
-        if(values->dtype == NDARRAY_UINT8) {
-            BOOLEAN_ASSIGNMENT_LOOP(int8_t, uint8_t, ndarray, lstrides, iarray, istride, varray, vstride);
-        } else if(values->dtype == NDARRAY_INT8) {
-            BOOLEAN_ASSIGNMENT_LOOP(int8_t, int8_t, ndarray, lstrides, iarray, istride, varray, vstride);
-        } else if(values->dtype == NDARRAY_UINT16) {
-            BOOLEAN_ASSIGNMENT_LOOP(int8_t, uint16_t, ndarray, lstrides, iarray, istride, varray, vstride);
-        } else if(values->dtype == NDARRAY_INT16) {
-            BOOLEAN_ASSIGNMENT_LOOP(int8_t, int16_t, ndarray, lstrides, iarray, istride, varray, vstride);
-        } else if(values->dtype == NDARRAY_FLOAT) {
-            BOOLEAN_ASSIGNMENT_LOOP(int8_t, mp_float_t, ndarray, lstrides, iarray, istride, varray, vstride);
-        }
-    } else if(ndarray->dtype == NDARRAY_UINT16) {
-        if(values->dtype == NDARRAY_UINT8) {
-            BOOLEAN_ASSIGNMENT_LOOP(uint16_t, uint8_t, ndarray, lstrides, iarray, istride, varray, vstride);
-        } else if(values->dtype == NDARRAY_INT8) {
-            BOOLEAN_ASSIGNMENT_LOOP(uint16_t, int8_t, ndarray, lstrides, iarray, istride, varray, vstride);
-        } else if(values->dtype == NDARRAY_UINT16) {
-            BOOLEAN_ASSIGNMENT_LOOP(uint16_t, uint16_t, ndarray, lstrides, iarray, istride, varray, vstride);
-        } else if(values->dtype == NDARRAY_INT16) {
-            BOOLEAN_ASSIGNMENT_LOOP(uint16_t, int16_t, ndarray, lstrides, iarray, istride, varray, vstride);
-        } else if(values->dtype == NDARRAY_FLOAT) {
-            BOOLEAN_ASSIGNMENT_LOOP(uint16_t, mp_float_t, ndarray, lstrides, iarray, istride, varray, vstride);
-        }
-    } else if(ndarray->dtype == NDARRAY_INT16) {
-        if(values->dtype == NDARRAY_UINT8) {
-            BOOLEAN_ASSIGNMENT_LOOP(int16_t, uint8_t, ndarray, lstrides, iarray, istride, varray, vstride);
-        } else if(values->dtype == NDARRAY_INT8) {
-            BOOLEAN_ASSIGNMENT_LOOP(int16_t, int8_t, ndarray, lstrides, iarray, istride, varray, vstride);
-        } else if(values->dtype == NDARRAY_UINT16) {
-            BOOLEAN_ASSIGNMENT_LOOP(int16_t, uint16_t, ndarray, lstrides, iarray, istride, varray, vstride);
-        } else if(values->dtype == NDARRAY_INT16) {
-            BOOLEAN_ASSIGNMENT_LOOP(int16_t, int16_t, ndarray, lstrides, iarray, istride, varray, vstride);
-        } else if(values->dtype == NDARRAY_FLOAT) {
-            BOOLEAN_ASSIGNMENT_LOOP(int16_t, mp_float_t, ndarray, lstrides, iarray, istride, varray, vstride);
-        }
+static bool ndarray_is_integer_index(mp_obj_t index) {
+    // lists, and non-Boolean ndarrays are treated as integer-array indices
+    if(mp_obj_is_type(index, &mp_type_list)) {
+        return true;
+    }
+    if(mp_obj_is_type(index, &ulab_ndarray_type)) {
+        ndarray_obj_t *ndarray = MP_OBJ_TO_PTR(index);
+        return !ndarray->boolean;
+    }
+    return false;
+}
+
+static mp_obj_t ndarray_integer_index(ndarray_obj_t *ndarray, uint8_t axis, mp_obj_t index, mp_obj_t value) {
+    // gathers from, or scatters into ndarray along axis
+    size_t len;
+    size_t *indices = ndarray_get_indices(index, &len, ndarray->shape[ULAB_MAX_DIMS - ndarray->ndim + axis], NDARRAY_INDEX_RAISE);
+    mp_obj_t result = mp_const_none;
+    if(value == MP_OBJ_NULL) {
+        result = MP_OBJ_FROM_PTR(ndarray_gather(ndarray, axis, indices, len, NULL));
     } else {
-        #if ULAB_SUPPORTS_COMPLEX
-        if(ndarray->dtype == NDARRAY_COMPLEX) {
-            lstrides *= 2;
+        ndarray_scatter(ndarray, axis, indices, len, value);
+    }
+    m_del(size_t, indices, MAX(1, len));
+    return result;
+}
+
+static bool ndarray_try_integer_index(ndarray_obj_t *ndarray, mp_obj_t index, mp_obj_t value, mp_obj_t *result) {
+    // handles a[idx], and a[..., idx, ...] with a single integer-array index; returns false,
+    // if there is no integer-array index, and the request has to be handled elsewhere
+    if(ndarray_is_integer_index(index)) {
+        *result = ndarray_integer_index(ndarray, 0, index, value);
+        return true;
+    }
+    if(!mp_obj_is_type(index, &mp_type_tuple)) {
+        return false;
+    }
+    mp_obj_tuple_t *tuple = MP_OBJ_TO_PTR(index);
+    uint8_t position = 0, count = 0, reduced = 0;
+    for(uint8_t i = 0; i < tuple->len; i++) {
+        if(ndarray_is_integer_index(tuple->items[i])) {
+            position = i;
+            count++;
         }
-        #endif
-        if(values->dtype == NDARRAY_UINT8) {
-            BOOLEAN_ASSIGNMENT_LOOP(mp_float_t, uint8_t, ndarray, lstrides, iarray, istride, varray, vstride);
-        } else if(values->dtype == NDARRAY_INT8) {
-            BOOLEAN_ASSIGNMENT_LOOP(mp_float_t, int8_t, ndarray, lstrides, iarray, istride, varray, vstride);
-        } else if(values->dtype == NDARRAY_UINT16) {
-            BOOLEAN_ASSIGNMENT_LOOP(mp_float_t, uint16_t, ndarray, lstrides, iarray, istride, varray, vstride);
-        } else if(values->dtype == NDARRAY_INT16) {
-            BOOLEAN_ASSIGNMENT_LOOP(mp_float_t, int16_t, ndarray, lstrides, iarray, istride, varray, vstride);
-        } else if(values->dtype == NDARRAY_FLOAT) {
-            BOOLEAN_ASSIGNMENT_LOOP(mp_float_t, mp_float_t, ndarray, lstrides, iarray, istride, varray, vstride);
+    }
+    if(count == 0) {
+        return false;
+    }
+    if(count > 1) {
+        mp_raise_NotImplementedError(MP_ERROR_TEXT("only one integer array index is supported"));
+    }
+    if(tuple->len > ndarray->ndim) {
+        mp_raise_msg(&mp_type_IndexError, MP_ERROR_TEXT("too many indices"));
+    }
+    // the integer-array index is replaced by a full slice, and it is then applied to the view
+    mp_obj_tuple_t *slices = MP_OBJ_TO_PTR(mp_obj_new_tuple(tuple->len, tuple->items));
+    slices->items[position] = mp_obj_new_slice(mp_const_none, mp_const_none, mp_const_none);
+    for(uint8_t i = 0; i < position; i++) {
+        if(mp_obj_is_int(tuple->items[i])) {
+            reduced++;
         }
     }
-    return MP_OBJ_FROM_PTR(ndarray);
+    ndarray_obj_t *view = ndarray_view_from_slices(ndarray, slices);
+    *result = ndarray_integer_index(view, position - reduced, tuple->items[position], value);
+    return true;
 }
 
 static mp_obj_t ndarray_get_slice(ndarray_obj_t *ndarray, mp_obj_t index, ndarray_obj_t *values) {
     if(mp_obj_is_type(index, &ulab_ndarray_type)) {
         ndarray_obj_t *nindex = MP_OBJ_TO_PTR(index);
-        if((nindex->ndim > 1) || (nindex->boolean == false)) {
-            mp_raise_NotImplementedError(MP_ERROR_TEXT("operation is implemented for 1D Boolean arrays only"));
-        }
         if(values == NULL) { // return value(s)
             return ndarray_from_boolean_index(ndarray, nindex);
         } else { // assign value(s)
@@ -1260,9 +1880,31 @@ mp_obj_t ndarray_subscr(mp_obj_t self_in, mp_obj_t index, mp_obj_t value) {
     }
     ndarray_obj_t *self = MP_OBJ_TO_PTR(self_in);
 
+    mp_obj_t result;
     if (value == MP_OBJ_SENTINEL) { // return value(s)
+        if(ndarray_try_integer_index(self, index, MP_OBJ_NULL, &result)) {
+            return result;
+        }
         return ndarray_get_slice(self, index, NULL);
     } else { // assignment to slices; the value must be an ndarray, or a scalar
+        if(ndarray_is_integer_index(index) || mp_obj_is_type(index, &mp_type_tuple)) {
+            // scalars are passed on directly, so that they do not have to be boxed
+            mp_obj_t _value = value;
+            if(!mp_obj_is_int(value) && !mp_obj_is_float(value) && !mp_obj_is_bool(value)) {
+                _value = MP_OBJ_FROM_PTR(ndarray_from_mp_obj(value, 0));
+            }
+            if(ndarray_try_integer_index(self, index, _value, &result)) {
+                return mp_const_none;
+            }
+        }
+        if(mp_obj_is_type(index, &ulab_ndarray_type) && !mp_obj_is_type(value, &ulab_ndarray_type)) {
+            ndarray_obj_t *nindex = MP_OBJ_TO_PTR(index);
+            if(nindex->boolean && (mp_obj_is_int(value) || mp_obj_is_float(value) || mp_obj_is_bool(value))) {
+                // a[mask] = scalar is handled without a temporary array
+                ndarray_fill_from_boolean_index(self, nindex, value);
+                return mp_const_none;
+            }
+        }
         ndarray_obj_t *values = ndarray_from_mp_obj(value, 0);
         return ndarray_get_slice(self, index, values);
     }
@@ -1489,6 +2131,15 @@ ndarray_obj_t *ndarray_from_mp_obj(mp_obj_t obj, uint8_t other_type) {
 
     if(mp_obj_is_int(obj)) {
         int32_t ivalue = mp_obj_get_int(obj);
+        #if ULAB_HAS_INT32
+        if((other_type == NDARRAY_INT32) || ((other_type == NDARRAY_UINT32) && (ivalue >= 0))) {
+            // scalars inherit the 32-bit type of the other operand, so that the operation is exact
+            uint8_t dtype = ((other_type == NDARRAY_UINT32) && (ivalue >= 0)) ? NDARRAY_UINT32 : NDARRAY_INT32;
+            ndarray = ndarray_new_linear_array(1, dtype);
+            ndarray_set_value(dtype, ndarray->array, 0, obj);
+            return ndarray;
+        }
+        #endif
         if((ivalue < -32768) || (ivalue > 65535)) {
             // the integer value clearly does not fit the ulab integer types, so move on to float
             ndarray = ndarray_new_linear_array(1, NDARRAY_FLOAT);
@@ -1591,6 +2242,12 @@ mp_obj_t ndarray_binary_op(mp_binary_op_t _op, mp_obj_t lobj, mp_obj_t robj) {
         m_del(int32_t, lstrides, ULAB_MAX_DIMS);
         m_del(int32_t, rstrides, ULAB_MAX_DIMS);
     }
+    #if ULAB_HAS_FLOAT16
+    if((lhs->dtype == NDARRAY_FLOAT16) || (rhs->dtype == NDARRAY_FLOAT16)) {
+        return ndarray_binary_op_float16(op, lhs, rhs);
+    }
+    #endif
+
     // the empty arrays have to be treated separately
     uint8_t dtype = NDARRAY_INT16;
     ndarray_obj_t *nd;
@@ -1606,7 +2263,13 @@ mp_obj_t ndarray_binary_op(mp_binary_op_t _op, mp_obj_t lobj, mp_obj_t robj) {
                 // because dtype is initialised with that NDARRAY_INT16
                 if(lhs->dtype == rhs->dtype) {
                     dtype = rhs->dtype;
-                } else if((lhs->dtype == NDARRAY_FLOAT) || (rhs->dtype == NDARRAY_FLOAT)) {
+                }
+                #if ULAB_HAS_INT32
+                else if(NDARRAY_IS_INT32(lhs) || NDARRAY_IS_INT32(rhs)) {
+                    dtype = ndarray_upcast_dtype(lhs->dtype, rhs->dtype);
+                }
+                #endif
+                else if((lhs->dtype == NDARRAY_FLOAT) || (rhs->dtype == NDARRAY_FLOAT)) {
                     dtype = NDARRAY_FLOAT;
                 } else if(((lhs->dtype == NDARRAY_UINT8) && (rhs->dtype == NDARRAY_UINT16)) ||
                             ((lhs->dtype == NDARRAY_INT8) && (rhs->dtype == NDARRAY_UINT16)) ||
@@ -1640,6 +2303,12 @@ mp_obj_t ndarray_binary_op(mp_binary_op_t _op, mp_obj_t lobj, mp_obj_t robj) {
         }
     }
 
+    #if ULAB_HAS_INT32
+    if(NDARRAY_IS_INT32(lhs) || NDARRAY_IS_INT32(rhs)) {
+        return ndarray_binary_op_int32(op, lhs, rhs, ndim, shape, lstrides, rstrides);
+    }
+    #endif
+
     switch(op) {
         // first the in-place operators
         #if NDARRAY_HAS_INPLACE_ADD
@@ -1656,7 +2325,11 @@ mp_obj_t ndarray_binary_op(mp_binary_op_t _op, mp_obj_t lobj, mp_obj_t robj) {
         #endif
         #if NDARRAY_HAS_INPLACE_MULTIPLY
         case MP_BINARY_OP_INPLACE_MULTIPLY:
-            COMPLEX_DTYPE_NOT_IMPLEMENTED(lhs->dtype);
+            #if ULAB_SUPPORTS_COMPLEX
+            if((lhs->dtype == NDARRAY_COMPLEX) || (rhs->dtype == NDARRAY_COMPLEX)) {
+                return carray_inplace_multiply_divide(lhs, rhs, rstrides, op);
+            }
+            #endif
             return ndarray_inplace_ams(lhs, rhs, rstrides, op);
             break;
         #endif
@@ -1674,7 +2347,11 @@ mp_obj_t ndarray_binary_op(mp_binary_op_t _op, mp_obj_t lobj, mp_obj_t robj) {
         #endif
         #if NDARRAY_HAS_INPLACE_TRUE_DIVIDE
         case MP_BINARY_OP_INPLACE_TRUE_DIVIDE:
-            COMPLEX_DTYPE_NOT_IMPLEMENTED(lhs->dtype);
+            #if ULAB_SUPPORTS_COMPLEX
+            if((lhs->dtype == NDARRAY_COMPLEX) || (rhs->dtype == NDARRAY_COMPLEX)) {
+                return carray_inplace_multiply_divide(lhs, rhs, rstrides, op);
+            }
+            #endif
             return ndarray_inplace_divide(lhs, rhs, rstrides);
             break;
         #endif
@@ -1795,7 +2472,25 @@ mp_obj_t ndarray_unary_op(mp_unary_op_t op, mp_obj_t self_in) {
                     for(size_t i=0; i < self->len; i++, array++) {
                         if(*array < 0) *array = -(*array);
                     }
-                } else {
+                }
+                #if ULAB_HAS_INT32
+                else if(self->dtype == NDARRAY_INT32) {
+                    int32_t *array = (int32_t *)ndarray->array;
+                    for(size_t i=0; i < self->len; i++, array++) {
+                        if(*array < 0) *array = -(*array);
+                    }
+                } else if(self->dtype == NDARRAY_UINT32) {
+                    // nothing to do
+                }
+                #endif
+                #if ULAB_HAS_FLOAT16
+                else if(self->dtype == NDARRAY_FLOAT16) {
+                    // clear the sign bit
+                    uint16_t *array = (uint16_t *)ndarray->array;
+                    for(size_t i=0; i < self->len; i++, array++) *array &= 0x7fff;
+                }
+                #endif
+                else {
                     mp_float_t *array = (mp_float_t *)ndarray->array;
                     for(size_t i=0; i < self->len; i++, array++) {
                         if(*array < 0) *array = -(*array);
@@ -1810,9 +2505,9 @@ mp_obj_t ndarray_unary_op(mp_unary_op_t op, mp_obj_t self_in) {
         #if NDARRAY_HAS_UNARY_OP_INVERT
         case MP_UNARY_OP_INVERT:
             #if ULAB_SUPPORTS_COMPLEX
-            if(self->dtype == NDARRAY_FLOAT || self->dtype == NDARRAY_COMPLEX) {
+            if(NDARRAY_IS_FLOATING(self->dtype) || self->dtype == NDARRAY_COMPLEX) {
             #else
-            if(self->dtype == NDARRAY_FLOAT) {
+            if(NDARRAY_IS_FLOATING(self->dtype)) {
             #endif
                 mp_raise_ValueError(MP_ERROR_TEXT("operation is not supported for given type"));
             }
@@ -1848,7 +2543,24 @@ mp_obj_t ndarray_unary_op(mp_unary_op_t op, mp_obj_t self_in) {
             } else if(self->dtype == NDARRAY_INT16) {
                 int16_t *array = (int16_t *)ndarray->array;
                 for(size_t i=0; i < self->len; i++, array++) *array = -(*array);
-            } else {
+            }
+            #if ULAB_HAS_INT32
+            else if(self->dtype == NDARRAY_UINT32) {
+                uint32_t *array = (uint32_t *)ndarray->array;
+                for(size_t i=0; i < self->len; i++, array++) *array = -(*array);
+            } else if(self->dtype == NDARRAY_INT32) {
+                int32_t *array = (int32_t *)ndarray->array;
+                for(size_t i=0; i < self->len; i++, array++) *array = -(*array);
+            }
+            #endif
+            #if ULAB_HAS_FLOAT16
+            else if(self->dtype == NDARRAY_FLOAT16) {
+                // flip the sign bit
+                uint16_t *array = (uint16_t *)ndarray->array;
+                for(size_t i=0; i < self->len; i++, array++) *array ^= 0x8000;
+            }
+            #endif
+            else {
                 mp_float_t *array = (mp_float_t *)ndarray->array;
                 size_t len = self->len;
                 #if ULAB_SUPPORTS_COMPLEX
@@ -2095,7 +2807,20 @@ mp_obj_t ndarray_info(mp_obj_t obj_in) {
         mp_printf(MP_PYTHON_PRINTER, "uint16\n");
     } else if(ndarray->dtype == NDARRAY_INT16) {
         mp_printf(MP_PYTHON_PRINTER, "int16\n");
-    } else if(ndarray->dtype == NDARRAY_FLOAT) {
+    }
+    #if ULAB_HAS_INT32
+    else if(ndarray->dtype == NDARRAY_UINT32) {
+        mp_printf(MP_PYTHON_PRINTER, "uint32\n");
+    } else if(ndarray->dtype == NDARRAY_INT32) {
+        mp_printf(MP_PYTHON_PRINTER, "int32\n");
+    }
+    #endif
+    #if ULAB_HAS_FLOAT16
+    else if(ndarray->dtype == NDARRAY_FLOAT16) {
+        mp_printf(MP_PYTHON_PRINTER, "float16\n");
+    }
+    #endif
+    else if(ndarray->dtype == NDARRAY_FLOAT) {
         mp_printf(MP_PYTHON_PRINTER, "float\n");
     }
     return mp_const_none;
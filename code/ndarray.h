@@ -111,7 +111,14 @@ typedef struct _mp_obj_slice_t {
 #endif
 #endif
 
+#if ULAB_HAS_FLOAT16
+// mp_binary_get_val_array/mp_binary_set_val_array do not know about half-precision floats
+mp_obj_t ndarray_get_value(char , void *, size_t );
+void ndarray_set_value(char , void *, size_t , mp_obj_t );
+#else
+#define ndarray_get_value(a, b, c) mp_binary_get_val_array(a, b, c)
 #define ndarray_set_value(a, b, c, d) mp_binary_set_val_array(a, b, c, d)
+#endif
 void ndarray_set_complex_value(void *, size_t , mp_obj_t );
 
 #define NDARRAY_NUMERIC   0
@@ -128,12 +135,32 @@ enum NDARRAY_TYPE {
     NDARRAY_INT8 = 'b',
     NDARRAY_UINT16 = 'H',
     NDARRAY_INT16 = 'h',
+    #if ULAB_HAS_INT32
+        NDARRAY_UINT32 = 'I',
+        NDARRAY_INT32 = 'i',
+    #endif
+    #if ULAB_HAS_FLOAT16
+        NDARRAY_FLOAT16 = 'e',
+    #endif
     #if ULAB_SUPPORTS_COMPLEX
         NDARRAY_COMPLEX = 'c',
     #endif
     NDARRAY_FLOAT = FLOAT_TYPECODE,
 };
 
+#if ULAB_HAS_FLOAT16
+#define NDARRAY_IS_FLOATING(dtype) (((dtype) == NDARRAY_FLOAT) || ((dtype) == NDARRAY_FLOAT16))
+// functions without a dedicated float16 implementation work on a float copy of the input
+#define FLOAT16_PROMOTE_TO_FLOAT(ndarray) if((ndarray)->dtype == NDARRAY_FLOAT16) { (ndarray) = ndarray_copy_view_convert_type((ndarray), NDARRAY_FLOAT); }
+#else
+#define NDARRAY_IS_FLOATING(dtype) ((dtype) == NDARRAY_FLOAT)
+#define FLOAT16_PROMOTE_TO_FLOAT(ndarray) // do nothing
+#endif
+
+#if ULAB_HAS_INT32
+#define NDARRAY_IS_INT32(ndarray) (((ndarray)->dtype == NDARRAY_INT32) || ((ndarray)->dtype == NDARRAY_UINT32))
+#endif
+
 typedef struct _ndarray_obj_t {
     mp_obj_base_t base;
     uint8_t dtype;
@@ -187,12 +214,24 @@ int32_t *ndarray_contract_strides(ndarray_obj_t *, uint8_t );
 
 ndarray_obj_t *ndarray_from_iterable(mp_obj_t , uint8_t );
 ndarray_obj_t *ndarray_new_dense_ndarray(uint8_t , size_t *, uint8_t );
+ndarray_obj_t *ndarray_new_dense_ndarray_uninitialised(uint8_t , size_t *, uint8_t );
 ndarray_obj_t *ndarray_new_ndarray_from_tuple(mp_obj_tuple_t *, uint8_t );
 ndarray_obj_t *ndarray_new_ndarray(uint8_t , size_t *, int32_t *, uint8_t , uint8_t *);
 ndarray_obj_t *ndarray_new_linear_array(size_t , uint8_t );
 ndarray_obj_t *ndarray_new_view(ndarray_obj_t *, uint8_t , size_t *, int32_t *, int32_t );
 bool ndarray_is_dense(ndarray_obj_t *);
+bool ndarray_is_contiguous(ndarray_obj_t *);
 ndarray_obj_t *ndarray_copy_view(ndarray_obj_t *);
+#if NDARRAY_IS_SLICEABLE | ULAB_NUMPY_HAS_TAKE
+enum NDARRAY_INDEX_MODE {
+    NDARRAY_INDEX_RAISE,
+    NDARRAY_INDEX_WRAP,
+    NDARRAY_INDEX_CLIP,
+};
+
+size_t *ndarray_get_indices(mp_obj_t , size_t *, size_t , uint8_t );
+ndarray_obj_t *ndarray_gather(ndarray_obj_t *, uint8_t , size_t *, size_t , ndarray_obj_t *);
+#endif
 ndarray_obj_t *ndarray_copy_view_convert_type(ndarray_obj_t *, uint8_t );
 void ndarray_copy_array(ndarray_obj_t *, ndarray_obj_t *, uint8_t );
 
@@ -287,17 +326,6 @@ mp_int_t ndarray_get_buffer(mp_obj_t , mp_buffer_info_t *, mp_uint_t );
 ndarray_obj_t *ndarray_from_mp_obj(mp_obj_t , uint8_t );
 
 
-#define BOOLEAN_ASSIGNMENT_LOOP(type_left, type_right, ndarray, lstrides, iarray, istride, varray, vstride)\
-    type_left *array = (type_left *)(ndarray)->array;\
-    for(size_t i=0; i < (ndarray)->len; i++) {\
-        if(*(iarray)) {\
-            *array = (type_left)(*((type_right *)(varray)));\
-            (varray) += (vstride);\
-        }\
-        array += (lstrides);\
-        (iarray) += (istride);\
-    } while(0)
-
 #if ULAB_HAS_FUNCTION_ITERATOR
 #define BINARY_LOOP(results, type_out, type_left, type_right, larray, lstrides, rarray, rstrides, OPERATOR)\
     type_out *array = (type_out *)(results)->array;\
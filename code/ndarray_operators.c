@@ -66,6 +66,8 @@ mp_obj_t ndarray_binary_equality(ndarray_obj_t *lhs, ndarray_obj_t *rhs,
                 EQUALITY_LOOP(results, array, uint8_t, int16_t, larray, lstrides, rarray, rstrides, ==);
             } else if(rhs->dtype == NDARRAY_FLOAT) {
                 EQUALITY_LOOP(results, array, uint8_t, mp_float_t, larray, lstrides, rarray, rstrides, ==);
+            } else {
+                return ndarray_binary_op(op, MP_OBJ_FROM_PTR(rhs), MP_OBJ_FROM_PTR(lhs));
             }
         } else if(lhs->dtype == NDARRAY_INT8) {
             if(rhs->dtype == NDARRAY_INT8) {
@@ -120,6 +122,8 @@ mp_obj_t ndarray_binary_equality(ndarray_obj_t *lhs, ndarray_obj_t *rhs,
                 EQUALITY_LOOP(results, array, uint8_t, int16_t, larray, lstrides, rarray, rstrides, !=);
             } else if(rhs->dtype == NDARRAY_FLOAT) {
                 EQUALITY_LOOP(results, array, uint8_t, mp_float_t, larray, lstrides, rarray, rstrides, !=);
+            } else {
+                return ndarray_binary_op(op, MP_OBJ_FROM_PTR(rhs), MP_OBJ_FROM_PTR(lhs));
             }
         } else if(lhs->dtype == NDARRAY_INT8) {
             if(rhs->dtype == NDARRAY_INT8) {
@@ -181,63 +185,63 @@ mp_obj_t ndarray_binary_add(ndarray_obj_t *lhs, ndarray_obj_t *rhs,
 
     if(lhs->dtype == NDARRAY_UINT8) {
         if(rhs->dtype == NDARRAY_UINT8) {
-            results = ndarray_new_dense_ndarray(ndim, shape, NDARRAY_UINT8);
+            results = ndarray_new_dense_ndarray_uninitialised(ndim, shape, NDARRAY_UINT8);
             BINARY_LOOP(results, uint8_t, uint8_t, uint8_t, larray, lstrides, rarray, rstrides, +);
         } else if(rhs->dtype == NDARRAY_INT8) {
-            results = ndarray_new_dense_ndarray(ndim, shape, NDARRAY_INT16);
+            results = ndarray_new_dense_ndarray_uninitialised(ndim, shape, NDARRAY_INT16);
             BINARY_LOOP(results, int16_t, uint8_t, int8_t, larray, lstrides, rarray, rstrides, +);
         } else if(rhs->dtype == NDARRAY_UINT16) {
-            results = ndarray_new_dense_ndarray(ndim, shape, NDARRAY_UINT16);
+            results = ndarray_new_dense_ndarray_uninitialised(ndim, shape, NDARRAY_UINT16);
             BINARY_LOOP(results, uint16_t, uint8_t, uint16_t, larray, lstrides, rarray, rstrides, +);
         } else if(rhs->dtype == NDARRAY_INT16) {
-            results = ndarray_new_dense_ndarray(ndim, shape, NDARRAY_INT16);
+            results = ndarray_new_dense_ndarray_uninitialised(ndim, shape, NDARRAY_INT16);
             BINARY_LOOP(results, int16_t, uint8_t, int16_t, larray, lstrides, rarray, rstrides, +);
         } else if(rhs->dtype == NDARRAY_FLOAT) {
-            results = ndarray_new_dense_ndarray(ndim, shape, NDARRAY_FLOAT);
+            results = ndarray_new_dense_ndarray_uninitialised(ndim, shape, NDARRAY_FLOAT);
             BINARY_LOOP(results, mp_float_t, uint8_t, mp_float_t, larray, lstrides, rarray, rstrides, +);
         }
     } else if(lhs->dtype == NDARRAY_INT8) {
         if(rhs->dtype == NDARRAY_INT8) {
-            results = ndarray_new_dense_ndarray(ndim, shape, NDARRAY_INT8);
+            results = ndarray_new_dense_ndarray_uninitialised(ndim, shape, NDARRAY_INT8);
             BINARY_LOOP(results, int8_t, int8_t, int8_t, larray, lstrides, rarray, rstrides, +);
         } else if(rhs->dtype == NDARRAY_UINT16) {
-            results = ndarray_new_dense_ndarray(ndim, shape, NDARRAY_INT16);
+            results = ndarray_new_dense_ndarray_uninitialised(ndim, shape, NDARRAY_INT16);
             BINARY_LOOP(results, int16_t, int8_t, uint16_t, larray, lstrides, rarray, rstrides, +);
         } else if(rhs->dtype == NDARRAY_INT16) {
-            results = ndarray_new_dense_ndarray(ndim, shape, NDARRAY_INT16);
+            results = ndarray_new_dense_ndarray_uninitialised(ndim, shape, NDARRAY_INT16);
             BINARY_LOOP(results, int16_t, int8_t, int16_t, larray, lstrides, rarray, rstrides, +);
         } else if(rhs->dtype == NDARRAY_FLOAT) {
-            results = ndarray_new_dense_ndarray(ndim, shape, NDARRAY_FLOAT);
+            results = ndarray_new_dense_ndarray_uninitialised(ndim, shape, NDARRAY_FLOAT);
             BINARY_LOOP(results, mp_float_t, int8_t, mp_float_t, larray, lstrides, rarray, rstrides, +);
         } else {
             return ndarray_binary_op(MP_BINARY_OP_ADD, MP_OBJ_FROM_PTR(rhs), MP_OBJ_FROM_PTR(lhs));
         }
     } else if(lhs->dtype == NDARRAY_UINT16) {
         if(rhs->dtype == NDARRAY_UINT16) {
-            results = ndarray_new_dense_ndarray(ndim, shape, NDARRAY_UINT16);
+            results = ndarray_new_dense_ndarray_uninitialised(ndim, shape, NDARRAY_UINT16);
             BINARY_LOOP(results, uint16_t, uint16_t, uint16_t, larray, lstrides, rarray, rstrides, +);
         } else if(rhs->dtype == NDARRAY_INT16) {
-            results = ndarray_new_dense_ndarray(ndim, shape, NDARRAY_FLOAT);
+            results = ndarray_new_dense_ndarray_uninitialised(ndim, shape, NDARRAY_FLOAT);
             BINARY_LOOP(results, mp_float_t, uint16_t, int16_t, larray, lstrides, rarray, rstrides, +);
         } else if(rhs->dtype == NDARRAY_FLOAT) {
-            results = ndarray_new_dense_ndarray(ndim, shape, NDARRAY_FLOAT);
+            results = ndarray_new_dense_ndarray_uninitialised(ndim, shape, NDARRAY_FLOAT);
             BINARY_LOOP(results, mp_float_t, uint16_t, mp_float_t, larray, lstrides, rarray, rstrides, +);
         } else {
             return ndarray_binary_op(MP_BINARY_OP_ADD, MP_OBJ_FROM_PTR(rhs), MP_OBJ_FROM_PTR(lhs));
         }
     } else if(lhs->dtype == NDARRAY_INT16) {
         if(rhs->dtype == NDARRAY_INT16) {
-            results = ndarray_new_dense_ndarray(ndim, shape, NDARRAY_INT16);
+            results = ndarray_new_dense_ndarray_uninitialised(ndim, shape, NDARRAY_INT16);
             BINARY_LOOP(results, int16_t, int16_t, int16_t, larray, lstrides, rarray, rstrides, +);
         } else if(rhs->dtype == NDARRAY_FLOAT) {
-            results = ndarray_new_dense_ndarray(ndim, shape, NDARRAY_FLOAT);
+            results = ndarray_new_dense_ndarray_uninitialised(ndim, shape, NDARRAY_FLOAT);
             BINARY_LOOP(results, mp_float_t, int16_t, mp_float_t, larray, lstrides, rarray, rstrides, +);
         } else {
             return ndarray_binary_op(MP_BINARY_OP_ADD, MP_OBJ_FROM_PTR(rhs), MP_OBJ_FROM_PTR(lhs));
         }
     } else if(lhs->dtype == NDARRAY_FLOAT) {
         if(rhs->dtype == NDARRAY_FLOAT) {
-            results = ndarray_new_dense_ndarray(ndim, shape, NDARRAY_FLOAT);
+            results = ndarray_new_dense_ndarray_uninitialised(ndim, shape, NDARRAY_FLOAT);
             BINARY_LOOP(results, mp_float_t, mp_float_t, mp_float_t, larray, lstrides, rarray, rstrides, +);
         } else {
             return ndarray_binary_op(MP_BINARY_OP_ADD, MP_OBJ_FROM_PTR(rhs), MP_OBJ_FROM_PTR(lhs));
@@ -258,87 +262,87 @@ mp_obj_t ndarray_binary_modulo(ndarray_obj_t *lhs, ndarray_obj_t *rhs,
 
     if(lhs->dtype == NDARRAY_UINT8) {
         if(rhs->dtype == NDARRAY_UINT8) {
-            results = ndarray_new_dense_ndarray(ndim, shape, NDARRAY_UINT8);
+            results = ndarray_new_dense_ndarray_uninitialised(ndim, shape, NDARRAY_UINT8);
             BINARY_LOOP(results, uint8_t, uint8_t, uint8_t, larray, lstrides, rarray, rstrides, %);
         } else if(rhs->dtype == NDARRAY_INT8) {
-            results = ndarray_new_dense_ndarray(ndim, shape, NDARRAY_INT16);
+            results = ndarray_new_dense_ndarray_uninitialised(ndim, shape, NDARRAY_INT16);
             BINARY_LOOP(results, int16_t, uint8_t, int8_t, larray, lstrides, rarray, rstrides, %);
         } else if(rhs->dtype == NDARRAY_UINT16) {
-            results = ndarray_new_dense_ndarray(ndim, shape, NDARRAY_UINT16);
+            results = ndarray_new_dense_ndarray_uninitialised(ndim, shape, NDARRAY_UINT16);
             BINARY_LOOP(results, uint16_t, uint8_t, uint16_t, larray, lstrides, rarray, rstrides, %);
         } else if(rhs->dtype == NDARRAY_INT16) {
-            results = ndarray_new_dense_ndarray(ndim, shape, NDARRAY_INT16);
+            results = ndarray_new_dense_ndarray_uninitialised(ndim, shape, NDARRAY_INT16);
             BINARY_LOOP(results, int16_t, uint8_t, int16_t, larray, lstrides, rarray, rstrides, %);
         } else if(rhs->dtype == NDARRAY_FLOAT) {
-            results = ndarray_new_dense_ndarray(ndim, shape, NDARRAY_FLOAT);
+            results = ndarray_new_dense_ndarray_uninitialised(ndim, shape, NDARRAY_FLOAT);
             MODULO_FLOAT_LOOP(results, mp_float_t, uint8_t, mp_float_t, larray, lstrides, rarray, rstrides);
         }
     } else if(lhs->dtype == NDARRAY_INT8) {
         if(rhs->dtype == NDARRAY_UINT8) {
-            results = ndarray_new_dense_ndarray(ndim, shape, NDARRAY_INT16);
+            results = ndarray_new_dense_ndarray_uninitialised(ndim, shape, NDARRAY_INT16);
             BINARY_LOOP(results, int16_t, int8_t, uint8_t, larray, lstrides, rarray, rstrides, %);
         } else if(rhs->dtype == NDARRAY_INT8) {
-            results = ndarray_new_dense_ndarray(ndim, shape, NDARRAY_INT8);
+            results = ndarray_new_dense_ndarray_uninitialised(ndim, shape, NDARRAY_INT8);
             BINARY_LOOP(results, int8_t, int8_t, int8_t, larray, lstrides, rarray, rstrides, %);
         } else if(rhs->dtype == NDARRAY_UINT16) {
-            results = ndarray_new_dense_ndarray(ndim, shape, NDARRAY_INT16);
+            results = ndarray_new_dense_ndarray_uninitialised(ndim, shape, NDARRAY_INT16);
             BINARY_LOOP(results, int16_t, int8_t, int16_t, larray, lstrides, rarray, rstrides, %);
         } else if(rhs->dtype == NDARRAY_INT16) {
-            results = ndarray_new_dense_ndarray(ndim, shape, NDARRAY_INT16);
+            results = ndarray_new_dense_ndarray_uninitialised(ndim, shape, NDARRAY_INT16);
             BINARY_LOOP(results, int16_t, int8_t, int16_t, larray, lstrides, rarray, rstrides, %);
         } else if(rhs->dtype == NDARRAY_FLOAT) {
-            results = ndarray_new_dense_ndarray(ndim, shape, NDARRAY_FLOAT);
+            results = ndarray_new_dense_ndarray_uninitialised(ndim, shape, NDARRAY_FLOAT);
             MODULO_FLOAT_LOOP(results, mp_float_t, int8_t, mp_float_t, larray, lstrides, rarray, rstrides);
         }
     } else if(lhs->dtype == NDARRAY_UINT16) {
         if(rhs->dtype == NDARRAY_UINT8) {
-            results = ndarray_new_dense_ndarray(ndim, shape, NDARRAY_UINT16);
+            results = ndarray_new_dense_ndarray_uninitialised(ndim, shape, NDARRAY_UINT16);
             BINARY_LOOP(results, uint16_t, uint16_t, uint8_t, larray, lstrides, rarray, rstrides, %);
         } else if(rhs->dtype == NDARRAY_INT8) {
-            results = ndarray_new_dense_ndarray(ndim, shape, NDARRAY_FLOAT);
+            results = ndarray_new_dense_ndarray_uninitialised(ndim, shape, NDARRAY_FLOAT);
             BINARY_LOOP(results, mp_float_t, uint16_t, int8_t, larray, lstrides, rarray, rstrides, %);
         } else if(rhs->dtype == NDARRAY_UINT16) {
-            results = ndarray_new_dense_ndarray(ndim, shape, NDARRAY_UINT16);
+            results = ndarray_new_dense_ndarray_uninitialised(ndim, shape, NDARRAY_UINT16);
             BINARY_LOOP(results, uint16_t, uint16_t, uint16_t, larray, lstrides, rarray, rstrides, %);
         } else if(rhs->dtype == NDARRAY_INT16) {
-            results = ndarray_new_dense_ndarray(ndim, shape, NDARRAY_FLOAT);
+            results = ndarray_new_dense_ndarray_uninitialised(ndim, shape, NDARRAY_FLOAT);
             BINARY_LOOP(results, mp_float_t, uint16_t, int16_t, larray, lstrides, rarray, rstrides, %);
         } else if(rhs->dtype == NDARRAY_FLOAT) {
-            results = ndarray_new_dense_ndarray(ndim, shape, NDARRAY_FLOAT);
+            results = ndarray_new_dense_ndarray_uninitialised(ndim, shape, NDARRAY_FLOAT);
             MODULO_FLOAT_LOOP(results, mp_float_t, uint16_t, mp_float_t, larray, lstrides, rarray, rstrides);
         }
     } else if(lhs->dtype == NDARRAY_INT16) {
         if(rhs->dtype == NDARRAY_UINT8) {
-            results = ndarray_new_dense_ndarray(ndim, shape, NDARRAY_INT16);
+            results = ndarray_new_dense_ndarray_uninitialised(ndim, shape, NDARRAY_INT16);
             BINARY_LOOP(results, int16_t, int16_t, uint8_t, larray, lstrides, rarray, rstrides, %);
         } else if(rhs->dtype == NDARRAY_INT8) {
-            results = ndarray_new_dense_ndarray(ndim, shape, NDARRAY_INT16);
+            results = ndarray_new_dense_ndarray_uninitialised(ndim, shape, NDARRAY_INT16);
             BINARY_LOOP(results, int16_t, int16_t, int8_t, larray, lstrides, rarray, rstrides, %);
         } else if(rhs->dtype == NDARRAY_UINT16) {
-            results = ndarray_new_dense_ndarray(ndim, shape, NDARRAY_FLOAT);
+            results = ndarray_new_dense_ndarray_uninitialised(ndim, shape, NDARRAY_FLOAT);
             BINARY_LOOP(results, mp_float_t, int16_t, uint16_t, larray, lstrides, rarray, rstrides, %);
         } else if(rhs->dtype == NDARRAY_INT16) {
-            results = ndarray_new_dense_ndarray(ndim, shape, NDARRAY_INT16);
+            results = ndarray_new_dense_ndarray_uninitialised(ndim, shape, NDARRAY_INT16);
             BINARY_LOOP(results, int16_t, int16_t, int16_t, larray, lstrides, rarray, rstrides, %);
         } else if(rhs->dtype == NDARRAY_FLOAT) {
-            results = ndarray_new_dense_ndarray(ndim, shape, NDARRAY_FLOAT);
+            results = ndarray_new_dense_ndarray_uninitialised(ndim, shape, NDARRAY_FLOAT);
             MODULO_FLOAT_LOOP(results, mp_float_t, int16_t, mp_float_t, larray, lstrides, rarray, rstrides);
         }
     } else if(lhs->dtype == NDARRAY_FLOAT) {
         if(rhs->dtype == NDARRAY_UINT8) {
-            results = ndarray_new_dense_ndarray(ndim, shape, NDARRAY_FLOAT);
+            results = ndarray_new_dense_ndarray_uninitialised(ndim, shape, NDARRAY_FLOAT);
             MODULO_FLOAT_LOOP(results, mp_float_t, mp_float_t, uint8_t, larray, lstrides, rarray, rstrides);
         } else if(rhs->dtype == NDARRAY_INT8) {
-            results = ndarray_new_dense_ndarray(ndim, shape, NDARRAY_FLOAT);
+            results = ndarray_new_dense_ndarray_uninitialised(ndim, shape, NDARRAY_FLOAT);
             MODULO_FLOAT_LOOP(results, mp_float_t, mp_float_t, int8_t, larray, lstrides, rarray, rstrides);
         } else if(rhs->dtype == NDARRAY_UINT16) {
-            results = ndarray_new_dense_ndarray(ndim, shape, NDARRAY_FLOAT);
+            results = ndarray_new_dense_ndarray_uninitialised(ndim, shape, NDARRAY_FLOAT);
             MODULO_FLOAT_LOOP(results, mp_float_t, mp_float_t, uint16_t, larray, lstrides, rarray, rstrides);
         } else if(rhs->dtype == NDARRAY_INT16) {
-            results = ndarray_new_dense_ndarray(ndim, shape, NDARRAY_FLOAT);
+            results = ndarray_new_dense_ndarray_uninitialised(ndim, shape, NDARRAY_FLOAT);
             MODULO_FLOAT_LOOP(results, mp_float_t, mp_float_t, int16_t, larray, lstrides, rarray, rstrides);
         } else if(rhs->dtype == NDARRAY_FLOAT) {
-            results = ndarray_new_dense_ndarray(ndim, shape, NDARRAY_FLOAT);
+            results = ndarray_new_dense_ndarray_uninitialised(ndim, shape, NDARRAY_FLOAT);
             MODULO_FLOAT_LOOP(results, mp_float_t, mp_float_t, mp_float_t, larray, lstrides, rarray, rstrides);
         }
     }
@@ -363,63 +367,63 @@ mp_obj_t ndarray_binary_multiply(ndarray_obj_t *lhs, ndarray_obj_t *rhs,
 
     if(lhs->dtype == NDARRAY_UINT8) {
         if(rhs->dtype == NDARRAY_UINT8) {
-            results = ndarray_new_dense_ndarray(ndim, shape, NDARRAY_UINT8);
+            results = ndarray_new_dense_ndarray_uninitialised(ndim, shape, NDARRAY_UINT8);
             BINARY_LOOP(results, uint8_t, uint8_t, uint8_t, larray, lstrides, rarray, rstrides, *);
         } else if(rhs->dtype == NDARRAY_INT8) {
-            results = ndarray_new_dense_ndarray(ndim, shape, NDARRAY_INT16);
+            results = ndarray_new_dense_ndarray_uninitialised(ndim, shape, NDARRAY_INT16);
             BINARY_LOOP(results, int16_t, uint8_t, int8_t, larray, lstrides, rarray, rstrides, *);
         } else if(rhs->dtype == NDARRAY_UINT16) {
-            results = ndarray_new_dense_ndarray(ndim, shape, NDARRAY_UINT16);
+            results = ndarray_new_dense_ndarray_uninitialised(ndim, shape, NDARRAY_UINT16);
             BINARY_LOOP(results, uint16_t, uint8_t, uint16_t, larray, lstrides, rarray, rstrides, *);
         } else if(rhs->dtype == NDARRAY_INT16) {
-            results = ndarray_new_dense_ndarray(ndim, shape, NDARRAY_INT16);
+            results = ndarray_new_dense_ndarray_uninitialised(ndim, shape, NDARRAY_INT16);
             BINARY_LOOP(results, int16_t, uint8_t, int16_t, larray, lstrides, rarray, rstrides, *);
         } else if(rhs->dtype == NDARRAY_FLOAT) {
-            results = ndarray_new_dense_ndarray(ndim, shape, NDARRAY_FLOAT);
+            results = ndarray_new_dense_ndarray_uninitialised(ndim, shape, NDARRAY_FLOAT);
             BINARY_LOOP(results, mp_float_t, uint8_t, mp_float_t, larray, lstrides, rarray, rstrides, *);
         }
     } else if(lhs->dtype == NDARRAY_INT8) {
         if(rhs->dtype == NDARRAY_INT8) {
-            results = ndarray_new_dense_ndarray(ndim, shape, NDARRAY_INT8);
+            results = ndarray_new_dense_ndarray_uninitialised(ndim, shape, NDARRAY_INT8);
             BINARY_LOOP(results, int8_t, int8_t, int8_t, larray, lstrides, rarray, rstrides, *);
         } else if(rhs->dtype == NDARRAY_UINT16) {
-            results = ndarray_new_dense_ndarray(ndim, shape, NDARRAY_INT16);
+            results = ndarray_new_dense_ndarray_uninitialised(ndim, shape, NDARRAY_INT16);
             BINARY_LOOP(results, int16_t, int8_t, uint16_t, larray, lstrides, rarray, rstrides, *);
         } else if(rhs->dtype == NDARRAY_INT16) {
-            results = ndarray_new_dense_ndarray(ndim, shape, NDARRAY_INT16);
+            results = ndarray_new_dense_ndarray_uninitialised(ndim, shape, NDARRAY_INT16);
             BINARY_LOOP(results, int16_t, int8_t, int16_t, larray, lstrides, rarray, rstrides, *);
         } else if(rhs->dtype == NDARRAY_FLOAT) {
-            results = ndarray_new_dense_ndarray(ndim, shape, NDARRAY_FLOAT);
+            results = ndarray_new_dense_ndarray_uninitialised(ndim, shape, NDARRAY_FLOAT);
             BINARY_LOOP(results, mp_float_t, int8_t, mp_float_t, larray, lstrides, rarray, rstrides, *);
         } else {
             return ndarray_binary_op(MP_BINARY_OP_MULTIPLY, MP_OBJ_FROM_PTR(rhs), MP_OBJ_FROM_PTR(lhs));
         }
     } else if(lhs->dtype == NDARRAY_UINT16) {
         if(rhs->dtype == NDARRAY_UINT16) {
-            results = ndarray_new_dense_ndarray(ndim, shape, NDARRAY_UINT16);
+            results = ndarray_new_dense_ndarray_uninitialised(ndim, shape, NDARRAY_UINT16);
             BINARY_LOOP(results, uint16_t, uint16_t, uint16_t, larray, lstrides, rarray, rstrides, *);
         } else if(rhs->dtype == NDARRAY_INT16) {
-            results = ndarray_new_dense_ndarray(ndim, shape, NDARRAY_FLOAT);
+            results = ndarray_new_dense_ndarray_uninitialised(ndim, shape, NDARRAY_FLOAT);
             BINARY_LOOP(results, mp_float_t, uint16_t, int16_t, larray, lstrides, rarray, rstrides, *);
         } else if(rhs->dtype == NDARRAY_FLOAT) {
-            results = ndarray_new_dense_ndarray(ndim, shape, NDARRAY_FLOAT);
+            results = ndarray_new_dense_ndarray_uninitialised(ndim, shape, NDARRAY_FLOAT);
             BINARY_LOOP(results, mp_float_t, uint16_t, mp_float_t, larray, lstrides, rarray, rstrides, *);
         } else {
             return ndarray_binary_op(MP_BINARY_OP_MULTIPLY, MP_OBJ_FROM_PTR(rhs), MP_OBJ_FROM_PTR(lhs));
         }
     } else if(lhs->dtype == NDARRAY_INT16) {
         if(rhs->dtype == NDARRAY_INT16) {
-            results = ndarray_new_dense_ndarray(ndim, shape, NDARRAY_INT16);
+            results = ndarray_new_dense_ndarray_uninitialised(ndim, shape, NDARRAY_INT16);
             BINARY_LOOP(results, int16_t, int16_t, int16_t, larray, lstrides, rarray, rstrides, *);
         } else if(rhs->dtype == NDARRAY_FLOAT) {
-            results = ndarray_new_dense_ndarray(ndim, shape, NDARRAY_FLOAT);
+            results = ndarray_new_dense_ndarray_uninitialised(ndim, shape, NDARRAY_FLOAT);
             BINARY_LOOP(results, mp_float_t, int16_t, mp_float_t, larray, lstrides, rarray, rstrides, *);
         } else {
             return ndarray_binary_op(MP_BINARY_OP_MULTIPLY, MP_OBJ_FROM_PTR(rhs), MP_OBJ_FROM_PTR(lhs));
         }
     } else if(lhs->dtype == NDARRAY_FLOAT) {
         if(rhs->dtype == NDARRAY_FLOAT) {
-            results = ndarray_new_dense_ndarray(ndim, shape, NDARRAY_FLOAT);
+            results = ndarray_new_dense_ndarray_uninitialised(ndim, shape, NDARRAY_FLOAT);
             BINARY_LOOP(results, mp_float_t, mp_float_t, mp_float_t, larray, lstrides, rarray, rstrides, *);
         } else {
             return ndarray_binary_op(MP_BINARY_OP_MULTIPLY, MP_OBJ_FROM_PTR(rhs), MP_OBJ_FROM_PTR(lhs));
@@ -591,87 +595,87 @@ mp_obj_t ndarray_binary_subtract(ndarray_obj_t *lhs, ndarray_obj_t *rhs,
 
     if(lhs->dtype == NDARRAY_UINT8) {
         if(rhs->dtype == NDARRAY_UINT8) {
-            results = ndarray_new_dense_ndarray(ndim, shape, NDARRAY_UINT8);
+            results = ndarray_new_dense_ndarray_uninitialised(ndim, shape, NDARRAY_UINT8);
             BINARY_LOOP(results, uint8_t, uint8_t, uint8_t, larray, lstrides, rarray, rstrides, -);
         } else if(rhs->dtype == NDARRAY_INT8) {
-            results = ndarray_new_dense_ndarray(ndim, shape, NDARRAY_INT16);
+            results = ndarray_new_dense_ndarray_uninitialised(ndim, shape, NDARRAY_INT16);
             BINARY_LOOP(results, int16_t, uint8_t, int8_t, larray, lstrides, rarray, rstrides, -);
         } else if(rhs->dtype == NDARRAY_UINT16) {
-            results = ndarray_new_dense_ndarray(ndim, shape, NDARRAY_UINT16);
+            results = ndarray_new_dense_ndarray_uninitialised(ndim, shape, NDARRAY_UINT16);
             BINARY_LOOP(results, uint16_t, uint8_t, uint16_t, larray, lstrides, rarray, rstrides, -);
         } else if(rhs->dtype == NDARRAY_INT16) {
-            results = ndarray_new_dense_ndarray(ndim, shape, NDARRAY_INT16);
+            results = ndarray_new_dense_ndarray_uninitialised(ndim, shape, NDARRAY_INT16);
             BINARY_LOOP(results, int16_t, uint8_t, int16_t, larray, lstrides, rarray, rstrides, -);
         } else if(rhs->dtype == NDARRAY_FLOAT) {
-            results = ndarray_new_dense_ndarray(ndim, shape, NDARRAY_FLOAT);
+            results = ndarray_new_dense_ndarray_uninitialised(ndim, shape, NDARRAY_FLOAT);
             BINARY_LOOP(results, mp_float_t, uint8_t, mp_float_t, larray, lstrides, rarray, rstrides, -);
         }
     } else if(lhs->dtype == NDARRAY_INT8) {
         if(rhs->dtype == NDARRAY_UINT8) {
-            results = ndarray_new_dense_ndarray(ndim, shape, NDARRAY_INT16);
+            results = ndarray_new_dense_ndarray_uninitialised(ndim, shape, NDARRAY_INT16);
             BINARY_LOOP(results, int16_t, int8_t, uint8_t, larray, lstrides, rarray, rstrides, -);
         } else if(rhs->dtype == NDARRAY_INT8) {
-            results = ndarray_new_dense_ndarray(ndim, shape, NDARRAY_INT8);
+            results = ndarray_new_dense_ndarray_uninitialised(ndim, shape, NDARRAY_INT8);
             BINARY_LOOP(results, int8_t, int8_t, int8_t, larray, lstrides, rarray, rstrides, -);
         } else if(rhs->dtype == NDARRAY_UINT16) {
-            results = ndarray_new_dense_ndarray(ndim, shape, NDARRAY_INT16);
+            results = ndarray_new_dense_ndarray_uninitialised(ndim, shape, NDARRAY_INT16);
             BINARY_LOOP(results, int16_t, int8_t, uint16_t, larray, lstrides, rarray, rstrides, -);
         } else if(rhs->dtype == NDARRAY_INT16) {
-            results = ndarray_new_dense_ndarray(ndim, shape, NDARRAY_INT16);
+            results = ndarray_new_dense_ndarray_uninitialised(ndim, shape, NDARRAY_INT16);
             BINARY_LOOP(results, int16_t, int8_t, int16_t, larray, lstrides, rarray, rstrides, -);
         } else if(rhs->dtype == NDARRAY_FLOAT) {
-            results = ndarray_new_dense_ndarray(ndim, shape, NDARRAY_FLOAT);
+            results = ndarray_new_dense_ndarray_uninitialised(ndim, shape, NDARRAY_FLOAT);
             BINARY_LOOP(results, mp_float_t, int8_t, mp_float_t, larray, lstrides, rarray, rstrides, -);
         }
     } else if(lhs->dtype == NDARRAY_UINT16) {
         if(rhs->dtype == NDARRAY_UINT8) {
-            results = ndarray_new_dense_ndarray(ndim, shape, NDARRAY_UINT16);
+            results = ndarray_new_dense_ndarray_uninitialised(ndim, shape, NDARRAY_UINT16);
             BINARY_LOOP(results, uint16_t, uint16_t, uint8_t, larray, lstrides, rarray, rstrides, -);
         } else if(rhs->dtype == NDARRAY_INT8) {
-            results = ndarray_new_dense_ndarray(ndim, shape, NDARRAY_UINT16);
+            results = ndarray_new_dense_ndarray_uninitialised(ndim, shape, NDARRAY_UINT16);
             BINARY_LOOP(results, uint16_t, uint16_t, int8_t, larray, lstrides, rarray, rstrides, -);
         } else if(rhs->dtype == NDARRAY_UINT16) {
-            results = ndarray_new_dense_ndarray(ndim, shape, NDARRAY_UINT16);
+            results = ndarray_new_dense_ndarray_uninitialised(ndim, shape, NDARRAY_UINT16);
             BINARY_LOOP(results, uint16_t, uint16_t, uint16_t, larray, lstrides, rarray, rstrides, -);
         } else if(rhs->dtype == NDARRAY_INT16) {
-            results = ndarray_new_dense_ndarray(ndim, shape, NDARRAY_FLOAT);
+            results = ndarray_new_dense_ndarray_uninitialised(ndim, shape, NDARRAY_FLOAT);
             BINARY_LOOP(results, mp_float_t, uint16_t, int16_t, larray, lstrides, rarray, rstrides, -);
         } else if(rhs->dtype == NDARRAY_FLOAT) {
-            results = ndarray_new_dense_ndarray(ndim, shape, NDARRAY_FLOAT);
+            results = ndarray_new_dense_ndarray_uninitialised(ndim, shape, NDARRAY_FLOAT);
             BINARY_LOOP(results, mp_float_t, uint16_t, mp_float_t, larray, lstrides, rarray, rstrides, -);
         }
     } else if(lhs->dtype == NDARRAY_INT16) {
         if(rhs->dtype == NDARRAY_UINT8) {
-            results = ndarray_new_dense_ndarray(ndim, shape, NDARRAY_INT16);
+            results = ndarray_new_dense_ndarray_uninitialised(ndim, shape, NDARRAY_INT16);
             BINARY_LOOP(results, int16_t, int16_t, uint8_t, larray, lstrides, rarray, rstrides, -);
         } else if(rhs->dtype == NDARRAY_INT8) {
-            results = ndarray_new_dense_ndarray(ndim, shape, NDARRAY_INT16);
+            results = ndarray_new_dense_ndarray_uninitialised(ndim, shape, NDARRAY_INT16);
             BINARY_LOOP(results, int16_t, int16_t, int8_t, larray, lstrides, rarray, rstrides, -);
         } else if(rhs->dtype == NDARRAY_UINT16) {
-            results = ndarray_new_dense_ndarray(ndim, shape, NDARRAY_FLOAT);
+            results = ndarray_new_dense_ndarray_uninitialised(ndim, shape, NDARRAY_FLOAT);
             BINARY_LOOP(results, mp_float_t, int16_t, uint16_t, larray, lstrides, rarray, rstrides, -);
         } else if(rhs->dtype == NDARRAY_INT16) {
-            results = ndarray_new_dense_ndarray(ndim, shape, NDARRAY_INT16);
+            results = ndarray_new_dense_ndarray_uninitialised(ndim, shape, NDARRAY_INT16);
             BINARY_LOOP(results, int16_t, int16_t, int16_t, larray, lstrides, rarray, rstrides, -);
         } else if(rhs->dtype == NDARRAY_FLOAT) {
-            results = ndarray_new_dense_ndarray(ndim, shape, NDARRAY_FLOAT);
+            results = ndarray_new_dense_ndarray_uninitialised(ndim, shape, NDARRAY_FLOAT);
             BINARY_LOOP(results, mp_float_t, uint16_t, mp_float_t, larray, lstrides, rarray, rstrides, -);
         }
     } else if(lhs->dtype == NDARRAY_FLOAT) {
         if(rhs->dtype == NDARRAY_UINT8) {
-            results = ndarray_new_dense_ndarray(ndim, shape, NDARRAY_FLOAT);
+            results = ndarray_new_dense_ndarray_uninitialised(ndim, shape, NDARRAY_FLOAT);
             BINARY_LOOP(results, mp_float_t, mp_float_t, uint8_t, larray, lstrides, rarray, rstrides, -);
         } else if(rhs->dtype == NDARRAY_INT8) {
-            results = ndarray_new_dense_ndarray(ndim, shape, NDARRAY_FLOAT);
+            results = ndarray_new_dense_ndarray_uninitialised(ndim, shape, NDARRAY_FLOAT);
             BINARY_LOOP(results, mp_float_t, mp_float_t, int8_t, larray, lstrides, rarray, rstrides, -);
         } else if(rhs->dtype == NDARRAY_UINT16) {
-            results = ndarray_new_dense_ndarray(ndim, shape, NDARRAY_FLOAT);
+            results = ndarray_new_dense_ndarray_uninitialised(ndim, shape, NDARRAY_FLOAT);
             BINARY_LOOP(results, mp_float_t, mp_float_t, uint16_t, larray, lstrides, rarray, rstrides, -);
         } else if(rhs->dtype == NDARRAY_INT16) {
-            results = ndarray_new_dense_ndarray(ndim, shape, NDARRAY_FLOAT);
+            results = ndarray_new_dense_ndarray_uninitialised(ndim, shape, NDARRAY_FLOAT);
             BINARY_LOOP(results, mp_float_t, mp_float_t, int16_t, larray, lstrides, rarray, rstrides, -);
         } else if(rhs->dtype == NDARRAY_FLOAT) {
-            results = ndarray_new_dense_ndarray(ndim, shape, NDARRAY_FLOAT);
+            results = ndarray_new_dense_ndarray_uninitialised(ndim, shape, NDARRAY_FLOAT);
             BINARY_LOOP(results, mp_float_t, mp_float_t, mp_float_t, larray, lstrides, rarray, rstrides, -);
         }
     }
@@ -690,7 +694,7 @@ mp_obj_t ndarray_binary_true_divide(ndarray_obj_t *lhs, ndarray_obj_t *rhs,
     }
     #endif
 
-    ndarray_obj_t *results = ndarray_new_dense_ndarray(ndim, shape, NDARRAY_FLOAT);
+    ndarray_obj_t *results = ndarray_new_dense_ndarray_uninitialised(ndim, shape, NDARRAY_FLOAT);
     uint8_t *larray = (uint8_t *)lhs->array;
     uint8_t *rarray = (uint8_t *)rhs->array;
 
@@ -782,74 +786,74 @@ mp_obj_t ndarray_binary_floor_divide(ndarray_obj_t *lhs, ndarray_obj_t *rhs,
 
     if(lhs->dtype == NDARRAY_UINT8) {
         if(rhs->dtype == NDARRAY_UINT8) {
-            results = ndarray_new_dense_ndarray(ndim, shape, NDARRAY_UINT8);
+            results = ndarray_new_dense_ndarray_uninitialised(ndim, shape, NDARRAY_UINT8);
             FLOOR_DIVIDE_LOOP_UINT(results, uint8_t, uint8_t, uint8_t, larray, lstrides, rarray, rstrides);
         } else if(rhs->dtype == NDARRAY_INT8) {
-            results = ndarray_new_dense_ndarray(ndim, shape, NDARRAY_INT16);
+            results = ndarray_new_dense_ndarray_uninitialised(ndim, shape, NDARRAY_INT16);
             FLOOR_DIVIDE_LOOP(results, int16_t, uint8_t, int8_t, larray, lstrides, rarray, rstrides);
         } else if(rhs->dtype == NDARRAY_UINT16) {
-            results = ndarray_new_dense_ndarray(ndim, shape, NDARRAY_UINT16);
+            results = ndarray_new_dense_ndarray_uninitialised(ndim, shape, NDARRAY_UINT16);
             FLOOR_DIVIDE_LOOP_UINT(results, uint16_t, uint8_t, uint16_t, larray, lstrides, rarray, rstrides);
         } else if(rhs->dtype == NDARRAY_INT16) {
-            results = ndarray_new_dense_ndarray(ndim, shape, NDARRAY_INT16);
+            results = ndarray_new_dense_ndarray_uninitialised(ndim, shape, NDARRAY_INT16);
             FLOOR_DIVIDE_LOOP(results, int16_t, uint8_t, int16_t, larray, lstrides, rarray, rstrides);
         } else if(rhs->dtype == NDARRAY_FLOAT) {
-            results = ndarray_new_dense_ndarray(ndim, shape, NDARRAY_FLOAT);
+            results = ndarray_new_dense_ndarray_uninitialised(ndim, shape, NDARRAY_FLOAT);
             FLOOR_DIVIDE_LOOP_FLOAT(results, mp_float_t, uint8_t, mp_float_t, larray, lstrides, rarray, rstrides);
         }
     } else if(lhs->dtype == NDARRAY_INT8) {
         if(rhs->dtype == NDARRAY_UINT8) {
-            results = ndarray_new_dense_ndarray(ndim, shape, NDARRAY_INT16);
+            results = ndarray_new_dense_ndarray_uninitialised(ndim, shape, NDARRAY_INT16);
             FLOOR_DIVIDE_LOOP(results, int16_t, int8_t, uint8_t, larray, lstrides, rarray, rstrides);
         } else if(rhs->dtype == NDARRAY_INT8) {
-            results = ndarray_new_dense_ndarray(ndim, shape, NDARRAY_INT8);
+            results = ndarray_new_dense_ndarray_uninitialised(ndim, shape, NDARRAY_INT8);
             FLOOR_DIVIDE_LOOP(results, int8_t, int8_t, int8_t, larray, lstrides, rarray, rstrides);
         } else if(rhs->dtype == NDARRAY_UINT16) {
-            results = ndarray_new_dense_ndarray(ndim, shape, NDARRAY_UINT16);
+            results = ndarray_new_dense_ndarray_uninitialised(ndim, shape, NDARRAY_UINT16);
             FLOOR_DIVIDE_LOOP(results, uint16_t, int8_t, uint16_t, larray, lstrides, rarray, rstrides);
         } else if(rhs->dtype == NDARRAY_INT16) {
-            results = ndarray_new_dense_ndarray(ndim, shape, NDARRAY_INT16);
+            results = ndarray_new_dense_ndarray_uninitialised(ndim, shape, NDARRAY_INT16);
             FLOOR_DIVIDE_LOOP(results, int16_t, int8_t, int16_t, larray, lstrides, rarray, rstrides);
         } else if(rhs->dtype == NDARRAY_FLOAT) {
-            results = ndarray_new_dense_ndarray(ndim, shape, NDARRAY_FLOAT);
+            results = ndarray_new_dense_ndarray_uninitialised(ndim, shape, NDARRAY_FLOAT);
             FLOOR_DIVIDE_LOOP_FLOAT(results, mp_float_t, int8_t, mp_float_t, larray, lstrides, rarray, rstrides);
         }
     } else if(lhs->dtype == NDARRAY_UINT16) {
         if(rhs->dtype == NDARRAY_UINT8) {
-            results = ndarray_new_dense_ndarray(ndim, shape, NDARRAY_UINT16);
+            results = ndarray_new_dense_ndarray_uninitialised(ndim, shape, NDARRAY_UINT16);
             FLOOR_DIVIDE_LOOP_UINT(results, uint16_t, uint16_t, uint8_t, larray, lstrides, rarray, rstrides);
         } else if(rhs->dtype == NDARRAY_INT8) {
-            results = ndarray_new_dense_ndarray(ndim, shape, NDARRAY_UINT16);
+            results = ndarray_new_dense_ndarray_uninitialised(ndim, shape, NDARRAY_UINT16);
             FLOOR_DIVIDE_LOOP(results, uint16_t, uint16_t, int8_t, larray, lstrides, rarray, rstrides);
         } else if(rhs->dtype == NDARRAY_UINT16) {
-            results = ndarray_new_dense_ndarray(ndim, shape, NDARRAY_UINT16);
+            results = ndarray_new_dense_ndarray_uninitialised(ndim, shape, NDARRAY_UINT16);
             FLOOR_DIVIDE_LOOP_UINT(results, uint16_t, uint16_t, uint16_t, larray, lstrides, rarray, rstrides);
         } else if(rhs->dtype == NDARRAY_INT16) {
-            results = ndarray_new_dense_ndarray(ndim, shape, NDARRAY_FLOAT);
+            results = ndarray_new_dense_ndarray_uninitialised(ndim, shape, NDARRAY_FLOAT);
             FLOOR_DIVIDE_LOOP_FLOAT(results, mp_float_t, uint16_t, int16_t, larray, lstrides, rarray, rstrides);
         } else if(rhs->dtype == NDARRAY_FLOAT) {
-            results = ndarray_new_dense_ndarray(ndim, shape, NDARRAY_FLOAT);
+            results = ndarray_new_dense_ndarray_uninitialised(ndim, shape, NDARRAY_FLOAT);
             FLOOR_DIVIDE_LOOP_FLOAT(results, mp_float_t, uint16_t, mp_float_t, larray, lstrides, rarray, rstrides);
         }
     } else if(lhs->dtype == NDARRAY_INT16) {
         if(rhs->dtype == NDARRAY_UINT8) {
-            results = ndarray_new_dense_ndarray(ndim, shape, NDARRAY_INT16);
+            results = ndarray_new_dense_ndarray_uninitialised(ndim, shape, NDARRAY_INT16);
             FLOOR_DIVIDE_LOOP(results, int16_t, int16_t, uint8_t, larray, lstrides, rarray, rstrides);
         } else if(rhs->dtype == NDARRAY_INT8) {
-            results = ndarray_new_dense_ndarray(ndim, shape, NDARRAY_INT16);
+            results = ndarray_new_dense_ndarray_uninitialised(ndim, shape, NDARRAY_INT16);
             FLOOR_DIVIDE_LOOP(results, int16_t, int16_t, int8_t, larray, lstrides, rarray, rstrides);
         } else if(rhs->dtype == NDARRAY_UINT16) {
-            results = ndarray_new_dense_ndarray(ndim, shape, NDARRAY_FLOAT);
+            results = ndarray_new_dense_ndarray_uninitialised(ndim, shape, NDARRAY_FLOAT);
             FLOOR_DIVIDE_LOOP_FLOAT(results, mp_float_t, int16_t, uint16_t, larray, lstrides, rarray, rstrides);
         } else if(rhs->dtype == NDARRAY_INT16) {
-            results = ndarray_new_dense_ndarray(ndim, shape, NDARRAY_INT16);
+            results = ndarray_new_dense_ndarray_uninitialised(ndim, shape, NDARRAY_INT16);
             FLOOR_DIVIDE_LOOP(results, int16_t, int16_t, int16_t, larray, lstrides, rarray, rstrides);
         } else if(rhs->dtype == NDARRAY_FLOAT) {
-            results = ndarray_new_dense_ndarray(ndim, shape, NDARRAY_FLOAT);
+            results = ndarray_new_dense_ndarray_uninitialised(ndim, shape, NDARRAY_FLOAT);
             FLOOR_DIVIDE_LOOP_FLOAT(results, mp_float_t, uint16_t, mp_float_t, larray, lstrides, rarray, rstrides);
         }
     } else if(lhs->dtype == NDARRAY_FLOAT) {
-        results = ndarray_new_dense_ndarray(ndim, shape, NDARRAY_FLOAT);
+        results = ndarray_new_dense_ndarray_uninitialised(ndim, shape, NDARRAY_FLOAT);
         if(rhs->dtype == NDARRAY_UINT8) {
             FLOOR_DIVIDE_LOOP_FLOAT(results, mp_float_t, mp_float_t, uint8_t, larray, lstrides, rarray, rstrides);
         } else if(rhs->dtype == NDARRAY_INT8) {
@@ -874,7 +878,7 @@ mp_obj_t ndarray_binary_power(ndarray_obj_t *lhs, ndarray_obj_t *rhs,
 
     // Note that numpy upcasts the results to int64, if the inputs are of integer type,
     // while we always return a float array.
-    ndarray_obj_t *results = ndarray_new_dense_ndarray(ndim, shape, NDARRAY_FLOAT);
+    ndarray_obj_t *results = ndarray_new_dense_ndarray_uninitialised(ndim, shape, NDARRAY_FLOAT);
     uint8_t *larray = (uint8_t *)lhs->array;
     uint8_t *rarray = (uint8_t *)rhs->array;
 
@@ -986,47 +990,47 @@ mp_obj_t ndarray_binary_logical(ndarray_obj_t *lhs, ndarray_obj_t *rhs,
         case MP_BINARY_OP_XOR:
             if(lhs->dtype == NDARRAY_UINT8) {
                 if(rhs->dtype == NDARRAY_UINT8) {
-                    results = ndarray_new_dense_ndarray(ndim, shape, NDARRAY_UINT8);
+                    results = ndarray_new_dense_ndarray_uninitialised(ndim, shape, NDARRAY_UINT8);
                     if(lhs->boolean & rhs->boolean) {
                         results->boolean = 1;
                     }
                     BINARY_LOOP(results, uint8_t, uint8_t, uint8_t, larray, lstrides, rarray, rstrides, ^);
                 } else if(rhs->dtype == NDARRAY_INT8) {
-                    results = ndarray_new_dense_ndarray(ndim, shape, NDARRAY_INT16);
+                    results = ndarray_new_dense_ndarray_uninitialised(ndim, shape, NDARRAY_INT16);
                     BINARY_LOOP(results, int16_t, uint8_t, int8_t, larray, lstrides, rarray, rstrides, ^);
                 } else if(rhs->dtype == NDARRAY_UINT16) {
-                    results = ndarray_new_dense_ndarray(ndim, shape, NDARRAY_UINT16);
+                    results = ndarray_new_dense_ndarray_uninitialised(ndim, shape, NDARRAY_UINT16);
                     BINARY_LOOP(results, uint16_t, uint8_t, uint16_t, larray, lstrides, rarray, rstrides, ^);
                 } else if(rhs->dtype == NDARRAY_INT16) {
-                    results = ndarray_new_dense_ndarray(ndim, shape, NDARRAY_INT16);
+                    results = ndarray_new_dense_ndarray_uninitialised(ndim, shape, NDARRAY_INT16);
                     BINARY_LOOP(results, int16_t, uint8_t, int16_t, larray, lstrides, rarray, rstrides, ^);
                 }
             } else if(lhs->dtype == NDARRAY_INT8) {
                 if(rhs->dtype == NDARRAY_INT8) {
-                    results = ndarray_new_dense_ndarray(ndim, shape, NDARRAY_INT8);
+                    results = ndarray_new_dense_ndarray_uninitialised(ndim, shape, NDARRAY_INT8);
                     BINARY_LOOP(results, int8_t, int8_t, int8_t, larray, lstrides, rarray, rstrides, ^);
                 } else if(rhs->dtype == NDARRAY_UINT16) {
-                    results = ndarray_new_dense_ndarray(ndim, shape, NDARRAY_INT16);
+                    results = ndarray_new_dense_ndarray_uninitialised(ndim, shape, NDARRAY_INT16);
                     BINARY_LOOP(results, int16_t, int8_t, uint16_t, larray, lstrides, rarray, rstrides, ^);
                 } else if(rhs->dtype == NDARRAY_INT16) {
-                    results = ndarray_new_dense_ndarray(ndim, shape, NDARRAY_INT16);
+                    results = ndarray_new_dense_ndarray_uninitialised(ndim, shape, NDARRAY_INT16);
                     BINARY_LOOP(results, int16_t, int8_t, int16_t, larray, lstrides, rarray, rstrides, ^);
                 } else {
                     return ndarray_binary_op(MP_BINARY_OP_XOR, MP_OBJ_FROM_PTR(rhs), MP_OBJ_FROM_PTR(lhs));
                 }
             } else if(lhs->dtype == NDARRAY_UINT16) {
                 if(rhs->dtype == NDARRAY_UINT16) {
-                    results = ndarray_new_dense_ndarray(ndim, shape, NDARRAY_UINT16);
+                    results = ndarray_new_dense_ndarray_uninitialised(ndim, shape, NDARRAY_UINT16);
                     BINARY_LOOP(results, uint16_t, uint16_t, uint16_t, larray, lstrides, rarray, rstrides, ^);
                 } else if(rhs->dtype == NDARRAY_INT16) {
-                    results = ndarray_new_dense_ndarray(ndim, shape, NDARRAY_FLOAT);
+                    results = ndarray_new_dense_ndarray_uninitialised(ndim, shape, NDARRAY_FLOAT);
                     BINARY_LOOP(results, mp_float_t, uint16_t, int16_t, larray, lstrides, rarray, rstrides, ^);
                 } else {
                     return ndarray_binary_op(MP_BINARY_OP_XOR, MP_OBJ_FROM_PTR(rhs), MP_OBJ_FROM_PTR(lhs));
                 }
             } else if(lhs->dtype == NDARRAY_INT16) {
                 if(rhs->dtype == NDARRAY_INT16) {
-                    results = ndarray_new_dense_ndarray(ndim, shape, NDARRAY_INT16);
+                    results = ndarray_new_dense_ndarray_uninitialised(ndim, shape, NDARRAY_INT16);
                     BINARY_LOOP(results, int16_t, int16_t, int16_t, larray, lstrides, rarray, rstrides, ^);
                 } else {
                     return ndarray_binary_op(MP_BINARY_OP_XOR, MP_OBJ_FROM_PTR(rhs), MP_OBJ_FROM_PTR(lhs));
@@ -1037,47 +1041,47 @@ mp_obj_t ndarray_binary_logical(ndarray_obj_t *lhs, ndarray_obj_t *rhs,
         case MP_BINARY_OP_OR:
             if(lhs->dtype == NDARRAY_UINT8) {
                 if(rhs->dtype == NDARRAY_UINT8) {
-                    results = ndarray_new_dense_ndarray(ndim, shape, NDARRAY_UINT8);
+                    results = ndarray_new_dense_ndarray_uninitialised(ndim, shape, NDARRAY_UINT8);
                     if(lhs->boolean & rhs->boolean) {
                         results->boolean = 1;
                     }
                     BINARY_LOOP(results, uint8_t, uint8_t, uint8_t, larray, lstrides, rarray, rstrides, |);
                 } else if(rhs->dtype == NDARRAY_INT8) {
-                    results = ndarray_new_dense_ndarray(ndim, shape, NDARRAY_INT16);
+                    results = ndarray_new_dense_ndarray_uninitialised(ndim, shape, NDARRAY_INT16);
                     BINARY_LOOP(results, int16_t, uint8_t, int8_t, larray, lstrides, rarray, rstrides, |);
                 } else if(rhs->dtype == NDARRAY_UINT16) {
-                    results = ndarray_new_dense_ndarray(ndim, shape, NDARRAY_UINT16);
+                    results = ndarray_new_dense_ndarray_uninitialised(ndim, shape, NDARRAY_UINT16);
                     BINARY_LOOP(results, uint16_t, uint8_t, uint16_t, larray, lstrides, rarray, rstrides, |);
                 } else if(rhs->dtype == NDARRAY_INT16) {
-                    results = ndarray_new_dense_ndarray(ndim, shape, NDARRAY_INT16);
+                    results = ndarray_new_dense_ndarray_uninitialised(ndim, shape, NDARRAY_INT16);
                     BINARY_LOOP(results, int16_t, uint8_t, int16_t, larray, lstrides, rarray, rstrides, |);
                 }
             } else if(lhs->dtype == NDARRAY_INT8) {
                 if(rhs->dtype == NDARRAY_INT8) {
-                    results = ndarray_new_dense_ndarray(ndim, shape, NDARRAY_INT8);
+                    results = ndarray_new_dense_ndarray_uninitialised(ndim, shape, NDARRAY_INT8);
                     BINARY_LOOP(results, int8_t, int8_t, int8_t, larray, lstrides, rarray, rstrides, |);
                 } else if(rhs->dtype == NDARRAY_UINT16) {
-                    results = ndarray_new_dense_ndarray(ndim, shape, NDARRAY_INT16);
+                    results = ndarray_new_dense_ndarray_uninitialised(ndim, shape, NDARRAY_INT16);
                     BINARY_LOOP(results, int16_t, int8_t, uint16_t, larray, lstrides, rarray, rstrides, |);
                 } else if(rhs->dtype == NDARRAY_INT16) {
-                    results = ndarray_new_dense_ndarray(ndim, shape, NDARRAY_INT16);
+                    results = ndarray_new_dense_ndarray_uninitialised(ndim, shape, NDARRAY_INT16);
                     BINARY_LOOP(results, int16_t, int8_t, int16_t, larray, lstrides, rarray, rstrides, |);
                 } else {
                     return ndarray_binary_op(MP_BINARY_OP_OR, MP_OBJ_FROM_PTR(rhs), MP_OBJ_FROM_PTR(lhs));
                 }
             } else if(lhs->dtype == NDARRAY_UINT16) {
                 if(rhs->dtype == NDARRAY_UINT16) {
-                    results = ndarray_new_dense_ndarray(ndim, shape, NDARRAY_UINT16);
+                    results = ndarray_new_dense_ndarray_uninitialised(ndim, shape, NDARRAY_UINT16);
                     BINARY_LOOP(results, uint16_t, uint16_t, uint16_t, larray, lstrides, rarray, rstrides, |);
                 } else if(rhs->dtype == NDARRAY_INT16) {
-                    results = ndarray_new_dense_ndarray(ndim, shape, NDARRAY_FLOAT);
+                    results = ndarray_new_dense_ndarray_uninitialised(ndim, shape, NDARRAY_FLOAT);
                     BINARY_LOOP(results, mp_float_t, uint16_t, int16_t, larray, lstrides, rarray, rstrides, |);
                 } else {
                     return ndarray_binary_op(MP_BINARY_OP_OR, MP_OBJ_FROM_PTR(rhs), MP_OBJ_FROM_PTR(lhs));
                 }
             } else if(lhs->dtype == NDARRAY_INT16) {
                 if(rhs->dtype == NDARRAY_INT16) {
-                    results = ndarray_new_dense_ndarray(ndim, shape, NDARRAY_INT16);
+                    results = ndarray_new_dense_ndarray_uninitialised(ndim, shape, NDARRAY_INT16);
                     BINARY_LOOP(results, int16_t, int16_t, int16_t, larray, lstrides, rarray, rstrides, |);
                 } else {
                     return ndarray_binary_op(MP_BINARY_OP_OR, MP_OBJ_FROM_PTR(rhs), MP_OBJ_FROM_PTR(lhs));
@@ -1088,47 +1092,47 @@ mp_obj_t ndarray_binary_logical(ndarray_obj_t *lhs, ndarray_obj_t *rhs,
             case MP_BINARY_OP_AND:
             if(lhs->dtype == NDARRAY_UINT8) {
                 if(rhs->dtype == NDARRAY_UINT8) {
-                    results = ndarray_new_dense_ndarray(ndim, shape, NDARRAY_UINT8);
+                    results = ndarray_new_dense_ndarray_uninitialised(ndim, shape, NDARRAY_UINT8);
                     if(lhs->boolean & rhs->boolean) {
                         results->boolean = 1;
                     }
                     BINARY_LOOP(results, uint8_t, uint8_t, uint8_t, larray, lstrides, rarray, rstrides, &);
                 } else if(rhs->dtype == NDARRAY_INT8) {
-                    results = ndarray_new_dense_ndarray(ndim, shape, NDARRAY_INT16);
+                    results = ndarray_new_dense_ndarray_uninitialised(ndim, shape, NDARRAY_INT16);
                     BINARY_LOOP(results, int16_t, uint8_t, int8_t, larray, lstrides, rarray, rstrides, &);
                 } else if(rhs->dtype == NDARRAY_UINT16) {
-                    results = ndarray_new_dense_ndarray(ndim, shape, NDARRAY_UINT16);
+                    results = ndarray_new_dense_ndarray_uninitialised(ndim, shape, NDARRAY_UINT16);
                     BINARY_LOOP(results, uint16_t, uint8_t, uint16_t, larray, lstrides, rarray, rstrides, &);
                 } else if(rhs->dtype == NDARRAY_INT16) {
-                    results = ndarray_new_dense_ndarray(ndim, shape, NDARRAY_INT16);
+                    results = ndarray_new_dense_ndarray_uninitialised(ndim, shape, NDARRAY_INT16);
                     BINARY_LOOP(results, int16_t, uint8_t, int16_t, larray, lstrides, rarray, rstrides, &);
                 }
             } else if(lhs->dtype == NDARRAY_INT8) {
                 if(rhs->dtype == NDARRAY_INT8) {
-                    results = ndarray_new_dense_ndarray(ndim, shape, NDARRAY_INT8);
+                    results = ndarray_new_dense_ndarray_uninitialised(ndim, shape, NDARRAY_INT8);
                     BINARY_LOOP(results, int8_t, int8_t, int8_t, larray, lstrides, rarray, rstrides, &);
                 } else if(rhs->dtype == NDARRAY_UINT16) {
-                    results = ndarray_new_dense_ndarray(ndim, shape, NDARRAY_INT16);
+                    results = ndarray_new_dense_ndarray_uninitialised(ndim, shape, NDARRAY_INT16);
                     BINARY_LOOP(results, int16_t, int8_t, uint16_t, larray, lstrides, rarray, rstrides, &);
                 } else if(rhs->dtype == NDARRAY_INT16) {
-                    results = ndarray_new_dense_ndarray(ndim, shape, NDARRAY_INT16);
+                    results = ndarray_new_dense_ndarray_uninitialised(ndim, shape, NDARRAY_INT16);
                     BINARY_LOOP(results, int16_t, int8_t, int16_t, larray, lstrides, rarray, rstrides, &);
                 } else {
                     return ndarray_binary_op(MP_BINARY_OP_AND, MP_OBJ_FROM_PTR(rhs), MP_OBJ_FROM_PTR(lhs));
                 }
             } else if(lhs->dtype == NDARRAY_UINT16) {
                 if(rhs->dtype == NDARRAY_UINT16) {
-                    results = ndarray_new_dense_ndarray(ndim, shape, NDARRAY_UINT16);
+                    results = ndarray_new_dense_ndarray_uninitialised(ndim, shape, NDARRAY_UINT16);
                     BINARY_LOOP(results, uint16_t, uint16_t, uint16_t, larray, lstrides, rarray, rstrides, &);
                 } else if(rhs->dtype == NDARRAY_INT16) {
-                    results = ndarray_new_dense_ndarray(ndim, shape, NDARRAY_FLOAT);
+                    results = ndarray_new_dense_ndarray_uninitialised(ndim, shape, NDARRAY_FLOAT);
                     BINARY_LOOP(results, mp_float_t, uint16_t, int16_t, larray, lstrides, rarray, rstrides, &);
                 } else {
                     return ndarray_binary_op(MP_BINARY_OP_AND, MP_OBJ_FROM_PTR(rhs), MP_OBJ_FROM_PTR(lhs));
                 }
             } else if(lhs->dtype == NDARRAY_INT16) {
                 if(rhs->dtype == NDARRAY_INT16) {
-                    results = ndarray_new_dense_ndarray(ndim, shape, NDARRAY_INT16);
+                    results = ndarray_new_dense_ndarray_uninitialised(ndim, shape, NDARRAY_INT16);
                     BINARY_LOOP(results, int16_t, int16_t, int16_t, larray, lstrides, rarray, rstrides, &);
                 } else {
                     return ndarray_binary_op(MP_BINARY_OP_AND, MP_OBJ_FROM_PTR(rhs), MP_OBJ_FROM_PTR(lhs));
@@ -1286,3 +1290,380 @@ mp_obj_t ndarray_inplace_power(ndarray_obj_t *lhs, ndarray_obj_t *rhs, int32_t *
     return MP_OBJ_FROM_PTR(lhs);
 }
 #endif /* NDARRAY_HAS_INPLACE_POWER */
+
+#if ULAB_HAS_INT32
+// The 32-bit integer types are not woven into the type tables above. Instead, the operands are
+// first brought to a common type (int32, uint32, or float, as dictated by ndarray_upcast_dtype),
+// and the operation is carried out either by the float kernels above, or on two operands of the
+// same 32-bit type below. In this way, the most frequent case, an operation on two arrays of the
+// same type, or an array and a scalar, runs at full speed, while the code size remains moderate.
+
+#define INT32_CAST_LOOP(type_out, type_in, ndarray, source, sarray)\
+({\
+    type_out *array = (type_out *)(ndarray)->array;\
+    ITERATOR_HEAD()\
+        *array++ = (type_out)*((type_in *)(sarray));\
+    ITERATOR_TAIL((source), (sarray));\
+})
+
+ndarray_obj_t *ndarray_int32_cast(ndarray_obj_t *source, uint8_t dtype) {
+    // returns a dense copy of an integer array, converted to either int32, uint32, or float
+    ndarray_obj_t *ndarray = ndarray_new_dense_ndarray_uninitialised(source->ndim, source->shape, dtype);
+    uint8_t *sarray = (uint8_t *)source->array;
+
+    if(dtype == NDARRAY_FLOAT) {
+        mp_float_t (*func)(void *) = ndarray_get_float_function(source->dtype);
+        mp_float_t *array = (mp_float_t *)ndarray->array;
+        ITERATOR_HEAD()
+            *array++ = func(sarray);
+        ITERATOR_TAIL(source, sarray);
+    } else if(dtype == NDARRAY_INT32) {
+        if(source->dtype == NDARRAY_UINT8) {
+            INT32_CAST_LOOP(int32_t, uint8_t, ndarray, source, sarray);
+        } else if(source->dtype == NDARRAY_INT8) {
+            INT32_CAST_LOOP(int32_t, int8_t, ndarray, source, sarray);
+        } else if(source->dtype == NDARRAY_UINT16) {
+            INT32_CAST_LOOP(int32_t, uint16_t, ndarray, source, sarray);
+        } else if(source->dtype == NDARRAY_INT16) {
+            INT32_CAST_LOOP(int32_t, int16_t, ndarray, source, sarray);
+        } else { // int32, or uint32
+            INT32_CAST_LOOP(int32_t, int32_t, ndarray, source, sarray);
+        }
+    } else { // NDARRAY_UINT32
+        if(source->dtype == NDARRAY_UINT8) {
+            INT32_CAST_LOOP(uint32_t, uint8_t, ndarray, source, sarray);
+        } else if(source->dtype == NDARRAY_INT8) {
+            INT32_CAST_LOOP(uint32_t, int8_t, ndarray, source, sarray);
+        } else if(source->dtype == NDARRAY_UINT16) {
+            INT32_CAST_LOOP(uint32_t, uint16_t, ndarray, source, sarray);
+        } else if(source->dtype == NDARRAY_INT16) {
+            INT32_CAST_LOOP(uint32_t, int16_t, ndarray, source, sarray);
+        } else { // int32, or uint32
+            INT32_CAST_LOOP(uint32_t, uint32_t, ndarray, source, sarray);
+        }
+    }
+    return ndarray;
+}
+
+static int32_t ndarray_int32_floor_divide_value(int32_t num, int32_t denom) {
+    // python's floor division; division by zero yields 0, instead of a hard fault
+    if(denom == 0) {
+        return 0;
+    } else if(denom == -1) {
+        // avoid the overflow of INT32_MIN / -1
+        return (int32_t)(0U - (uint32_t)num);
+    }
+    int32_t quotient = num / denom;
+    if(((num % denom) != 0) && ((num < 0) != (denom < 0))) {
+        quotient--;
+    }
+    return quotient;
+}
+
+static int32_t ndarray_int32_modulo_value(int32_t num, int32_t denom) {
+    // the remainder is 0 for a zero denominator, as in the floor division, and for -1,
+    // where INT32_MIN % -1 would overflow
+    if((denom == 0) || (denom == -1)) {
+        return 0;
+    }
+    return num % denom;
+}
+
+static void ndarray_int32_divide(ndarray_obj_t *results, uint8_t *larray, int32_t *lstrides, uint8_t *rarray, int32_t *rstrides, mp_binary_op_t op) {
+    // floor division, and modulo with the same guards against invalid denominators
+    uint8_t *array = (uint8_t *)results->array;
+    bool is_signed = results->dtype == NDARRAY_INT32;
+    bool modulo = (op == MP_BINARY_OP_MODULO) || (op == MP_BINARY_OP_INPLACE_MODULO);
+
+    #if ULAB_MAX_DIMS > 3
+    size_t i = 0;
+    do {
+    #endif
+        #if ULAB_MAX_DIMS > 2
+        size_t j = 0;
+        do {
+        #endif
+            #if ULAB_MAX_DIMS > 1
+            size_t k = 0;
+            do {
+            #endif
+                size_t l = 0;
+                do {
+                    if(is_signed) {
+                        int32_t num = *((int32_t *)larray);
+                        int32_t denom = *((int32_t *)rarray);
+                        *((int32_t *)array) = modulo ? ndarray_int32_modulo_value(num, denom) : ndarray_int32_floor_divide_value(num, denom);
+                    } else {
+                        uint32_t num = *((uint32_t *)larray);
+                        uint32_t denom = *((uint32_t *)rarray);
+                        *((uint32_t *)array) = denom == 0 ? 0 : (modulo ? num % denom : num / denom);
+                    }
+                    array += results->itemsize;
+                    larray += lstrides[ULAB_MAX_DIMS - 1];
+                    rarray += rstrides[ULAB_MAX_DIMS - 1];
+                    l++;
+                } while(l < results->shape[ULAB_MAX_DIMS - 1]);
+            #if ULAB_MAX_DIMS > 1
+                larray -= lstrides[ULAB_MAX_DIMS - 1] * results->shape[ULAB_MAX_DIMS - 1];
+                larray += lstrides[ULAB_MAX_DIMS - 2];
+                rarray -= rstrides[ULAB_MAX_DIMS - 1] * results->shape[ULAB_MAX_DIMS - 1];
+                rarray += rstrides[ULAB_MAX_DIMS - 2];
+                k++;
+            } while(k < results->shape[ULAB_MAX_DIMS - 2]);
+            #endif
+        #if ULAB_MAX_DIMS > 2
+            larray -= lstrides[ULAB_MAX_DIMS - 2] * results->shape[ULAB_MAX_DIMS - 2];
+            larray += lstrides[ULAB_MAX_DIMS - 3];
+            rarray -= rstrides[ULAB_MAX_DIMS - 2] * results->shape[ULAB_MAX_DIMS - 2];
+            rarray += rstrides[ULAB_MAX_DIMS - 3];
+            j++;
+        } while(j < results->shape[ULAB_MAX_DIMS - 3]);
+        #endif
+    #if ULAB_MAX_DIMS > 3
+        larray -= lstrides[ULAB_MAX_DIMS - 3] * results->shape[ULAB_MAX_DIMS - 3];
+        larray += lstrides[ULAB_MAX_DIMS - 4];
+        rarray -= rstrides[ULAB_MAX_DIMS - 3] * results->shape[ULAB_MAX_DIMS - 3];
+        rarray += rstrides[ULAB_MAX_DIMS - 4];
+        i++;
+    } while(i < results->shape[ULAB_MAX_DIMS - 4]);
+    #endif
+}
+
+static mp_obj_t ndarray_inplace_int32(mp_binary_op_t op, ndarray_obj_t *lhs, ndarray_obj_t *rhs, int32_t *rstrides) {
+    if(lhs->dtype != rhs->dtype) {
+        if(lhs->dtype == NDARRAY_FLOAT) {
+            // the float kernels can take over, once the right hand side is converted
+            return ndarray_binary_op(op, MP_OBJ_FROM_PTR(lhs), MP_OBJ_FROM_PTR(ndarray_int32_cast(rhs, NDARRAY_FLOAT)));
+        }
+        if((rhs->dtype == NDARRAY_FLOAT) || !NDARRAY_IS_INT32(lhs)) {
+            mp_raise_TypeError(MP_ERROR_TEXT("cannot cast output with casting rule"));
+        }
+        return ndarray_binary_op(op, MP_OBJ_FROM_PTR(lhs), MP_OBJ_FROM_PTR(ndarray_int32_cast(rhs, lhs->dtype)));
+    }
+
+    uint8_t *larray = (uint8_t *)lhs->array;
+    uint8_t *rarray = (uint8_t *)rhs->array;
+
+    switch(op) {
+        #if NDARRAY_HAS_INPLACE_ADD
+        case MP_BINARY_OP_INPLACE_ADD:
+            if(lhs->dtype == NDARRAY_INT32) {
+                INPLACE_LOOP(lhs, int32_t, int32_t, larray, rarray, rstrides, +=);
+            } else {
+                INPLACE_LOOP(lhs, uint32_t, uint32_t, larray, rarray, rstrides, +=);
+            }
+            break;
+        #endif
+        #if NDARRAY_HAS_INPLACE_SUBTRACT
+        case MP_BINARY_OP_INPLACE_SUBTRACT:
+            if(lhs->dtype == NDARRAY_INT32) {
+                INPLACE_LOOP(lhs, int32_t, int32_t, larray, rarray, rstrides, -=);
+            } else {
+                INPLACE_LOOP(lhs, uint32_t, uint32_t, larray, rarray, rstrides, -=);
+            }
+            break;
+        #endif
+        #if NDARRAY_HAS_INPLACE_MULTIPLY
+        case MP_BINARY_OP_INPLACE_MULTIPLY:
+            if(lhs->dtype == NDARRAY_INT32) {
+                INPLACE_LOOP(lhs, int32_t, int32_t, larray, rarray, rstrides, *=);
+            } else {
+                INPLACE_LOOP(lhs, uint32_t, uint32_t, larray, rarray, rstrides, *=);
+            }
+            break;
+        #endif
+        #if NDARRAY_HAS_INPLACE_MODULO
+        case MP_BINARY_OP_INPLACE_MODULO: {
+            // the guarded kernel writes a dense array, whose content is then copied back
+            ndarray_obj_t *results = ndarray_new_dense_ndarray_uninitialised(lhs->ndim, lhs->shape, lhs->dtype);
+            ndarray_int32_divide(results, larray, lhs->strides, rarray, rstrides, op);
+            uint8_t *array = (uint8_t *)results->array;
+            ITERATOR_HEAD()
+                memcpy(larray, array, lhs->itemsize);
+                array += lhs->itemsize;
+            ITERATOR_TAIL(lhs, larray)
+            break;
+        }
+        #endif
+        default:
+            // true division, and power always produce floats
+            mp_raise_TypeError(MP_ERROR_TEXT("results cannot be cast to specified type"));
+    }
+    return MP_OBJ_FROM_PTR(lhs);
+}
+
+mp_obj_t ndarray_binary_op_int32(mp_binary_op_t op, ndarray_obj_t *lhs, ndarray_obj_t *rhs,
+                                            uint8_t ndim, size_t *shape, int32_t *lstrides, int32_t *rstrides) {
+
+    #if ULAB_SUPPORTS_COMPLEX
+    if((lhs->dtype == NDARRAY_COMPLEX) || (rhs->dtype == NDARRAY_COMPLEX)) {
+        mp_raise_TypeError(MP_ERROR_TEXT("operation not supported for the input types"));
+    }
+    #endif
+
+    if((op == MP_BINARY_OP_INPLACE_ADD) || (op == MP_BINARY_OP_INPLACE_SUBTRACT) ||
+        (op == MP_BINARY_OP_INPLACE_MULTIPLY) || (op == MP_BINARY_OP_INPLACE_MODULO) ||
+        (op == MP_BINARY_OP_INPLACE_TRUE_DIVIDE) || (op == MP_BINARY_OP_INPLACE_POWER)) {
+        return ndarray_inplace_int32(op, lhs, rhs, rstrides);
+    }
+
+    uint8_t dtype = ndarray_upcast_dtype(lhs->dtype, rhs->dtype);
+    if((lhs->dtype != dtype) || (rhs->dtype != dtype)) {
+        // bring the operands to the common type, and start over; the strides are re-calculated there
+        if(lhs->dtype != dtype) {
+            lhs = ndarray_int32_cast(lhs, dtype);
+        }
+        if(rhs->dtype != dtype) {
+            rhs = ndarray_int32_cast(rhs, dtype);
+        }
+        return ndarray_binary_op(op, MP_OBJ_FROM_PTR(lhs), MP_OBJ_FROM_PTR(rhs));
+    }
+
+    // from this point on, both operands are either int32, or uint32
+    ndarray_obj_t *results = NULL;
+    uint8_t *larray = (uint8_t *)lhs->array;
+    uint8_t *rarray = (uint8_t *)rhs->array;
+
+    switch(op) {
+        case MP_BINARY_OP_ADD:
+        case MP_BINARY_OP_SUBTRACT:
+        case MP_BINARY_OP_MULTIPLY:
+        case MP_BINARY_OP_AND:
+        case MP_BINARY_OP_OR:
+        case MP_BINARY_OP_XOR:
+            results = ndarray_new_dense_ndarray_uninitialised(ndim, shape, dtype);
+            if(dtype == NDARRAY_INT32) {
+                if(op == MP_BINARY_OP_ADD) {
+                    BINARY_LOOP(results, int32_t, int32_t, int32_t, larray, lstrides, rarray, rstrides, +);
+                } else if(op == MP_BINARY_OP_SUBTRACT) {
+                    BINARY_LOOP(results, int32_t, int32_t, int32_t, larray, lstrides, rarray, rstrides, -);
+                } else if(op == MP_BINARY_OP_MULTIPLY) {
+                    BINARY_LOOP(results, int32_t, int32_t, int32_t, larray, lstrides, rarray, rstrides, *);
+                } else if(op == MP_BINARY_OP_AND) {
+                    BINARY_LOOP(results, int32_t, int32_t, int32_t, larray, lstrides, rarray, rstrides, &);
+                } else if(op == MP_BINARY_OP_OR) {
+                    BINARY_LOOP(results, int32_t, int32_t, int32_t, larray, lstrides, rarray, rstrides, |);
+                } else {
+                    BINARY_LOOP(results, int32_t, int32_t, int32_t, larray, lstrides, rarray, rstrides, ^);
+                }
+            } else {
+                if(op == MP_BINARY_OP_ADD) {
+                    BINARY_LOOP(results, uint32_t, uint32_t, uint32_t, larray, lstrides, rarray, rstrides, +);
+                } else if(op == MP_BINARY_OP_SUBTRACT) {
+                    BINARY_LOOP(results, uint32_t, uint32_t, uint32_t, larray, lstrides, rarray, rstrides, -);
+                } else if(op == MP_BINARY_OP_MULTIPLY) {
+                    BINARY_LOOP(results, uint32_t, uint32_t, uint32_t, larray, lstrides, rarray, rstrides, *);
+                } else if(op == MP_BINARY_OP_AND) {
+                    BINARY_LOOP(results, uint32_t, uint32_t, uint32_t, larray, lstrides, rarray, rstrides, &);
+                } else if(op == MP_BINARY_OP_OR) {
+                    BINARY_LOOP(results, uint32_t, uint32_t, uint32_t, larray, lstrides, rarray, rstrides, |);
+                } else {
+                    BINARY_LOOP(results, uint32_t, uint32_t, uint32_t, larray, lstrides, rarray, rstrides, ^);
+                }
+            }
+            break;
+
+        case MP_BINARY_OP_FLOOR_DIVIDE:
+        case MP_BINARY_OP_MODULO:
+            results = ndarray_new_dense_ndarray_uninitialised(ndim, shape, dtype);
+            ndarray_int32_divide(results, larray, lstrides, rarray, rstrides, op);
+            break;
+
+        case MP_BINARY_OP_LESS:
+        case MP_BINARY_OP_LESS_EQUAL:
+            // swap the operands, and the strides
+            SWAP(uint8_t *, larray, rarray);
+            SWAP(int32_t *, lstrides, rstrides);
+            op = op == MP_BINARY_OP_LESS ? MP_BINARY_OP_MORE : MP_BINARY_OP_MORE_EQUAL;
+            // fall through
+        case MP_BINARY_OP_MORE:
+        case MP_BINARY_OP_MORE_EQUAL:
+        case MP_BINARY_OP_EQUAL:
+        case MP_BINARY_OP_NOT_EQUAL: {
+            results = ndarray_new_dense_ndarray_uninitialised(ndim, shape, NDARRAY_UINT8);
+            results->boolean = 1;
+            uint8_t *array = (uint8_t *)results->array;
+            if(dtype == NDARRAY_INT32) {
+                if(op == MP_BINARY_OP_MORE) {
+                    EQUALITY_LOOP(results, array, int32_t, int32_t, larray, lstrides, rarray, rstrides, >);
+                } else if(op == MP_BINARY_OP_MORE_EQUAL) {
+                    EQUALITY_LOOP(results, array, int32_t, int32_t, larray, lstrides, rarray, rstrides, >=);
+                } else if(op == MP_BINARY_OP_EQUAL) {
+                    EQUALITY_LOOP(results, array, int32_t, int32_t, larray, lstrides, rarray, rstrides, ==);
+                } else {
+                    EQUALITY_LOOP(results, array, int32_t, int32_t, larray, lstrides, rarray, rstrides, !=);
+                }
+            } else {
+                if(op == MP_BINARY_OP_MORE) {
+                    EQUALITY_LOOP(results, array, uint32_t, uint32_t, larray, lstrides, rarray, rstrides, >);
+                } else if(op == MP_BINARY_OP_MORE_EQUAL) {
+                    EQUALITY_LOOP(results, array, uint32_t, uint32_t, larray, lstrides, rarray, rstrides, >=);
+                } else if(op == MP_BINARY_OP_EQUAL) {
+                    EQUALITY_LOOP(results, array, uint32_t, uint32_t, larray, lstrides, rarray, rstrides, ==);
+                } else {
+                    EQUALITY_LOOP(results, array, uint32_t, uint32_t, larray, lstrides, rarray, rstrides, !=);
+                }
+            }
+            break;
+        }
+
+        case MP_BINARY_OP_TRUE_DIVIDE:
+        case MP_BINARY_OP_POWER: {
+            results = ndarray_new_dense_ndarray_uninitialised(ndim, shape, NDARRAY_FLOAT);
+            mp_float_t (*get_lhs)(void *) = ndarray_get_float_function(dtype);
+            mp_float_t (*get_rhs)(void *) = ndarray_get_float_function(dtype);
+            void (*set_result)(void *, mp_float_t ) = ndarray_set_float_function(NDARRAY_FLOAT);
+            uint8_t *array = (uint8_t *)results->array;
+            if(op == MP_BINARY_OP_TRUE_DIVIDE) {
+                FUNC_POINTER_LOOP(results, array, get_lhs, get_rhs, larray, lstrides, rarray, rstrides, lvalue/rvalue);
+            } else {
+                FUNC_POINTER_LOOP(results, array, get_lhs, get_rhs, larray, lstrides, rarray, rstrides, MICROPY_FLOAT_C_FUN(pow)(lvalue, rvalue));
+            }
+            break;
+        }
+
+        default:
+            return MP_OBJ_NULL; // op not supported
+    }
+    return MP_OBJ_FROM_PTR(results);
+}
+#endif /* ULAB_HAS_INT32 */
+
+#if ULAB_HAS_FLOAT16
+mp_obj_t ndarray_binary_op_float16(mp_binary_op_t op, ndarray_obj_t *lhs, ndarray_obj_t *rhs) {
+    // float16 is a storage type only: the operands are converted to mp_float_t, the operation is
+    // carried out by the float kernels, and the results of in-place operations are converted back
+    ndarray_obj_t *lfloat = lhs->dtype == NDARRAY_FLOAT16 ? ndarray_copy_view_convert_type(lhs, NDARRAY_FLOAT) : lhs;
+    ndarray_obj_t *rfloat = rhs->dtype == NDARRAY_FLOAT16 ? ndarray_copy_view_convert_type(rhs, NDARRAY_FLOAT) : rhs;
+
+    if((op < MP_BINARY_OP_INPLACE_OR) || (op > MP_BINARY_OP_INPLACE_POWER)) {
+        return ndarray_binary_op(op, MP_OBJ_FROM_PTR(lfloat), MP_OBJ_FROM_PTR(rfloat));
+    }
+    if(lhs->dtype != NDARRAY_FLOAT16) {
+        return ndarray_binary_op(op, MP_OBJ_FROM_PTR(lhs), MP_OBJ_FROM_PTR(rfloat));
+    }
+    if(lhs->len == 0) {
+        return MP_OBJ_FROM_PTR(lhs);
+    }
+
+    // the in-place operators are in the same order as the binary operators, so they can be mapped directly
+    mp_obj_t out = ndarray_binary_op(op - MP_BINARY_OP_INPLACE_OR + MP_BINARY_OP_OR, MP_OBJ_FROM_PTR(lfloat), MP_OBJ_FROM_PTR(rfloat));
+    if(out == MP_OBJ_NULL) {
+        return out;
+    }
+    ndarray_obj_t *results = MP_OBJ_TO_PTR(out);
+    if(results->len != lhs->len) {
+        mp_raise_ValueError(MP_ERROR_TEXT("operands could not be broadcast together"));
+    }
+    mp_float_t (*func)(void *) = ndarray_get_float_function(results->dtype);
+    uint8_t *rarray = (uint8_t *)results->array;
+    uint8_t *larray = (uint8_t *)lhs->array;
+
+    ITERATOR_HEAD()
+        *((uint16_t *)larray) = ulab_float_to_float16(func(rarray));
+        rarray += results->itemsize;
+    ITERATOR_TAIL(lhs, larray);
+
+    return MP_OBJ_FROM_PTR(lhs);
+}
+#endif /* ULAB_HAS_FLOAT16 */
@@ -26,6 +26,15 @@ mp_obj_t ndarray_inplace_modulo(ndarray_obj_t *, ndarray_obj_t *, int32_t *);
 mp_obj_t ndarray_inplace_power(ndarray_obj_t *, ndarray_obj_t *, int32_t *);
 mp_obj_t ndarray_inplace_divide(ndarray_obj_t *, ndarray_obj_t *, int32_t *);
 
+#if ULAB_HAS_FLOAT16
+mp_obj_t ndarray_binary_op_float16(mp_binary_op_t , ndarray_obj_t *, ndarray_obj_t *);
+#endif
+
+#if ULAB_HAS_INT32
+mp_obj_t ndarray_binary_op_int32(mp_binary_op_t , ndarray_obj_t *, ndarray_obj_t *, uint8_t , size_t *, int32_t *, int32_t *);
+ndarray_obj_t *ndarray_int32_cast(ndarray_obj_t *, uint8_t );
+#endif
+
 #define UNWRAP_INPLACE_OPERATOR(lhs, larray, rarray, rstrides, OPERATOR)\
 ({\
     if((lhs)->dtype == NDARRAY_UINT8) {\
@@ -16,6 +16,9 @@
 #include "py/obj.h"
 #include "py/runtime.h"
 
+#include "../ulab_tools.h"
+#include "../ndarray_operators.h"
+#include "carray/carray_tools.h"
 #include "bitwise.h"
 
 
@@ -325,16 +328,276 @@ ndarray_obj_t *bitwise_right_shift_loop(ndarray_obj_t *lhs, ndarray_obj_t *rhs,
 }
 #endif
 
-mp_obj_t *bitwise_binary_operators(mp_obj_t x1, mp_obj_t x2, uint8_t optype) {
-    ndarray_obj_t *lhs = ndarray_from_mp_obj(x1, 0);
-    ndarray_obj_t *rhs = ndarray_from_mp_obj(x2, 0);
+static uint32_t bitwise_subtract_lanes(uint32_t x, uint32_t y, uint32_t high) {
+    // subtracts y from x in each one- or two-byte lane without borrowing from the neighbouring
+    // lane; high holds the most significant bit of every lane
+    return ((x | high) - (y & ~high)) ^ ((x ^ ~y) & high);
+}
+
+static bool bitwise_overlaps(ndarray_obj_t *out, ndarray_obj_t *ndarray) {
+    // an output that is identical to an operand is harmless, because each word is read before
+    // it is written, but a shifted overlap would clobber elements that have not been read yet
+    uint8_t *oarray = (uint8_t *)out->array;
+    uint8_t *array = (uint8_t *)ndarray->array;
+    return (oarray != array) && (oarray < array + ndarray->len * ndarray->itemsize) &&
+            (array < oarray + out->len * out->itemsize);
+}
+
+static ndarray_obj_t *bitwise_binary_dense(ndarray_obj_t *lhs, ndarray_obj_t *rhs, uint8_t ndim, size_t *shape, uint8_t optype, mp_obj_t out) {
+    // Dense one- and two-byte integer arrays are processed a 32-bit word at a time, if the other
+    // operand is either a dense array of the same type, or a single value. NULL is returned, if
+    // the operands are not suitable, and then the caller falls back to the broadcasting loops.
+    size_t len = 1;
+    for(uint8_t i = ULAB_MAX_DIMS - ndim; i < ULAB_MAX_DIMS; i++) {
+        len *= shape[i];
+    }
+    if((optype < BITWISE_LEFT_SHIFT) && (lhs->len == 1) && (rhs->len == len)) {
+        // AND, OR, and XOR are commutative, so the array can always be on the left hand side
+        ndarray_obj_t *tmp = lhs;
+        lhs = rhs;
+        rhs = tmp;
+    }
+    if((len == 0) || (lhs->len != len) || (lhs->itemsize > 2) || NDARRAY_IS_FLOATING(lhs->dtype) ||
+        !ndarray_is_contiguous(lhs)) {
+        return NULL;
+    }
+    bool scalar = (rhs->len == 1) && (len > 1);
+    if(scalar) {
+        // a scalar must not change the type of the result
+        if((rhs->dtype != lhs->dtype) && !((lhs->itemsize == 2) && (rhs->dtype == NDARRAY_UINT8))) {
+            return NULL;
+        }
+    } else if((rhs->dtype != lhs->dtype) || (rhs->len != len) || !ndarray_is_contiguous(rhs)) {
+        return NULL;
+    }
+
+    int32_t count = 0;
+    if(scalar && (optype >= BITWISE_LEFT_SHIFT)) {
+        count = (int32_t)ndarray_get_float_value(rhs->array, rhs->dtype);
+        if(count < 0) {
+            // the result of negative shifts is left to the generic loops
+            return NULL;
+        }
+    }
+
+    ndarray_obj_t *results;
+    if(out == mp_const_none) {
+        results = ndarray_new_dense_ndarray_uninitialised(ndim, shape, lhs->dtype);
+    } else {
+        results = ulab_tools_inspect_out(out, lhs->dtype, ndim, shape, false);
+        if(!ndarray_is_contiguous(results) || bitwise_overlaps(results, lhs) || (!scalar && bitwise_overlaps(results, rhs))) {
+            return NULL;
+        }
+    }
+
+    uint8_t *larray = (uint8_t *)lhs->array;
+    uint8_t *rarray = (uint8_t *)rhs->array;
+    uint8_t *array = (uint8_t *)results->array;
+    size_t nbytes = len * lhs->itemsize;
+    uint8_t bstep = 4;
+
+    // lane constants: the most significant bit of each lane, and a lane filled with ones
+    uint32_t high = lhs->itemsize == 1 ? 0x80808080 : 0x80008000;
+    uint32_t ones = lhs->itemsize == 1 ? 0x01010101 : 0x00010001;
+    uint32_t lane = lhs->itemsize == 1 ? 0xFF : 0xFFFF;
+    uint8_t bits = lhs->itemsize * 8;
+    uint32_t word = 0;
+
+    if(scalar) {
+        // the single value is replicated over a word; all lanes are equal, so the result does
+        // not depend on the byte order
+        uint16_t item = *rarray;
+        if(rhs->itemsize == 2) {
+            memcpy(&item, rarray, 2);
+        }
+        word = item * ones;
+        rarray = (uint8_t *)&word;
+        bstep = 0;
+    }
+
+    switch(optype) {
+        case BITWISE_AND:
+            BITWISE_WORD_LOOP(array, larray, rarray, bstep, nbytes, a & b);
+            break;
+        case BITWISE_OR:
+            BITWISE_WORD_LOOP(array, larray, rarray, bstep, nbytes, a | b);
+            break;
+        case BITWISE_XOR:
+            BITWISE_WORD_LOOP(array, larray, rarray, bstep, nbytes, a ^ b);
+            break;
+        case BITWISE_LEFT_SHIFT:
+            if(!scalar) {
+                if(lhs->dtype == NDARRAY_UINT8) {
+                    BITWISE_SHIFT_LOOP(uint8_t, array, larray, rarray, len, <<);
+                } else if(lhs->dtype == NDARRAY_INT8) {
+                    BITWISE_SHIFT_LOOP(int8_t, array, larray, rarray, len, <<);
+                } else if(lhs->dtype == NDARRAY_UINT16) {
+                    BITWISE_SHIFT_LOOP(uint16_t, array, larray, rarray, len, <<);
+                } else {
+                    BITWISE_SHIFT_LOOP(int16_t, array, larray, rarray, len, <<);
+                }
+            } else if(count >= bits) {
+                memset(array, 0, nbytes);
+            } else {
+                // bits pushed over the top of a lane are cleared by the mask
+                uint32_t mask = ((lane << count) & lane) * ones;
+                BITWISE_WORD_LOOP(array, larray, rarray, bstep, nbytes, (a << count) & mask);
+            }
+            break;
+        case BITWISE_RIGHT_SHIFT:
+            if(!scalar) {
+                if(lhs->dtype == NDARRAY_UINT8) {
+                    BITWISE_SHIFT_LOOP(uint8_t, array, larray, rarray, len, >>);
+                } else if(lhs->dtype == NDARRAY_INT8) {
+                    BITWISE_SHIFT_LOOP(int8_t, array, larray, rarray, len, >>);
+                } else if(lhs->dtype == NDARRAY_UINT16) {
+                    BITWISE_SHIFT_LOOP(uint16_t, array, larray, rarray, len, >>);
+                } else {
+                    BITWISE_SHIFT_LOOP(int16_t, array, larray, rarray, len, >>);
+                }
+            } else if((lhs->dtype == NDARRAY_UINT8) || (lhs->dtype == NDARRAY_UINT16)) {
+                if(count >= bits) {
+                    memset(array, 0, nbytes);
+                } else {
+                    uint32_t mask = (lane >> count) * ones;
+                    BITWISE_WORD_LOOP(array, larray, rarray, bstep, nbytes, (a >> count) & mask);
+                }
+            } else {
+                // the arithmetic shift is a logical shift of the offset-binary value, x + 2^(bits-1),
+                // from which the shifted offset is subtracted
+                if(count >= bits) {
+                    count = bits - 1;
+                }
+                uint32_t mask = (lane >> count) * ones;
+                uint32_t bias = ((high & lane) >> count) * ones;
+                BITWISE_WORD_LOOP(array, larray, rarray, bstep, nbytes,
+                                bitwise_subtract_lanes(((a ^ high) >> count) & mask, bias, high));
+            }
+            break;
+        default:
+            break;
+    }
+    return results;
+}
+
+#if ULAB_HAS_INT32
+static uint32_t bitwise_int32_value(uint32_t a, uint32_t b, bool is_signed, uint8_t optype) {
+    // the bits of a, and b are combined as unsigned words, so that the signedness matters only for
+    // the right shift; counts beyond the width, and negative counts, which wrap to large unsigned
+    // values, shift out all bits
+    switch(optype) {
+        case BITWISE_AND:
+            return a & b;
+        case BITWISE_OR:
+            return a | b;
+        case BITWISE_XOR:
+            return a ^ b;
+        case BITWISE_LEFT_SHIFT:
+            return b >= 32 ? 0 : a << b;
+        default:
+            if(is_signed) {
+                int32_t value = (int32_t)a;
+                return (uint32_t)(b >= 32 ? (value < 0 ? -1 : 0) : value >> b);
+            }
+            return b >= 32 ? 0 : a >> b;
+    }
+}
+
+static ndarray_obj_t *bitwise_binary_int32(ndarray_obj_t *lhs, ndarray_obj_t *rhs, uint8_t optype) {
+    // the operands are brought to their common 32-bit type; uint32 and a signed type would
+    // require 64 bits, hence, that combination is rejected
+    uint8_t dtype = ndarray_upcast_dtype(lhs->dtype, rhs->dtype);
+    if((dtype != NDARRAY_INT32) && (dtype != NDARRAY_UINT32)) {
+        mp_raise_TypeError(MP_ERROR_TEXT("not supported for input types"));
+    }
+    if(lhs->dtype != dtype) {
+        lhs = ndarray_int32_cast(lhs, dtype);
+    }
+    if(rhs->dtype != dtype) {
+        rhs = ndarray_int32_cast(rhs, dtype);
+    }
+
+    uint8_t ndim = 0;
+    size_t shape[ULAB_MAX_DIMS];
+    int32_t lstrides[ULAB_MAX_DIMS], rstrides[ULAB_MAX_DIMS];
+    ndarray_can_broadcast(lhs, rhs, &ndim, shape, lstrides, rstrides);
+
+    ndarray_obj_t *results = ndarray_new_dense_ndarray_uninitialised(ndim, shape, dtype);
+    if(results->len == 0) {
+        return results;
+    }
+    bool is_signed = dtype == NDARRAY_INT32;
+    uint32_t *array = (uint32_t *)results->array;
+    uint8_t *larray = (uint8_t *)lhs->array;
+    uint8_t *rarray = (uint8_t *)rhs->array;
+
+    #if ULAB_MAX_DIMS > 3
+    size_t i = 0;
+    do {
+    #endif
+        #if ULAB_MAX_DIMS > 2
+        size_t j = 0;
+        do {
+        #endif
+            #if ULAB_MAX_DIMS > 1
+            size_t k = 0;
+            do {
+            #endif
+                size_t l = 0;
+                do {
+                    *array++ = bitwise_int32_value(*((uint32_t *)larray), *((uint32_t *)rarray), is_signed, optype);
+                    larray += lstrides[ULAB_MAX_DIMS - 1];
+                    rarray += rstrides[ULAB_MAX_DIMS - 1];
+                    l++;
+                } while(l < results->shape[ULAB_MAX_DIMS - 1]);
+            #if ULAB_MAX_DIMS > 1
+                larray -= lstrides[ULAB_MAX_DIMS - 1] * results->shape[ULAB_MAX_DIMS - 1];
+                larray += lstrides[ULAB_MAX_DIMS - 2];
+                rarray -= rstrides[ULAB_MAX_DIMS - 1] * results->shape[ULAB_MAX_DIMS - 1];
+                rarray += rstrides[ULAB_MAX_DIMS - 2];
+                k++;
+            } while(k < results->shape[ULAB_MAX_DIMS - 2]);
+            #endif
+        #if ULAB_MAX_DIMS > 2
+            larray -= lstrides[ULAB_MAX_DIMS - 2] * results->shape[ULAB_MAX_DIMS - 2];
+            larray += lstrides[ULAB_MAX_DIMS - 3];
+            rarray -= rstrides[ULAB_MAX_DIMS - 2] * results->shape[ULAB_MAX_DIMS - 2];
+            rarray += rstrides[ULAB_MAX_DIMS - 3];
+            j++;
+        } while(j < results->shape[ULAB_MAX_DIMS - 3]);
+        #endif
+    #if ULAB_MAX_DIMS > 3
+        larray -= lstrides[ULAB_MAX_DIMS - 3] * results->shape[ULAB_MAX_DIMS - 3];
+        larray += lstrides[ULAB_MAX_DIMS - 4];
+        rarray -= rstrides[ULAB_MAX_DIMS - 3] * results->shape[ULAB_MAX_DIMS - 3];
+        rarray += rstrides[ULAB_MAX_DIMS - 4];
+        i++;
+    } while(i < results->shape[ULAB_MAX_DIMS - 4]);
+    #endif
+    return results;
+}
+#endif /* ULAB_HAS_INT32 */
+
+mp_obj_t *bitwise_binary_operators(size_t n_args, const mp_obj_t *pos_args, mp_map_t *kw_args, uint8_t optype) {
+    static const mp_arg_t allowed_args[] = {
+        { MP_QSTR_, MP_ARG_REQUIRED | MP_ARG_OBJ, { .u_rom_obj = MP_ROM_NONE } },
+        { MP_QSTR_, MP_ARG_REQUIRED | MP_ARG_OBJ, { .u_rom_obj = MP_ROM_NONE } },
+        { MP_QSTR_out, MP_ARG_KW_ONLY | MP_ARG_OBJ, { .u_rom_obj = MP_ROM_NONE } },
+    };
+
+    mp_arg_val_t args[MP_ARRAY_SIZE(allowed_args)];
+    mp_arg_parse_all(n_args, pos_args, kw_args, MP_ARRAY_SIZE(allowed_args), allowed_args, args);
+
+    ndarray_obj_t *lhs = ndarray_from_mp_obj(args[0].u_obj, 0);
+    ndarray_obj_t *rhs = ndarray_from_mp_obj(args[1].u_obj, 0);
+    mp_obj_t out = args[2].u_obj;
     
     #if ULAB_SUPPORTS_COMPLEX
-    if((lhs->dtype == NDARRAY_FLOAT) || (rhs->dtype == NDARRAY_FLOAT) || (lhs->dtype == NDARRAY_COMPLEX) || (rhs->dtype == NDARRAY_COMPLEX)) {
+    if(NDARRAY_IS_FLOATING(lhs->dtype) || NDARRAY_IS_FLOATING(rhs->dtype) || (lhs->dtype == NDARRAY_COMPLEX) || (rhs->dtype == NDARRAY_COMPLEX)) {
         mp_raise_ValueError(MP_ERROR_TEXT("not supported for input types"));
     }
     #else
-    if((lhs->dtype == NDARRAY_FLOAT) || (rhs->dtype == NDARRAY_FLOAT)) {
+    if(NDARRAY_IS_FLOATING(lhs->dtype) || NDARRAY_IS_FLOATING(rhs->dtype)) {
         mp_raise_ValueError(MP_ERROR_TEXT("not supported for input types"));
     }
     #endif
@@ -351,8 +614,32 @@ mp_obj_t *bitwise_binary_operators(mp_obj_t x1, mp_obj_t x2, uint8_t optype) {
         mp_raise_ValueError(MP_ERROR_TEXT("operands could not be broadcast together"));
     }
 
-    ndarray_obj_t *results = NULL;
-    
+    if((optype >= BITWISE_LEFT_SHIFT) && (rhs->len == 1) && (rhs->dtype != lhs->dtype)) {
+        // as in numpy, a non-negative scalar shift count does not change the type of the result;
+        // counts beyond the width of the type have the same effect as the width, so that the count
+        // can be converted to the type of the shifted array without loss
+        mp_float_t count = ndarray_get_float_value(rhs->array, rhs->dtype);
+        if(count >= 0) {
+            uint8_t bits = lhs->itemsize * 8;
+            rhs = ndarray_new_linear_array(1, lhs->dtype);
+            ndarray_set_value(lhs->dtype, rhs->array, 0, mp_obj_new_int(count > bits ? bits : (mp_int_t)count));
+        }
+    }
+
+    ndarray_obj_t *results = bitwise_binary_dense(lhs, rhs, ndim, shape, optype, out);
+    if(results != NULL) {
+        m_del(size_t, shape, ULAB_MAX_DIMS);
+        m_del(int32_t, lstrides, ULAB_MAX_DIMS);
+        m_del(int32_t, rstrides, ULAB_MAX_DIMS);
+        return MP_OBJ_FROM_PTR(results);
+    }
+
+    #if ULAB_HAS_INT32
+    if(NDARRAY_IS_INT32(lhs) || NDARRAY_IS_INT32(rhs)) {
+        // the word-wide kernels never accept 32-bit operands, so that they always end up here
+        results = bitwise_binary_int32(lhs, rhs, optype);
+    } else
+    #endif
     switch(optype) {
         #if ULAB_NUMPY_HAS_BITWISE_AND
         case BITWISE_AND:
@@ -383,6 +670,20 @@ mp_obj_t *bitwise_binary_operators(mp_obj_t x1, mp_obj_t x2, uint8_t optype) {
             break; 
     }
 
+    if((results != NULL) && (out != mp_const_none)) {
+        // the results are copied, so that out can also overlap with the operands
+        ndarray_obj_t *target = ulab_tools_inspect_out(out, results->dtype, ndim, shape, false);
+        if(target->len != 0) {
+            uint8_t *tarray = (uint8_t *)target->array;
+            uint8_t *array = (uint8_t *)results->array;
+            ITERATOR_HEAD()
+                memcpy(tarray, array, target->itemsize);
+                array += target->itemsize;
+            ITERATOR_TAIL(target, tarray)
+        }
+        results = target;
+    }
+
     m_del(size_t, shape, ULAB_MAX_DIMS);
     m_del(int32_t, lstrides, ULAB_MAX_DIMS);
     m_del(int32_t, rstrides, ULAB_MAX_DIMS);
@@ -391,41 +692,484 @@ mp_obj_t *bitwise_binary_operators(mp_obj_t x1, mp_obj_t x2, uint8_t optype) {
 }
 
 #if ULAB_NUMPY_HAS_BITWISE_AND
-mp_obj_t bitwise_bitwise_and(mp_obj_t x1, mp_obj_t x2) {
-    return bitwise_binary_operators(x1, x2, BITWISE_AND);
+mp_obj_t bitwise_bitwise_and(size_t n_args, const mp_obj_t *pos_args, mp_map_t *kw_args) {
+    return bitwise_binary_operators(n_args, pos_args, kw_args, BITWISE_AND);
 }
 
-MP_DEFINE_CONST_FUN_OBJ_2(bitwise_bitwise_and_obj, bitwise_bitwise_and);
+MP_DEFINE_CONST_FUN_OBJ_KW(bitwise_bitwise_and_obj, 2, bitwise_bitwise_and);
 #endif
 
 #if ULAB_NUMPY_HAS_BITWISE_OR
-mp_obj_t bitwise_bitwise_or(mp_obj_t x1, mp_obj_t x2) {
-    return bitwise_binary_operators(x1, x2, BITWISE_OR);
+mp_obj_t bitwise_bitwise_or(size_t n_args, const mp_obj_t *pos_args, mp_map_t *kw_args) {
+    return bitwise_binary_operators(n_args, pos_args, kw_args, BITWISE_OR);
 }
 
-MP_DEFINE_CONST_FUN_OBJ_2(bitwise_bitwise_or_obj, bitwise_bitwise_or);
+MP_DEFINE_CONST_FUN_OBJ_KW(bitwise_bitwise_or_obj, 2, bitwise_bitwise_or);
 #endif
 
 #if ULAB_NUMPY_HAS_BITWISE_XOR
-mp_obj_t bitwise_bitwise_xor(mp_obj_t x1, mp_obj_t x2) {
-    return bitwise_binary_operators(x1, x2, BITWISE_XOR);
+mp_obj_t bitwise_bitwise_xor(size_t n_args, const mp_obj_t *pos_args, mp_map_t *kw_args) {
+    return bitwise_binary_operators(n_args, pos_args, kw_args, BITWISE_XOR);
 }
 
-MP_DEFINE_CONST_FUN_OBJ_2(bitwise_bitwise_xor_obj, bitwise_bitwise_xor);
+MP_DEFINE_CONST_FUN_OBJ_KW(bitwise_bitwise_xor_obj, 2, bitwise_bitwise_xor);
 #endif
 
 #if ULAB_NUMPY_HAS_LEFT_SHIFT
-mp_obj_t bitwise_left_shift(mp_obj_t x1, mp_obj_t x2) {
-    return bitwise_binary_operators(x1, x2, BITWISE_LEFT_SHIFT);
+mp_obj_t bitwise_left_shift(size_t n_args, const mp_obj_t *pos_args, mp_map_t *kw_args) {
+    return bitwise_binary_operators(n_args, pos_args, kw_args, BITWISE_LEFT_SHIFT);
 }
 
-MP_DEFINE_CONST_FUN_OBJ_2(left_shift_obj, bitwise_left_shift);
+MP_DEFINE_CONST_FUN_OBJ_KW(left_shift_obj, 2, bitwise_left_shift);
 #endif
 
 #if ULAB_NUMPY_HAS_RIGHT_SHIFT
-mp_obj_t bitwise_right_shift(mp_obj_t x1, mp_obj_t x2) {
-    return bitwise_binary_operators(x1, x2, BITWISE_RIGHT_SHIFT);
+mp_obj_t bitwise_right_shift(size_t n_args, const mp_obj_t *pos_args, mp_map_t *kw_args) {
+    return bitwise_binary_operators(n_args, pos_args, kw_args, BITWISE_RIGHT_SHIFT);
+}
+
+MP_DEFINE_CONST_FUN_OBJ_KW(right_shift_obj, 2, bitwise_right_shift);
+#endif
+
+#if ULAB_NUMPY_HAS_BITWISE_COUNT || ULAB_NUMPY_HAS_COUNT_NONZERO
+static uint8_t bitwise_popcount32(uint32_t w) {
+    // the bits are summed in parallel, first in pairs, then in nibbles, and finally in bytes
+    w = w - ((w >> 1) & 0x55555555);
+    w = (w & 0x33333333) + ((w >> 2) & 0x33333333);
+    w = (w + (w >> 4)) & 0x0F0F0F0F;
+    return (uint8_t)((w * 0x01010101) >> 24);
+}
+#endif
+
+#if ULAB_NUMPY_HAS_COUNT_NONZERO || ULAB_NUMPY_HAS_PACKBITS
+static bool bitwise_is_nonzero(uint8_t *array, uint8_t dtype, uint8_t itemsize) {
+    // integers are non-zero, if any of their bytes is, while -0.0 is also a zero
+    #if ULAB_SUPPORTS_COMPLEX
+    if(dtype == NDARRAY_COMPLEX) {
+        mp_float_t *c = (mp_float_t *)array;
+        return (c[0] != MICROPY_FLOAT_CONST(0.0)) || (c[1] != MICROPY_FLOAT_CONST(0.0));
+    }
+    #endif
+    if(NDARRAY_IS_FLOATING(dtype)) {
+        return ndarray_get_float_value(array, dtype) != MICROPY_FLOAT_CONST(0.0);
+    }
+    uint8_t value = 0;
+    for(uint8_t i = 0; i < itemsize; i++) {
+        value |= array[i];
+    }
+    return value != 0;
+}
+
+static uint32_t bitwise_nonzero_bytes(uint32_t w) {
+    // returns a word, in which the most significant bit of each byte is set, if that byte of w was
+    // not zero; the low seven bits cannot carry into the next byte, hence the bytes are independent
+    return ((((w & 0x7F7F7F7F) + 0x7F7F7F7F) | w) & 0x80808080);
+}
+#endif
+
+#if ULAB_NUMPY_HAS_COUNT_NONZERO
+static size_t bitwise_count_nonzero_line(uint8_t *array, int32_t stride, uint8_t dtype, uint8_t itemsize, size_t len) {
+    size_t count = 0;
+    size_t i = 0;
+    if(!NDARRAY_IS_FLOATING(dtype) && (stride == itemsize)) {
+        // dense single-byte data are inspected four at a time, and two-byte items are
+        // non-zero, if either of their bytes is
+        if(itemsize == 1) {
+            for(; i + 4 <= len; i += 4) {
+                uint32_t w;
+                memcpy(&w, array, 4);
+                count += bitwise_popcount32(bitwise_nonzero_bytes(w));
+                array += 4;
+            }
+        } else if(itemsize == 2) {
+            for(; i + 2 <= len; i += 2) {
+                uint32_t w;
+                memcpy(&w, array, 4);
+                w = bitwise_nonzero_bytes(w);
+                count += bitwise_popcount32((w | (w << 8)) & 0x80008000);
+                array += 4;
+            }
+        }
+    }
+    for(; i < len; i++) {
+        count += bitwise_is_nonzero(array, dtype, itemsize);
+        array += stride;
+    }
+    return count;
+}
+
+mp_obj_t bitwise_count_nonzero(size_t n_args, const mp_obj_t *pos_args, mp_map_t *kw_args) {
+    static const mp_arg_t allowed_args[] = {
+        { MP_QSTR_, MP_ARG_REQUIRED | MP_ARG_OBJ, { .u_rom_obj = MP_ROM_NONE } },
+        { MP_QSTR_axis, MP_ARG_OBJ, { .u_rom_obj = MP_ROM_NONE } },
+    };
+
+    mp_arg_val_t args[MP_ARRAY_SIZE(allowed_args)];
+    mp_arg_parse_all(n_args, pos_args, kw_args, MP_ARRAY_SIZE(allowed_args), allowed_args, args);
+
+    if(!mp_obj_is_type(args[0].u_obj, &ulab_ndarray_type)) {
+        mp_raise_TypeError(MP_ERROR_TEXT("input must be an ndarray"));
+    }
+    ndarray_obj_t *ndarray = MP_OBJ_TO_PTR(args[0].u_obj);
+    uint8_t *array = (uint8_t *)ndarray->array;
+
+    if(args[1].u_obj == mp_const_none) {
+        if(ndarray->len == 0) {
+            return mp_obj_new_int(0);
+        }
+        // the array is traversed along its last axis, so that views need not be copied
+        uint8_t index = ULAB_MAX_DIMS - 1;
+        size_t len = ndarray->shape[index];
+        size_t count = 0;
+        if(ndarray_is_contiguous(ndarray)) {
+            count = bitwise_count_nonzero_line(array, ndarray->itemsize, ndarray->dtype, ndarray->itemsize, ndarray->len);
+        } else {
+            for(size_t line = 0; line < ndarray->len / len; line++) {
+                count += bitwise_count_nonzero_line(array + tools_line_offset(ndarray, index, line), ndarray->strides[index],
+                                                    ndarray->dtype, ndarray->itemsize, len);
+            }
+        }
+        return mp_obj_new_int_from_uint(count);
+    }
+
+    int8_t ax = tools_get_axis(args[1].u_obj, ndarray->ndim);
+    uint8_t index = ULAB_MAX_DIMS - ndarray->ndim + ax;
+    size_t len = ndarray->shape[index];
+
+    if(ndarray->ndim == 1) {
+        size_t count = 0;
+        if(len != 0) {
+            count = bitwise_count_nonzero_line(array, ndarray->strides[index], ndarray->dtype, ndarray->itemsize, len);
+        }
+        return mp_obj_new_int_from_uint(count);
+    }
+
+    size_t *shape = m_new0(size_t, ULAB_MAX_DIMS);
+    for(uint8_t i = 0, j = ULAB_MAX_DIMS - ndarray->ndim + 1; i < ndarray->ndim; i++) {
+        uint8_t d = ULAB_MAX_DIMS - ndarray->ndim + i;
+        if(d != index) {
+            shape[j++] = ndarray->shape[d];
+        }
+    }
+
+    uint8_t dtype = NDARRAY_UINT16;
+    if(len > 65535) {
+        #if ULAB_HAS_INT32
+        dtype = NDARRAY_UINT32;
+        #else
+        dtype = NDARRAY_FLOAT;
+        #endif
+    }
+    ndarray_obj_t *results = ndarray_new_dense_ndarray(ndarray->ndim - 1, shape, dtype);
+    if(len != 0) {
+        for(size_t line = 0; line < results->len; line++) {
+            size_t count = bitwise_count_nonzero_line(array + tools_line_offset(ndarray, index, line), ndarray->strides[index],
+                                                      ndarray->dtype, ndarray->itemsize, len);
+            ndarray_set_value(dtype, results->array, line, mp_obj_new_int_from_uint(count));
+        }
+    }
+    m_del(size_t, shape, ULAB_MAX_DIMS);
+    return MP_OBJ_FROM_PTR(results);
+}
+
+MP_DEFINE_CONST_FUN_OBJ_KW(bitwise_count_nonzero_obj, 1, bitwise_count_nonzero);
+#endif /* ULAB_NUMPY_HAS_COUNT_NONZERO */
+
+#if ULAB_NUMPY_HAS_BITWISE_COUNT
+static uint8_t bitwise_count_value(uint8_t *array, uint8_t dtype) {
+    // the number of 1 bits in the absolute value, as in numpy
+    int32_t value;
+    if(dtype == NDARRAY_UINT8) {
+        value = *array;
+    } else if(dtype == NDARRAY_INT8) {
+        value = *((int8_t *)array);
+    } else if(dtype == NDARRAY_UINT16) {
+        value = *((uint16_t *)array);
+    } else if(dtype == NDARRAY_INT16) {
+        value = *((int16_t *)array);
+    }
+    #if ULAB_HAS_INT32
+    else if(dtype == NDARRAY_UINT32) {
+        return bitwise_popcount32(*((uint32_t *)array));
+    } else if(dtype == NDARRAY_INT32) {
+        int32_t v = *((int32_t *)array);
+        return bitwise_popcount32(v < 0 ? -(uint32_t)v : (uint32_t)v);
+    }
+    #endif
+    else {
+        value = 0;
+    }
+    return bitwise_popcount32(value < 0 ? (uint32_t)(-value) : (uint32_t)value);
+}
+
+mp_obj_t bitwise_bitwise_count(mp_obj_t x) {
+    if(mp_obj_is_int(x)) {
+        mp_int_t value = mp_obj_get_int(x);
+        return mp_obj_new_int(bitwise_popcount32(value < 0 ? -(uint32_t)value : (uint32_t)value));
+    }
+    if(!mp_obj_is_type(x, &ulab_ndarray_type)) {
+        mp_raise_TypeError(MP_ERROR_TEXT("input must be an ndarray"));
+    }
+    ndarray_obj_t *ndarray = MP_OBJ_TO_PTR(x);
+    COMPLEX_DTYPE_NOT_IMPLEMENTED(ndarray->dtype)
+    if(NDARRAY_IS_FLOATING(ndarray->dtype)) {
+        mp_raise_TypeError(MP_ERROR_TEXT("not supported for input types"));
+    }
+
+    ndarray_obj_t *results = ndarray_new_dense_ndarray_uninitialised(ndarray->ndim, ndarray->shape, NDARRAY_UINT8);
+    uint8_t *rarray = (uint8_t *)results->array;
+    uint8_t *array = (uint8_t *)ndarray->array;
+    if(ndarray->len == 0) {
+        return MP_OBJ_FROM_PTR(results);
+    }
+
+    if((ndarray->dtype == NDARRAY_UINT8) && ndarray_is_contiguous(ndarray)) {
+        // the bytes of a word are counted in parallel, and each byte holds its own result
+        size_t i = 0;
+        for(; i + 4 <= ndarray->len; i += 4) {
+            uint32_t w;
+            memcpy(&w, array, 4);
+            w = w - ((w >> 1) & 0x55555555);
+            w = (w & 0x33333333) + ((w >> 2) & 0x33333333);
+            w = (w + (w >> 4)) & 0x0F0F0F0F;
+            memcpy(rarray, &w, 4);
+            array += 4;
+            rarray += 4;
+        }
+        for(; i < ndarray->len; i++) {
+            *rarray++ = bitwise_popcount32(*array++);
+        }
+        return MP_OBJ_FROM_PTR(results);
+    }
+
+    ITERATOR_HEAD()
+        *rarray++ = bitwise_count_value(array, ndarray->dtype);
+    ITERATOR_TAIL(ndarray, array)
+    return MP_OBJ_FROM_PTR(results);
+}
+
+MP_DEFINE_CONST_FUN_OBJ_1(bitwise_bitwise_count_obj, bitwise_bitwise_count);
+#endif /* ULAB_NUMPY_HAS_BITWISE_COUNT */
+
+#if ULAB_NUMPY_HAS_PACKBITS || ULAB_NUMPY_HAS_UNPACKBITS
+static bool bitwise_is_little(mp_obj_t bitorder) {
+    if(!mp_obj_is_str(bitorder)) {
+        mp_raise_TypeError(MP_ERROR_TEXT("bitorder must be either 'big' or 'little'"));
+    }
+    const char *_bitorder = mp_obj_str_get_str(bitorder);
+    if(strcmp(_bitorder, "little") == 0) {
+        return true;
+    } else if(strcmp(_bitorder, "big") != 0) {
+        mp_raise_ValueError(MP_ERROR_TEXT("bitorder must be either 'big' or 'little'"));
+    }
+    return false;
+}
+
+static ndarray_obj_t *bitwise_bits_output(ndarray_obj_t *ndarray, mp_obj_t axis, size_t len, uint8_t *index) {
+    // returns the output of packbits, or unpackbits, and the index of the axis, along which the
+    // bits are converted; if axis is None, the input is flattened, and the output is linear
+    if(axis == mp_const_none) {
+        *index = ULAB_MAX_DIMS - 1;
+        return ndarray_new_linear_array(len, NDARRAY_UINT8);
+    }
+    int8_t ax = tools_get_axis(axis, ndarray->ndim);
+    *index = ULAB_MAX_DIMS - ndarray->ndim + ax;
+    size_t *shape = m_new(size_t, ULAB_MAX_DIMS);
+    memcpy(shape, ndarray->shape, ULAB_MAX_DIMS * sizeof(size_t));
+    shape[*index] = len;
+    ndarray_obj_t *results = ndarray_new_dense_ndarray(ndarray->ndim, shape, NDARRAY_UINT8);
+    m_del(size_t, shape, ULAB_MAX_DIMS);
+    return results;
+}
+#endif
+
+#if ULAB_NUMPY_HAS_PACKBITS
+static void bitwise_pack_line(uint8_t *out, int32_t ostride, uint8_t *array, int32_t stride,
+                            uint8_t dtype, uint8_t itemsize, size_t len, bool little) {
+    size_t i = 0;
+    #if MP_ENDIANNESS_LITTLE
+    if((itemsize == 1) && (stride == 1)) {
+        // the non-zero flags of four bytes are gathered into a nibble by a single multiplication:
+        // the flag of byte j is moved to bit 21 + j (little), or 27 - j (big), and the cross terms
+        // of the product end up in distinct bits outside the nibble, so that there are no carries
+        for(; i + 8 <= len; i += 8) {
+            uint32_t w0, w1;
+            memcpy(&w0, array, 4);
+            memcpy(&w1, array + 4, 4);
+            w0 = bitwise_nonzero_bytes(w0) >> 7;
+            w1 = bitwise_nonzero_bytes(w1) >> 7;
+            if(little) {
+                *out = (((w0 * 0x00204081) >> 21) & 0x0F) | ((((w1 * 0x00204081) >> 21) & 0x0F) << 4);
+            } else {
+                *out = ((((w0 * 0x08040201) >> 24) & 0x0F) << 4) | (((w1 * 0x08040201) >> 24) & 0x0F);
+            }
+            out += ostride;
+            array += 8;
+        }
+    }
+    #endif
+    uint8_t byte = 0;
+    uint8_t bit = 0;
+    for(; i < len; i++) {
+        if(bitwise_is_nonzero(array, dtype, itemsize)) {
+            byte |= little ? (1 << bit) : (0x80 >> bit);
+        }
+        array += stride;
+        if(++bit == 8) {
+            *out = byte;
+            out += ostride;
+            byte = 0;
+            bit = 0;
+        }
+    }
+    if(bit != 0) {
+        // the last byte is padded with zeros
+        *out = byte;
+    }
+}
+
+mp_obj_t bitwise_packbits(size_t n_args, const mp_obj_t *pos_args, mp_map_t *kw_args) {
+    static const mp_arg_t allowed_args[] = {
+        { MP_QSTR_, MP_ARG_REQUIRED | MP_ARG_OBJ, { .u_rom_obj = MP_ROM_NONE } },
+        { MP_QSTR_axis, MP_ARG_OBJ, { .u_rom_obj = MP_ROM_NONE } },
+        { MP_QSTR_bitorder, MP_ARG_KW_ONLY | MP_ARG_OBJ, { .u_rom_obj = MP_ROM_QSTR(MP_QSTR_big) } },
+    };
+
+    mp_arg_val_t args[MP_ARRAY_SIZE(allowed_args)];
+    mp_arg_parse_all(n_args, pos_args, kw_args, MP_ARRAY_SIZE(allowed_args), allowed_args, args);
+
+    if(!mp_obj_is_type(args[0].u_obj, &ulab_ndarray_type)) {
+        mp_raise_TypeError(MP_ERROR_TEXT("input must be an ndarray"));
+    }
+    ndarray_obj_t *ndarray = MP_OBJ_TO_PTR(args[0].u_obj);
+    COMPLEX_DTYPE_NOT_IMPLEMENTED(ndarray->dtype)
+    if(NDARRAY_IS_FLOATING(ndarray->dtype)) {
+        mp_raise_TypeError(MP_ERROR_TEXT("input must be an integer, or Boolean array"));
+    }
+    bool little = bitwise_is_little(args[2].u_obj);
+
+    if(args[1].u_obj == mp_const_none) {
+        // the flattened array is packed as a single line
+        if(!ndarray_is_contiguous(ndarray)) {
+            ndarray = ndarray_copy_view(ndarray);
+        }
+        uint8_t index;
+        ndarray_obj_t *results = bitwise_bits_output(ndarray, mp_const_none, (ndarray->len + 7) / 8, &index);
+        bitwise_pack_line((uint8_t *)results->array, 1, (uint8_t *)ndarray->array, ndarray->itemsize,
+                            ndarray->dtype, ndarray->itemsize, ndarray->len, little);
+        return MP_OBJ_FROM_PTR(results);
+    }
+
+    size_t len = ndarray->shape[ULAB_MAX_DIMS - ndarray->ndim + tools_get_axis(args[1].u_obj, ndarray->ndim)];
+    uint8_t index;
+    ndarray_obj_t *results = bitwise_bits_output(ndarray, args[1].u_obj, (len + 7) / 8, &index);
+    if((len == 0) || (ndarray->len == 0)) {
+        return MP_OBJ_FROM_PTR(results);
+    }
+    uint8_t *array = (uint8_t *)ndarray->array;
+    uint8_t *rarray = (uint8_t *)results->array;
+    for(size_t line = 0; line < ndarray->len / len; line++) {
+        bitwise_pack_line(rarray + tools_line_offset(results, index, line), results->strides[index],
+                        array + tools_line_offset(ndarray, index, line), ndarray->strides[index],
+                        ndarray->dtype, ndarray->itemsize, len, little);
+    }
+    return MP_OBJ_FROM_PTR(results);
+}
+
+MP_DEFINE_CONST_FUN_OBJ_KW(bitwise_packbits_obj, 1, bitwise_packbits);
+#endif /* ULAB_NUMPY_HAS_PACKBITS */
+
+#if ULAB_NUMPY_HAS_UNPACKBITS
+static void bitwise_unpack_line(uint8_t *out, int32_t ostride, uint8_t *array, int32_t stride,
+                            size_t len, size_t count, bool little) {
+    // unpacks count bits from len bytes; if count is larger than 8 * len, the output is padded with zeros
+    size_t i = 0;
+    #if MP_ENDIANNESS_LITTLE
+    if(ostride == 1) {
+        // each nibble is copied into the four bytes of a word, where a mask keeps a different bit
+        // in each byte; adding 0x7F to the bytes moves the bit to the most significant position
+        uint32_t mask = little ? 0x08040201 : 0x01020408;
+        for(; (i + 8 <= count) && (i < 8 * len); i += 8) {
+            uint8_t byte = array[(i / 8) * stride];
+            uint32_t first = little ? (byte & 0x0F) : (byte >> 4);
+            uint32_t second = little ? (byte >> 4) : (byte & 0x0F);
+            first = (((first * 0x01010101) & mask) + 0x7F7F7F7F) >> 7;
+            second = (((second * 0x01010101) & mask) + 0x7F7F7F7F) >> 7;
+            first &= 0x01010101;
+            second &= 0x01010101;
+            memcpy(out, &first, 4);
+            memcpy(out + 4, &second, 4);
+            out += 8;
+        }
+    }
+    #endif
+    for(; i < count; i++) {
+        uint8_t value = 0;
+        if(i < 8 * len) {
+            uint8_t byte = array[(i / 8) * stride];
+            value = little ? (byte >> (i % 8)) & 0x01 : (byte >> (7 - i % 8)) & 0x01;
+        }
+        *out = value;
+        out += ostride;
+    }
+}
+
+mp_obj_t bitwise_unpackbits(size_t n_args, const mp_obj_t *pos_args, mp_map_t *kw_args) {
+    static const mp_arg_t allowed_args[] = {
+        { MP_QSTR_, MP_ARG_REQUIRED | MP_ARG_OBJ, { .u_rom_obj = MP_ROM_NONE } },
+        { MP_QSTR_axis, MP_ARG_OBJ, { .u_rom_obj = MP_ROM_NONE } },
+        { MP_QSTR_count, MP_ARG_KW_ONLY | MP_ARG_OBJ, { .u_rom_obj = MP_ROM_NONE } },
+        { MP_QSTR_bitorder, MP_ARG_KW_ONLY | MP_ARG_OBJ, { .u_rom_obj = MP_ROM_QSTR(MP_QSTR_big) } },
+    };
+
+    mp_arg_val_t args[MP_ARRAY_SIZE(allowed_args)];
+    mp_arg_parse_all(n_args, pos_args, kw_args, MP_ARRAY_SIZE(allowed_args), allowed_args, args);
+
+    if(!mp_obj_is_type(args[0].u_obj, &ulab_ndarray_type)) {
+        mp_raise_TypeError(MP_ERROR_TEXT("input must be an ndarray"));
+    }
+    ndarray_obj_t *ndarray = MP_OBJ_TO_PTR(args[0].u_obj);
+    if(ndarray->dtype != NDARRAY_UINT8) {
+        mp_raise_TypeError(MP_ERROR_TEXT("input must be of dtype uint8"));
+    }
+    bool little = bitwise_is_little(args[3].u_obj);
+
+    if((args[1].u_obj == mp_const_none) && !ndarray_is_contiguous(ndarray)) {
+        ndarray = ndarray_copy_view(ndarray);
+    }
+    size_t len = args[1].u_obj == mp_const_none ? ndarray->len : ndarray->shape[ULAB_MAX_DIMS - ndarray->ndim + tools_get_axis(args[1].u_obj, ndarray->ndim)];
+
+    // count is the number of bits along the axis; a negative value trims bits from the end
+    size_t count = 8 * len;
+    if(args[2].u_obj != mp_const_none) {
+        mp_int_t _count = mp_obj_get_int(args[2].u_obj);
+        if(_count < 0) {
+            _count += 8 * len;
+            count = _count < 0 ? 0 : (size_t)_count;
+        } else {
+            count = (size_t)_count;
+        }
+    }
+
+    uint8_t index;
+    ndarray_obj_t *results = bitwise_bits_output(ndarray, args[1].u_obj, count, &index);
+    if((count == 0) || (results->len == 0)) {
+        return MP_OBJ_FROM_PTR(results);
+    }
+    uint8_t *array = (uint8_t *)ndarray->array;
+    uint8_t *rarray = (uint8_t *)results->array;
+
+    if(args[1].u_obj == mp_const_none) {
+        bitwise_unpack_line(rarray, 1, array, 1, len, count, little);
+    } else {
+        for(size_t line = 0; line < results->len / count; line++) {
+            bitwise_unpack_line(rarray + tools_line_offset(results, index, line), results->strides[index],
+                            array + tools_line_offset(ndarray, index, line), ndarray->strides[index],
+                            len, count, little);
+        }
+    }
+    return MP_OBJ_FROM_PTR(results);
 }
 
-MP_DEFINE_CONST_FUN_OBJ_2(right_shift_obj, bitwise_right_shift);
-#endif
\ No newline at end of file
+MP_DEFINE_CONST_FUN_OBJ_KW(bitwise_unpackbits_obj, 1, bitwise_unpackbits);
+#endif /* ULAB_NUMPY_HAS_UNPACKBITS */
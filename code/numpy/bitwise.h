@@ -23,10 +23,45 @@ enum BITWISE_FUNCTION_TYPE {
     BITWISE_RIGHT_SHIFT,   
 };
 
-MP_DECLARE_CONST_FUN_OBJ_2(bitwise_bitwise_and_obj);
-MP_DECLARE_CONST_FUN_OBJ_2(bitwise_bitwise_or_obj);
-MP_DECLARE_CONST_FUN_OBJ_2(bitwise_bitwise_xor_obj);
-MP_DECLARE_CONST_FUN_OBJ_2(left_shift_obj);
-MP_DECLARE_CONST_FUN_OBJ_2(right_shift_obj);
+// Applies EXPRESSION, which can use the two words a, and b, to nbytes of dense data a 32-bit word
+// at a time. With bstep = 0, barray always supplies the same word, e.g., a replicated scalar.
+// The last, partial word is padded with zeros, and only its valid bytes are written back.
+#define BITWISE_WORD_LOOP(rarray, larray, barray, bstep, nbytes, EXPRESSION) do {\
+    size_t _i = 0;\
+    uint32_t a, b;\
+    for(; _i + 4 <= (nbytes); _i += 4) {\
+        memcpy(&a, (larray) + _i, 4);\
+        memcpy(&b, (barray), 4);\
+        (barray) += (bstep);\
+        a = (EXPRESSION);\
+        memcpy((rarray) + _i, &a, 4);\
+    }\
+    if(_i < (nbytes)) {\
+        a = b = 0;\
+        memcpy(&a, (larray) + _i, (nbytes) - _i);\
+        memcpy(&b, (barray), (nbytes) - _i);\
+        a = (EXPRESSION);\
+        memcpy((rarray) + _i, &a, (nbytes) - _i);\
+    }\
+} while(0)
+
+#define BITWISE_SHIFT_LOOP(type, rarray, larray, carray, len, OPERATOR) do {\
+    type *_r = (type *)(rarray);\
+    type *_l = (type *)(larray);\
+    type *_c = (type *)(carray);\
+    for(size_t _i = 0; _i < (len); _i++) {\
+        *_r++ = *_l++ OPERATOR *_c++;\
+    }\
+} while(0)
+
+MP_DECLARE_CONST_FUN_OBJ_KW(bitwise_bitwise_and_obj);
+MP_DECLARE_CONST_FUN_OBJ_KW(bitwise_bitwise_or_obj);
+MP_DECLARE_CONST_FUN_OBJ_KW(bitwise_bitwise_xor_obj);
+MP_DECLARE_CONST_FUN_OBJ_KW(left_shift_obj);
+MP_DECLARE_CONST_FUN_OBJ_KW(right_shift_obj);
+MP_DECLARE_CONST_FUN_OBJ_1(bitwise_bitwise_count_obj);
+MP_DECLARE_CONST_FUN_OBJ_KW(bitwise_count_nonzero_obj);
+MP_DECLARE_CONST_FUN_OBJ_KW(bitwise_packbits_obj);
+MP_DECLARE_CONST_FUN_OBJ_KW(bitwise_unpackbits_obj);
 
 #endif  /* _BITWISE_ */
@@ -82,6 +82,64 @@ mp_obj_t carray_imag(mp_obj_t _source) {
 
 MP_DEFINE_CONST_FUN_OBJ_1(carray_imag_obj, carray_imag);
 
+#if ULAB_NUMPY_HAS_ANGLE
+//| def angle(
+//|     z: builtins.complex | ulab.numpy.ndarray,
+//|     deg: bool = False
+//| ) -> builtins.float | ulab.numpy.ndarray:
+//|     """
+//|     Return the counterclockwise angle of the complex argument, which can be
+//|     either an ndarray, or a scalar. If deg is True, the angle is returned in degrees."""
+//|     ...
+//|
+mp_obj_t carray_angle(size_t n_args, const mp_obj_t *pos_args, mp_map_t *kw_args) {
+    static const mp_arg_t allowed_args[] = {
+        { MP_QSTR_, MP_ARG_REQUIRED | MP_ARG_OBJ, { .u_rom_obj = MP_ROM_NONE } },
+        { MP_QSTR_deg, MP_ARG_BOOL, { .u_bool = false } },
+    };
+
+    mp_arg_val_t args[MP_ARRAY_SIZE(allowed_args)];
+    mp_arg_parse_all(n_args, pos_args, kw_args, MP_ARRAY_SIZE(allowed_args), allowed_args, args);
+
+    mp_obj_t _source = args[0].u_obj;
+    mp_float_t scale = args[1].u_bool ? MICROPY_FLOAT_CONST(180.0) / MP_PI : MICROPY_FLOAT_CONST(1.0);
+
+    if(mp_obj_is_type(_source, &ulab_ndarray_type)) {
+        ndarray_obj_t *source = MP_OBJ_TO_PTR(_source);
+        ndarray_obj_t *ndarray = ndarray_new_dense_ndarray_uninitialised(source->ndim, source->shape, NDARRAY_FLOAT);
+        if(source->len == 0) {
+            return MP_OBJ_FROM_PTR(ndarray);
+        }
+        mp_float_t *array = (mp_float_t *)ndarray->array;
+        uint8_t *sarray = (uint8_t *)source->array;
+        if(source->dtype == NDARRAY_COMPLEX) {
+            // the real, and imaginary parts are interleaved, so both are read from the same pointer
+            ITERATOR_HEAD();
+                mp_float_t *c = (mp_float_t *)sarray;
+                *array++ = scale * MICROPY_FLOAT_C_FUN(atan2)(c[1], c[0]);
+            ITERATOR_TAIL(source, sarray);
+        } else {
+            // the angle of a real number is either 0, or pi
+            mp_float_t (*func)(void *) = ndarray_get_float_function(source->dtype);
+            ITERATOR_HEAD();
+                *array++ = scale * MICROPY_FLOAT_C_FUN(atan2)(MICROPY_FLOAT_CONST(0.0), func(sarray));
+            ITERATOR_TAIL(source, sarray);
+        }
+        return MP_OBJ_FROM_PTR(ndarray);
+    } else if(mp_obj_is_type(_source, &mp_type_complex) || mp_obj_is_int(_source) || mp_obj_is_float(_source)) {
+        mp_float_t real, imag;
+        mp_obj_get_complex(_source, &real, &imag);
+        return mp_obj_new_float(scale * MICROPY_FLOAT_C_FUN(atan2)(imag, real));
+    } else {
+        mp_raise_TypeError(MP_ERROR_TEXT("input must be an ndarray, or a scalar"));
+    }
+    // this should never happen
+    return mp_const_none;
+}
+
+MP_DEFINE_CONST_FUN_OBJ_KW(carray_angle_obj, 1, carray_angle);
+#endif
+
 #if ULAB_NUMPY_HAS_CONJUGATE
 
 //| def conjugate(
@@ -509,6 +567,128 @@ mp_obj_t carray_binary_add(ndarray_obj_t *lhs, ndarray_obj_t *rhs,
     return MP_OBJ_FROM_PTR(results);
 }
 
+// Kernels for the case, when the complex operand, the output, and the other operand are all
+// contiguous, so that the elements can be indexed directly. The operands are loaded before
+// the results are stored, hence the output may coincide with either of the inputs.
+
+static void carray_multiply_dense(mp_float_t *out, mp_float_t *a, mp_float_t *b, size_t len) {
+    for(size_t i = 0; i < len; i++) {
+        mp_float_t ar = a[2 * i], ai = a[2 * i + 1];
+        mp_float_t br = b[2 * i], bi = b[2 * i + 1];
+        out[2 * i] = ar * br - ai * bi;
+        out[2 * i + 1] = ar * bi + ai * br;
+    }
+}
+
+static void carray_multiply_real_dense(mp_float_t *out, mp_float_t *a, mp_float_t *b, size_t len) {
+    for(size_t i = 0; i < len; i++) {
+        mp_float_t br = b[i];
+        out[2 * i] = a[2 * i] * br;
+        out[2 * i + 1] = a[2 * i + 1] * br;
+    }
+}
+
+static void carray_multiply_scalar_dense(mp_float_t *out, mp_float_t *a, mp_float_t br, mp_float_t bi, size_t len) {
+    for(size_t i = 0; i < len; i++) {
+        mp_float_t ar = a[2 * i], ai = a[2 * i + 1];
+        out[2 * i] = ar * br - ai * bi;
+        out[2 * i + 1] = ar * bi + ai * br;
+    }
+}
+
+static void carray_divide_dense(mp_float_t *out, mp_float_t *a, mp_float_t *b, size_t len) {
+    for(size_t i = 0; i < len; i++) {
+        mp_float_t ar = a[2 * i], ai = a[2 * i + 1];
+        mp_float_t br = b[2 * i], bi = b[2 * i + 1];
+        mp_float_t denom = br * br + bi * bi;
+        out[2 * i] = (ar * br + ai * bi) / denom;
+        out[2 * i + 1] = (ai * br - ar * bi) / denom;
+    }
+}
+
+static void carray_divide_real_dense(mp_float_t *out, mp_float_t *a, mp_float_t *b, size_t len) {
+    for(size_t i = 0; i < len; i++) {
+        mp_float_t br = b[i];
+        out[2 * i] = a[2 * i] / br;
+        out[2 * i + 1] = a[2 * i + 1] / br;
+    }
+}
+
+static void carray_divide_scalar_dense(mp_float_t *out, mp_float_t *a, mp_float_t br, mp_float_t bi, size_t len) {
+    // the denominator is calculated only once, but the division is kept,
+    // so that the results are identical to those of the strided loops
+    mp_float_t denom = br * br + bi * bi;
+    for(size_t i = 0; i < len; i++) {
+        mp_float_t ar = a[2 * i], ai = a[2 * i + 1];
+        out[2 * i] = (ar * br + ai * bi) / denom;
+        out[2 * i + 1] = (ai * br - ar * bi) / denom;
+    }
+}
+
+static void carray_real_scalar_dense(mp_float_t *out, mp_float_t *a, mp_float_t b, size_t len, mp_binary_op_t op) {
+    if(op == MP_BINARY_OP_MULTIPLY) {
+        for(size_t i = 0; i < 2 * len; i++) {
+            out[i] = a[i] * b;
+        }
+    } else {
+        for(size_t i = 0; i < 2 * len; i++) {
+            out[i] = a[i] / b;
+        }
+    }
+}
+
+static bool carray_multiply_divide_dense(ndarray_obj_t *results, ndarray_obj_t *lhs, ndarray_obj_t *rhs, mp_binary_op_t op) {
+    // attempts to calculate the product, or the quotient of lhs and rhs with one of the dense kernels,
+    // and returns false, if the operands are not suitable, so that the strided loops have to be used
+    if((op == MP_BINARY_OP_MULTIPLY) && (lhs->dtype != NDARRAY_COMPLEX)) {
+        // multiplication is commutative, so the complex array can always be on the left hand side
+        ndarray_obj_t *tmp = lhs;
+        lhs = rhs;
+        rhs = tmp;
+    }
+    size_t len = results->len;
+    if((lhs->dtype != NDARRAY_COMPLEX) || (lhs->len != len) || !ndarray_is_contiguous(lhs)) {
+        return false;
+    }
+    mp_float_t *out = (mp_float_t *)results->array;
+    mp_float_t *a = (mp_float_t *)lhs->array;
+
+    if(rhs->len == 1) {
+        if(rhs->dtype == NDARRAY_COMPLEX) {
+            mp_float_t *b = (mp_float_t *)rhs->array;
+            if(op == MP_BINARY_OP_MULTIPLY) {
+                carray_multiply_scalar_dense(out, a, b[0], b[1], len);
+            } else {
+                carray_divide_scalar_dense(out, a, b[0], b[1], len);
+            }
+        } else {
+            carray_real_scalar_dense(out, a, ndarray_get_float_value(rhs->array, rhs->dtype), len, op);
+        }
+        return true;
+    }
+
+    if((rhs->len != len) || !ndarray_is_contiguous(rhs)) {
+        return false;
+    }
+    mp_float_t *b = (mp_float_t *)rhs->array;
+    if(rhs->dtype == NDARRAY_COMPLEX) {
+        if(op == MP_BINARY_OP_MULTIPLY) {
+            carray_multiply_dense(out, a, b, len);
+        } else {
+            carray_divide_dense(out, a, b, len);
+        }
+    } else if(rhs->dtype == NDARRAY_FLOAT) {
+        if(op == MP_BINARY_OP_MULTIPLY) {
+            carray_multiply_real_dense(out, a, b, len);
+        } else {
+            carray_divide_real_dense(out, a, b, len);
+        }
+    } else {
+        return false;
+    }
+    return true;
+}
+
 static void carray_binary_multiply_(ndarray_obj_t *results, mp_float_t *resarray, uint8_t *larray, uint8_t *rarray,
                             int32_t *lstrides, int32_t *rstrides, uint8_t rdtype) {
 
@@ -525,10 +705,9 @@ static void carray_binary_multiply_(ndarray_obj_t *results, mp_float_t *resarray
     }
 }
 
-mp_obj_t carray_binary_multiply(ndarray_obj_t *lhs, ndarray_obj_t *rhs,
-                            uint8_t ndim, size_t *shape, int32_t *lstrides, int32_t *rstrides) {
+static void carray_multiply_strided(ndarray_obj_t *results, ndarray_obj_t *lhs, ndarray_obj_t *rhs,
+                            int32_t *lstrides, int32_t *rstrides) {
 
-    ndarray_obj_t *results = ndarray_new_dense_ndarray(ndim, shape, NDARRAY_COMPLEX);
     mp_float_t *resarray = (mp_float_t *)results->array;
 
     if((lhs->dtype == NDARRAY_COMPLEX) && (rhs->dtype == NDARRAY_COMPLEX)) {
@@ -552,10 +731,13 @@ mp_obj_t carray_binary_multiply(ndarray_obj_t *lhs, ndarray_obj_t *rhs,
                 #endif
                     size_t l = 0;
                     do {
+                        // the operands are read first, because the output might be one of them
+                        mp_float_t ar = larray[0], ai = larray[1];
+                        mp_float_t br = rarray[0], bi = rarray[1];
                         // real part
-                        *resarray++ = larray[0] * rarray[0] - larray[1] * rarray[1];
+                        *resarray++ = ar * br - ai * bi;
                         // imaginary part
-                        *resarray++ = larray[0] * rarray[1] + larray[1] * rarray[0];
+                        *resarray++ = ar * bi + ai * br;
                         larray += lstrides[ULAB_MAX_DIMS - 1];
                         rarray += rstrides[ULAB_MAX_DIMS - 1];
                         l++;
@@ -614,6 +796,15 @@ mp_obj_t carray_binary_multiply(ndarray_obj_t *lhs, ndarray_obj_t *rhs,
         // imaginary part
         carray_binary_multiply_(results, resarray, larray, rarray, left_strides, right_strides, rdtype);
     }
+}
+
+mp_obj_t carray_binary_multiply(ndarray_obj_t *lhs, ndarray_obj_t *rhs,
+                            uint8_t ndim, size_t *shape, int32_t *lstrides, int32_t *rstrides) {
+
+    ndarray_obj_t *results = ndarray_new_dense_ndarray_uninitialised(ndim, shape, NDARRAY_COMPLEX);
+    if(!carray_multiply_divide_dense(results, lhs, rhs, MP_BINARY_OP_MULTIPLY)) {
+        carray_multiply_strided(results, lhs, rhs, lstrides, rstrides);
+    }
     return MP_OBJ_FROM_PTR(results);
 }
 
@@ -736,10 +927,9 @@ static void carray_binary_left_divide_(ndarray_obj_t *results, mp_float_t *resar
     }
 }
 
-mp_obj_t carray_binary_divide(ndarray_obj_t *lhs, ndarray_obj_t *rhs,
-                            uint8_t ndim, size_t *shape, int32_t *lstrides, int32_t *rstrides) {
+static void carray_divide_strided(ndarray_obj_t *results, ndarray_obj_t *lhs, ndarray_obj_t *rhs,
+                            int32_t *lstrides, int32_t *rstrides) {
 
-    ndarray_obj_t *results = ndarray_new_dense_ndarray(ndim, shape, NDARRAY_COMPLEX);
     mp_float_t *resarray = (mp_float_t *)results->array;
 
     if((lhs->dtype == NDARRAY_COMPLEX) && (rhs->dtype == NDARRAY_COMPLEX)) {
@@ -765,13 +955,16 @@ mp_obj_t carray_binary_divide(ndarray_obj_t *lhs, ndarray_obj_t *rhs,
                     do {
                         // (a + bi) / (c + di) =
                         // (ac + bd) / (c^2 + d^2) + i (bc - ad) / (c^2 + d^2)
+                        // the operands are read first, because the output might be one of them
+                        mp_float_t ar = larray[0], ai = larray[1];
+                        mp_float_t br = rarray[0], bi = rarray[1];
                         // denominator
-                        mp_float_t denom = rarray[0] * rarray[0] + rarray[1] * rarray[1];
+                        mp_float_t denom = br * br + bi * bi;
 
                         // real part
-                        *resarray++ = (larray[0] * rarray[0] + larray[1] * rarray[1]) / denom;
+                        *resarray++ = (ar * br + ai * bi) / denom;
                         // imaginary part
-                        *resarray++ = (larray[1] * rarray[0] - larray[0] * rarray[1]) / denom;
+                        *resarray++ = (ai * br - ar * bi) / denom;
                         larray += lstrides[ULAB_MAX_DIMS - 1];
                         rarray += rstrides[ULAB_MAX_DIMS - 1];
                         l++;
@@ -828,7 +1021,86 @@ mp_obj_t carray_binary_divide(ndarray_obj_t *lhs, ndarray_obj_t *rhs,
         }
     }
 
+}
+
+mp_obj_t carray_binary_divide(ndarray_obj_t *lhs, ndarray_obj_t *rhs,
+                            uint8_t ndim, size_t *shape, int32_t *lstrides, int32_t *rstrides) {
+
+    ndarray_obj_t *results = ndarray_new_dense_ndarray_uninitialised(ndim, shape, NDARRAY_COMPLEX);
+    if(!carray_multiply_divide_dense(results, lhs, rhs, MP_BINARY_OP_TRUE_DIVIDE)) {
+        carray_divide_strided(results, lhs, rhs, lstrides, rstrides);
+    }
     return MP_OBJ_FROM_PTR(results);
 }
 
+#if NDARRAY_HAS_INPLACE_MULTIPLY || NDARRAY_HAS_INPLACE_TRUE_DIVIDE
+static void carray_span(ndarray_obj_t *ndarray, uint8_t **start, uint8_t **end) {
+    // returns the first, and one past the last byte that a, possibly strided, non-empty array occupies
+    *start = *end = (uint8_t *)ndarray->array;
+    for(uint8_t i = ULAB_MAX_DIMS - ndarray->ndim; i < ULAB_MAX_DIMS; i++) {
+        int32_t extent = ndarray->strides[i] * (int32_t)(ndarray->shape[i] - 1);
+        if(extent < 0) {
+            *start += extent;
+        } else {
+            *end += extent;
+        }
+    }
+    *end += ndarray->itemsize;
+}
+
+static bool carray_overlaps(ndarray_obj_t *lhs, ndarray_obj_t *rhs) {
+    // an operand that coincides with the output element by element is harmless, because the dense kernels
+    // load each element before they store it, but any other overlap, e.g., c[1:] *= c[:-1], would
+    // clobber elements that have not been read yet; a single value is read before the loops start
+    if((lhs->len == 0) || (rhs->len <= 1)) {
+        return false;
+    }
+    if((lhs->array == rhs->array) && (lhs->dtype == rhs->dtype) && (lhs->len == rhs->len) && ndarray_is_contiguous(rhs)) {
+        return false;
+    }
+    uint8_t *lstart, *lend, *rstart, *rend;
+    carray_span(lhs, &lstart, &lend);
+    carray_span(rhs, &rstart, &rend);
+    return (lstart < rend) && (rstart < lend);
+}
+
+mp_obj_t carray_inplace_multiply_divide(ndarray_obj_t *lhs, ndarray_obj_t *rhs, int32_t *rstrides, mp_binary_op_t op) {
+    // the results of *=, and /= are written into the complex left hand side, which is thus used
+    // as the output array; a contiguous array is overwritten directly, a view, or an array that
+    // overlaps with the right hand side via a temporary array
+    if(lhs->dtype != NDARRAY_COMPLEX) {
+        mp_raise_TypeError(MP_ERROR_TEXT("cannot cast output with casting rule"));
+    }
+    op = op == MP_BINARY_OP_INPLACE_MULTIPLY ? MP_BINARY_OP_MULTIPLY : MP_BINARY_OP_TRUE_DIVIDE;
+
+    bool direct = ndarray_is_contiguous(lhs) && !carray_overlaps(lhs, rhs);
+    ndarray_obj_t *results = lhs;
+    if(!direct) {
+        results = ndarray_new_dense_ndarray_uninitialised(lhs->ndim, lhs->shape, NDARRAY_COMPLEX);
+    }
+
+    if(!carray_multiply_divide_dense(results, lhs, rhs, op)) {
+        // the strided loops re-scale the strides, so they must work on a copy
+        int32_t *lstrides = m_new(int32_t, ULAB_MAX_DIMS);
+        memcpy(lstrides, lhs->strides, ULAB_MAX_DIMS * sizeof(int32_t));
+        if(op == MP_BINARY_OP_MULTIPLY) {
+            carray_multiply_strided(results, lhs, rhs, lstrides, rstrides);
+        } else {
+            carray_divide_strided(results, lhs, rhs, lstrides, rstrides);
+        }
+        m_del(int32_t, lstrides, ULAB_MAX_DIMS);
+    }
+
+    if(!direct) {
+        uint8_t *larray = (uint8_t *)lhs->array;
+        uint8_t *rarray = (uint8_t *)results->array;
+        ITERATOR_HEAD()
+            memcpy(larray, rarray, lhs->itemsize);
+            rarray += lhs->itemsize;
+        ITERATOR_TAIL(lhs, larray)
+    }
+    return MP_OBJ_FROM_PTR(lhs);
+}
+#endif /* NDARRAY_HAS_INPLACE_MULTIPLY || NDARRAY_HAS_INPLACE_TRUE_DIVIDE */
+
 #endif
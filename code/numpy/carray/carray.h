@@ -12,6 +12,7 @@
 #ifndef _CARRAY_
 #define _CARRAY_
 
+MP_DECLARE_CONST_FUN_OBJ_KW(carray_angle_obj);
 MP_DECLARE_CONST_FUN_OBJ_1(carray_real_obj);
 MP_DECLARE_CONST_FUN_OBJ_1(carray_imag_obj);
 MP_DECLARE_CONST_FUN_OBJ_1(carray_conjugate_obj);
@@ -27,6 +28,7 @@ mp_obj_t carray_binary_multiply(ndarray_obj_t *, ndarray_obj_t *, uint8_t , size
 mp_obj_t carray_binary_subtract(ndarray_obj_t *, ndarray_obj_t *, uint8_t , size_t *, int32_t *, int32_t *);
 mp_obj_t carray_binary_divide(ndarray_obj_t *, ndarray_obj_t *, uint8_t , size_t *, int32_t *, int32_t *);
 mp_obj_t carray_binary_equal_not_equal(ndarray_obj_t *, ndarray_obj_t *, uint8_t , size_t *, int32_t *, int32_t *, mp_binary_op_t );
+mp_obj_t carray_inplace_multiply_divide(ndarray_obj_t *, ndarray_obj_t *, int32_t *, mp_binary_op_t );
 
 #define BINARY_LOOP_COMPLEX1(results, resarray, type_right, larray, lstrides, rarray, rstrides, OPERATOR)\
     size_t l = 0;\
@@ -153,14 +153,42 @@ mp_obj_t compare_bincount(size_t n_args, const mp_obj_t *pos_args, mp_map_t *kw_
 MP_DEFINE_CONST_FUN_OBJ_KW(compare_bincount_obj, 1, compare_bincount);
 #endif /* ULAB_NUMPY_HAS_BINCOUNT */
 
+static uint8_t compare_scalar_type(mp_obj_t other) {
+    // integer scalars inherit the 32-bit type of the other operand, so that the comparison is exact;
+    // otherwise, the smallest type is chosen
+    #if ULAB_HAS_INT32
+    if(mp_obj_is_type(other, &ulab_ndarray_type)) {
+        ndarray_obj_t *ndarray = MP_OBJ_TO_PTR(other);
+        if(NDARRAY_IS_INT32(ndarray)) {
+            return ndarray->dtype;
+        }
+    }
+    #endif
+    return 0;
+}
+
 static mp_obj_t compare_function(mp_obj_t x1, mp_obj_t x2, uint8_t op) {
-    ndarray_obj_t *lhs = ndarray_from_mp_obj(x1, 0);
-    ndarray_obj_t *rhs = ndarray_from_mp_obj(x2, 0);
+    ndarray_obj_t *lhs = ndarray_from_mp_obj(x1, compare_scalar_type(x2));
+    ndarray_obj_t *rhs = ndarray_from_mp_obj(x2, compare_scalar_type(x1));
     #if ULAB_SUPPORTS_COMPLEX
     if((lhs->dtype == NDARRAY_COMPLEX) || (rhs->dtype == NDARRAY_COMPLEX)) {
         NOT_IMPLEMENTED_FOR_COMPLEX()
     }
     #endif
+    #if ULAB_HAS_FLOAT16
+    if((lhs->dtype == NDARRAY_FLOAT16) || (rhs->dtype == NDARRAY_FLOAT16)) {
+        // float16 is a storage type only: the comparison is carried out in floats, and
+        // the extrema of two float16 operands are converted back
+        bool half = (lhs->dtype == NDARRAY_FLOAT16) && (rhs->dtype == NDARRAY_FLOAT16);
+        FLOAT16_PROMOTE_TO_FLOAT(lhs);
+        FLOAT16_PROMOTE_TO_FLOAT(rhs);
+        mp_obj_t result = compare_function(MP_OBJ_FROM_PTR(lhs), MP_OBJ_FROM_PTR(rhs), op);
+        if(half && (op != COMPARE_EQUAL) && (op != COMPARE_NOT_EQUAL)) {
+            result = MP_OBJ_FROM_PTR(ndarray_copy_view_convert_type(MP_OBJ_TO_PTR(result), NDARRAY_FLOAT16));
+        }
+        return result;
+    }
+    #endif
     uint8_t ndim = 0;
     size_t *shape = m_new(size_t, ULAB_MAX_DIMS);
     int32_t *lstrides = m_new(int32_t, ULAB_MAX_DIMS);
@@ -175,6 +203,31 @@ static mp_obj_t compare_function(mp_obj_t x1, mp_obj_t x2, uint8_t op) {
     uint8_t *larray = (uint8_t *)lhs->array;
     uint8_t *rarray = (uint8_t *)rhs->array;
 
+    #if ULAB_HAS_INT32
+    if(NDARRAY_IS_INT32(lhs) || NDARRAY_IS_INT32(rhs)) {
+        if((op == COMPARE_EQUAL) || (op == COMPARE_NOT_EQUAL)) {
+            return ndarray_binary_op_int32(op == COMPARE_EQUAL ? MP_BINARY_OP_EQUAL : MP_BINARY_OP_NOT_EQUAL,
+                                            lhs, rhs, ndim, shape, lstrides, rstrides);
+        }
+        uint8_t dtype = ndarray_upcast_dtype(lhs->dtype, rhs->dtype);
+        if((lhs->dtype != dtype) || (rhs->dtype != dtype)) {
+            // bring the operands to the common type, and start over; float pairs are handled below
+            if(lhs->dtype != dtype) {
+                lhs = ndarray_int32_cast(lhs, dtype);
+            }
+            if(rhs->dtype != dtype) {
+                rhs = ndarray_int32_cast(rhs, dtype);
+            }
+            return compare_function(MP_OBJ_FROM_PTR(lhs), MP_OBJ_FROM_PTR(rhs), op);
+        }
+        if(dtype == NDARRAY_INT32) {
+            RUN_COMPARE_LOOP(NDARRAY_INT32, int32_t, int32_t, int32_t, larray, lstrides, rarray, rstrides, ndim, shape, op);
+        } else {
+            RUN_COMPARE_LOOP(NDARRAY_UINT32, uint32_t, uint32_t, uint32_t, larray, lstrides, rarray, rstrides, ndim, shape, op);
+        }
+    }
+    #endif
+
     if(op == COMPARE_EQUAL) {
         return ndarray_binary_equality(lhs, rhs, ndim, shape, lstrides, rstrides, MP_BINARY_OP_EQUAL);
     } else if(op == COMPARE_NOT_EQUAL) {
@@ -252,7 +305,7 @@ static mp_obj_t compare_function(mp_obj_t x1, mp_obj_t x2, uint8_t op) {
             RUN_COMPARE_LOOP(NDARRAY_FLOAT, mp_float_t, mp_float_t, mp_float_t, larray, lstrides, rarray, rstrides, ndim, shape, op);
         }
     }
-    return mp_const_none; // we should never reach this point
+    mp_raise_TypeError(MP_ERROR_TEXT("operation not supported for the input types"));
 }
 
 #if ULAB_NUMPY_HAS_EQUAL | ULAB_NUMPY_HAS_NOTEQUAL
@@ -270,10 +323,53 @@ static mp_obj_t compare_equal_helper(mp_obj_t x1, mp_obj_t x2, uint8_t comptype)
 #endif
 
 #if ULAB_NUMPY_HAS_CLIP
+#if ULAB_NUMPY_CLIP_IS_FUSED
+static void compare_clip_scalar(mp_obj_t obj, uint8_t dtype, void *buffer) {
+    // writes a scalar bound into buffer with the given dtype; integer bounds that are
+    // out of the range of dtype are saturated, so that the comparison is still correct
+    if(dtype == NDARRAY_FLOAT) {
+        *((mp_float_t *)buffer) = mp_obj_get_float(obj);
+        return;
+    }
+    mp_int_t value = mp_obj_get_int(obj);
+    if(dtype == NDARRAY_UINT8) {
+        *((uint8_t *)buffer) = value < 0 ? 0 : (value > UINT8_MAX ? UINT8_MAX : (uint8_t)value);
+    } else if(dtype == NDARRAY_INT8) {
+        *((int8_t *)buffer) = value < INT8_MIN ? INT8_MIN : (value > INT8_MAX ? INT8_MAX : (int8_t)value);
+    } else if(dtype == NDARRAY_UINT16) {
+        *((uint16_t *)buffer) = value < 0 ? 0 : (value > UINT16_MAX ? UINT16_MAX : (uint16_t)value);
+    } else if(dtype == NDARRAY_INT16) {
+        *((int16_t *)buffer) = value < INT16_MIN ? INT16_MIN : (value > INT16_MAX ? INT16_MAX : (int16_t)value);
+    #if ULAB_HAS_INT32
+    } else if(dtype == NDARRAY_UINT32) {
+        *((uint32_t *)buffer) = value < 0 ? 0 : (uint32_t)value;
+    } else if(dtype == NDARRAY_INT32) {
+        *((int32_t *)buffer) = (int32_t)value;
+    #endif
+    }
+}
+
+static ndarray_obj_t *compare_clip_broadcast(ndarray_obj_t *ndarray, uint8_t ndim, size_t *shape) {
+    // returns a view of ndarray that is broadcast to shape; the compatibility of the shapes
+    // has already been checked by the caller, so that the missing axes get a zero stride
+    int32_t *strides = m_new0(int32_t, ULAB_MAX_DIMS);
+    for(uint8_t j = 0; j < ULAB_MAX_DIMS; j++) {
+        if(ndarray->shape[j] == shape[j]) {
+            strides[j] = ndarray->strides[j];
+        }
+    }
+    ndarray = ndarray_new_view(ndarray, ndim, shape, strides, 0);
+    m_del(int32_t, strides, ULAB_MAX_DIMS);
+    return ndarray;
+}
+#endif /* ULAB_NUMPY_CLIP_IS_FUSED */
+
 //| def clip(
 //|     a: _ScalarOrArrayLike,
 //|     a_min: _ScalarOrArrayLike,
 //|     a_max: _ScalarOrArrayLike,
+//|     *,
+//|     out: Optional[ulab.numpy.ndarray] = None,
 //| ) -> _ScalarOrNdArray:
 //|     """
 //|     Clips (limits) the values in an array.
@@ -281,12 +377,176 @@ static mp_obj_t compare_equal_helper(mp_obj_t x1, mp_obj_t x2, uint8_t comptype)
 //|     :param a: Scalar or array containing elements to clip.
 //|     :param a_min: Minimum value, it will be broadcast against ``a``.
 //|     :param a_max: Maximum value, it will be broadcast against ``a``.
+//|     :param out: Optional array for the results. Only available, if
+//|         ``ULAB_NUMPY_CLIP_IS_FUSED`` is set.
 //|     :return:
 //|         A scalar or array with the elements of ``a``, but where
 //|         values < ``a_min`` are replaced with ``a_min``, and those
 //|         > ``a_max`` with ``a_max``.
 //|     """
 //|     ...
+#if ULAB_NUMPY_CLIP_IS_FUSED
+mp_obj_t compare_clip(size_t n_args, const mp_obj_t *pos_args, mp_map_t *kw_args) {
+    static const mp_arg_t allowed_args[] = {
+        { MP_QSTR_, MP_ARG_REQUIRED | MP_ARG_OBJ, { .u_rom_obj = MP_ROM_NONE } },
+        { MP_QSTR_, MP_ARG_REQUIRED | MP_ARG_OBJ, { .u_rom_obj = MP_ROM_NONE } },
+        { MP_QSTR_, MP_ARG_REQUIRED | MP_ARG_OBJ, { .u_rom_obj = MP_ROM_NONE } },
+        { MP_QSTR_out, MP_ARG_KW_ONLY | MP_ARG_OBJ, { .u_rom_obj = MP_ROM_NONE } },
+    };
+
+    mp_arg_val_t args[MP_ARRAY_SIZE(allowed_args)];
+    mp_arg_parse_all(n_args, pos_args, kw_args, MP_ARRAY_SIZE(allowed_args), allowed_args, args);
+
+    mp_obj_t bounds[2] = { args[1].u_obj, args[2].u_obj };
+    mp_obj_t out = args[3].u_obj;
+
+    if((bounds[0] == mp_const_none) && (bounds[1] == mp_const_none)) {
+        mp_raise_ValueError(MP_ERROR_TEXT("a_min and a_max cannot both be None"));
+    }
+
+    bool scalar_bounds = true;
+    for(uint8_t i = 0; i < 2; i++) {
+        if((bounds[i] != mp_const_none) && !mp_obj_is_int(bounds[i]) && !mp_obj_is_float(bounds[i])) {
+            scalar_bounds = false;
+        }
+    }
+
+    if((mp_obj_is_int(args[0].u_obj) || mp_obj_is_float(args[0].u_obj)) && scalar_bounds && (out == mp_const_none)) {
+        mp_float_t value = mp_obj_get_float(args[0].u_obj);
+        if((bounds[0] != mp_const_none) && (value < mp_obj_get_float(bounds[0]))) {
+            return bounds[0];
+        } else if((bounds[1] != mp_const_none) && (value > mp_obj_get_float(bounds[1]))) {
+            return bounds[1];
+        }
+        return args[0].u_obj;
+    }
+
+    ndarray_obj_t *ndarray = ndarray_from_mp_obj(args[0].u_obj, 0);
+    COMPLEX_DTYPE_NOT_IMPLEMENTED(ndarray->dtype)
+    FLOAT16_PROMOTE_TO_FLOAT(ndarray);
+
+    // the result inherits the dtype of a, unless a float scalar, or an array bound forces upcasting
+    uint8_t dtype = ndarray->dtype;
+    ndarray_obj_t *limits[2] = { NULL, NULL };
+    for(uint8_t i = 0; i < 2; i++) {
+        if(mp_obj_is_float(bounds[i])) {
+            dtype = NDARRAY_FLOAT;
+        } else if((bounds[i] != mp_const_none) && !mp_obj_is_int(bounds[i])) {
+            limits[i] = ndarray_from_mp_obj(bounds[i], 0);
+            COMPLEX_DTYPE_NOT_IMPLEMENTED(limits[i]->dtype)
+            dtype = ndarray_upcast_dtype(dtype, limits[i]->dtype);
+        }
+    }
+    if(ndarray->dtype != dtype) {
+        ndarray = ndarray_copy_view_convert_type(ndarray, dtype);
+    }
+
+    // a, and the array bounds are broadcast to a common shape
+    uint8_t ndim = ndarray->ndim;
+    size_t *shape = m_new0(size_t, ULAB_MAX_DIMS);
+    memcpy(shape, ndarray->shape, ULAB_MAX_DIMS * sizeof(size_t));
+    for(uint8_t i = 0; i < 2; i++) {
+        if(limits[i] == NULL) {
+            continue;
+        }
+        ndim = MAX(ndim, limits[i]->ndim);
+        for(uint8_t j = 0; j < ULAB_MAX_DIMS; j++) {
+            if((shape[j] < 2) || (limits[i]->shape[j] == shape[j])) {
+                shape[j] = MAX(shape[j], limits[i]->shape[j]);
+            } else if(limits[i]->shape[j] > 1) {
+                mp_raise_ValueError(MP_ERROR_TEXT("operands could not be broadcast together"));
+            }
+        }
+    }
+    if((limits[0] != NULL) || (limits[1] != NULL)) {
+        ndarray = compare_clip_broadcast(ndarray, ndim, shape);
+    }
+    m_del(size_t, shape, ULAB_MAX_DIMS);
+
+    // scalar bounds are converted only once, and are then read with a zero stride
+    mp_float_t scalars[2];
+    uint8_t *lo = NULL, *hi = NULL;
+    int32_t lostride = 0, histride = 0;
+    for(uint8_t i = 0; i < 2; i++) {
+        if(bounds[i] == mp_const_none) {
+            continue;
+        }
+        if(limits[i] == NULL) {
+            compare_clip_scalar(bounds[i], dtype, &scalars[i]);
+        } else {
+            if(limits[i]->dtype != dtype) {
+                limits[i] = ndarray_copy_view_convert_type(limits[i], dtype);
+            }
+            limits[i] = compare_clip_broadcast(limits[i], ndarray->ndim, ndarray->shape);
+        }
+    }
+
+    ndarray_obj_t *results;
+    if(out == mp_const_none) {
+        results = ndarray_new_dense_ndarray_uninitialised(ndarray->ndim, ndarray->shape, dtype);
+    } else {
+        results = ulab_tools_inspect_out(out, dtype, ndarray->ndim, ndarray->shape, false);
+    }
+    if(ndarray->len == 0) {
+        return MP_OBJ_FROM_PTR(results);
+    }
+
+    size_t len = ndarray->shape[ULAB_MAX_DIMS - 1];
+    size_t lines = ndarray->len / len;
+    int32_t astride = ndarray->strides[ULAB_MAX_DIMS - 1];
+    int32_t rstride = results->strides[ULAB_MAX_DIMS - 1];
+    if((limits[0] == NULL) && (limits[1] == NULL) && ndarray_is_dense(ndarray) && ndarray_is_dense(results)) {
+        // the most common case: everything can be treated as a single line
+        len = ndarray->len;
+        lines = 1;
+    }
+    if(limits[0] != NULL) {
+        lostride = limits[0]->strides[ULAB_MAX_DIMS - 1];
+    }
+    if(limits[1] != NULL) {
+        histride = limits[1]->strides[ULAB_MAX_DIMS - 1];
+    }
+
+    for(size_t line = 0; line < lines; line++) {
+        uint8_t *array = (uint8_t *)ndarray->array + tools_line_offset(ndarray, ULAB_MAX_DIMS - 1, line);
+        uint8_t *rarray = (uint8_t *)results->array + tools_line_offset(results, ULAB_MAX_DIMS - 1, line);
+        for(uint8_t i = 0; i < 2; i++) {
+            uint8_t *bound = NULL;
+            if(limits[i] != NULL) {
+                bound = (uint8_t *)limits[i]->array + tools_line_offset(limits[i], ULAB_MAX_DIMS - 1, line);
+            } else if(bounds[i] != mp_const_none) {
+                bound = (uint8_t *)&scalars[i];
+            }
+            if(i == 0) {
+                lo = bound;
+            } else {
+                hi = bound;
+            }
+        }
+
+        if(dtype == NDARRAY_UINT8) {
+            COMPARE_CLIP_LINE(uint8_t, array, astride, lo, lostride, hi, histride, rarray, rstride, len);
+        } else if(dtype == NDARRAY_INT8) {
+            COMPARE_CLIP_LINE(int8_t, array, astride, lo, lostride, hi, histride, rarray, rstride, len);
+        } else if(dtype == NDARRAY_UINT16) {
+            COMPARE_CLIP_LINE(uint16_t, array, astride, lo, lostride, hi, histride, rarray, rstride, len);
+        } else if(dtype == NDARRAY_INT16) {
+            COMPARE_CLIP_LINE(int16_t, array, astride, lo, lostride, hi, histride, rarray, rstride, len);
+        #if ULAB_HAS_INT32
+        } else if(dtype == NDARRAY_UINT32) {
+            COMPARE_CLIP_LINE(uint32_t, array, astride, lo, lostride, hi, histride, rarray, rstride, len);
+        } else if(dtype == NDARRAY_INT32) {
+            COMPARE_CLIP_LINE(int32_t, array, astride, lo, lostride, hi, histride, rarray, rstride, len);
+        #endif
+        } else {
+            COMPARE_CLIP_LINE(mp_float_t, array, astride, lo, lostride, hi, histride, rarray, rstride, len);
+        }
+    }
+    return MP_OBJ_FROM_PTR(results);
+}
+
+MP_DEFINE_CONST_FUN_OBJ_KW(compare_clip_obj, 3, compare_clip);
+#else
 mp_obj_t compare_clip(mp_obj_t x1, mp_obj_t x2, mp_obj_t x3) {
     // Note: this function could be made faster by implementing a single-loop comparison in
     // RUN_COMPARE_LOOP. However, that would add around 2 kB of compile size, while we
@@ -309,6 +569,7 @@ mp_obj_t compare_clip(mp_obj_t x1, mp_obj_t x2, mp_obj_t x3) {
 }
 
 MP_DEFINE_CONST_FUN_OBJ_3(compare_clip_obj, compare_clip);
+#endif /* ULAB_NUMPY_CLIP_IS_FUSED */
 #endif
 
 #if ULAB_NUMPY_HAS_EQUAL
@@ -377,6 +638,8 @@ static mp_obj_t compare_isinf_isfinite(mp_obj_t _x, uint8_t mask) {
     } else if(mp_obj_is_type(_x, &ulab_ndarray_type)) {
         ndarray_obj_t *x = MP_OBJ_TO_PTR(_x);
         COMPLEX_DTYPE_NOT_IMPLEMENTED(x->dtype)
+        // float16 can also hold infinities, and NaNs
+        FLOAT16_PROMOTE_TO_FLOAT(x);
         ndarray_obj_t *results = ndarray_new_dense_ndarray(x->ndim, x->shape, NDARRAY_BOOL);
         // At this point, results is all False
         uint8_t *rarray = (uint8_t *)results->array;
@@ -460,7 +723,7 @@ mp_obj_t compare_maximum(mp_obj_t x1, mp_obj_t x2) {
     mp_obj_t result = compare_function(x1, x2, COMPARE_MAXIMUM);
     if((mp_obj_is_int(x1) || mp_obj_is_float(x1)) && (mp_obj_is_int(x2) || mp_obj_is_float(x2))) {
         ndarray_obj_t *ndarray = MP_OBJ_TO_PTR(result);
-        return mp_binary_get_val_array(ndarray->dtype, ndarray->array, 0);
+        return ndarray_get_value(ndarray->dtype, ndarray->array, 0);
     }
     return result;
 }
@@ -487,7 +750,7 @@ mp_obj_t compare_minimum(mp_obj_t x1, mp_obj_t x2) {
     mp_obj_t result = compare_function(x1, x2, COMPARE_MINIMUM);
     if((mp_obj_is_int(x1) || mp_obj_is_float(x1)) && (mp_obj_is_int(x2) || mp_obj_is_float(x2))) {
         ndarray_obj_t *ndarray = MP_OBJ_TO_PTR(result);
-        return mp_binary_get_val_array(ndarray->dtype, ndarray->array, 0);
+        return ndarray_get_value(ndarray->dtype, ndarray->array, 0);
     }
     return result;
 }
@@ -495,6 +758,98 @@ mp_obj_t compare_minimum(mp_obj_t x1, mp_obj_t x2) {
 MP_DEFINE_CONST_FUN_OBJ_2(compare_minimum_obj, compare_minimum);
 #endif
 
+#if ULAB_NUMPY_HAS_NONZERO | ULAB_NUMPY_HAS_FLATNONZERO
+static uint8_t compare_nonzero_index_dtype(size_t n) {
+    // indices are returned as uint16, if they fit, otherwise, as uint32, if the firmware supports it,
+    // and as floats, as long as the floats can represent each index exactly
+    if(n <= 65536) {
+        return NDARRAY_UINT16;
+    }
+    #if ULAB_HAS_INT32
+    return NDARRAY_UINT32;
+    #else
+    #if MICROPY_FLOAT_IMPL == MICROPY_FLOAT_IMPL_FLOAT
+    if(n > (1UL << 24)) {
+        mp_raise_ValueError(MP_ERROR_TEXT("indices cannot be represented exactly"));
+    }
+    #endif
+    return NDARRAY_FLOAT;
+    #endif
+}
+
+static inline void compare_nonzero_store_index(ndarray_obj_t *ndarray, size_t i, size_t value) {
+    if(ndarray->dtype == NDARRAY_UINT16) {
+        ((uint16_t *)ndarray->array)[i] = (uint16_t)value;
+    #if ULAB_HAS_INT32
+    } else if(ndarray->dtype == NDARRAY_UINT32) {
+        ((uint32_t *)ndarray->array)[i] = (uint32_t)value;
+    #endif
+    } else {
+        ((mp_float_t *)ndarray->array)[i] = (mp_float_t)value;
+    }
+}
+
+static size_t compare_nonzero_scan(ndarray_obj_t *ndarray, ndarray_obj_t **results, ndarray_obj_t *flat) {
+    size_t count = 0;
+    if(ndarray->len == 0) {
+        return count;
+    }
+    if(ndarray->dtype == NDARRAY_UINT8) {
+        COMPARE_NONZERO_SCAN(uint8_t, COMPARE_IS_NONZERO, ndarray, results, flat, count);
+    } else if(ndarray->dtype == NDARRAY_INT8) {
+        COMPARE_NONZERO_SCAN(int8_t, COMPARE_IS_NONZERO, ndarray, results, flat, count);
+    } else if(ndarray->dtype == NDARRAY_UINT16) {
+        COMPARE_NONZERO_SCAN(uint16_t, COMPARE_IS_NONZERO, ndarray, results, flat, count);
+    } else if(ndarray->dtype == NDARRAY_INT16) {
+        COMPARE_NONZERO_SCAN(int16_t, COMPARE_IS_NONZERO, ndarray, results, flat, count);
+    #if ULAB_HAS_INT32
+    } else if(NDARRAY_IS_INT32(ndarray)) {
+        // the signedness is irrelevant, when only the zeros are sought
+        COMPARE_NONZERO_SCAN(uint32_t, COMPARE_IS_NONZERO, ndarray, results, flat, count);
+    #endif
+    #if ULAB_HAS_FLOAT16
+    } else if(ndarray->dtype == NDARRAY_FLOAT16) {
+        COMPARE_NONZERO_SCAN(uint16_t, COMPARE_FLOAT16_IS_NONZERO, ndarray, results, flat, count);
+    #endif
+    #if ULAB_SUPPORTS_COMPLEX
+    } else if(ndarray->dtype == NDARRAY_COMPLEX) {
+        COMPARE_NONZERO_SCAN(mp_float_t, COMPARE_COMPLEX_IS_NONZERO, ndarray, results, flat, count);
+    #endif
+    } else {
+        COMPARE_NONZERO_SCAN(mp_float_t, COMPARE_IS_NONZERO, ndarray, results, flat, count);
+    }
+    return count;
+}
+#endif /* ULAB_NUMPY_HAS_NONZERO | ULAB_NUMPY_HAS_FLATNONZERO */
+
+#if ULAB_NUMPY_HAS_FLATNONZERO
+
+//| def flatnonzero(x: _ScalarOrArrayLike) -> ulab.numpy.ndarray:
+//|     """
+//|     Returns the indices of elements that are non-zero in the flattened array.
+//|
+//|     :param x:
+//|         Input scalar or array.
+//|     :return:
+//|         A one-dimensional array of indices. The indices are of type uint16,
+//|         if the array has at most 65536 elements, and uint32, or, if the
+//|         firmware has no 32-bit integers, float otherwise.
+//|     """
+//|     ...
+mp_obj_t compare_flatnonzero(mp_obj_t x) {
+    ndarray_obj_t *ndarray = ndarray_from_mp_obj(x, 0);
+
+    size_t count = compare_nonzero_scan(ndarray, NULL, NULL);
+    ndarray_obj_t *results = ndarray_new_linear_array(count, compare_nonzero_index_dtype(ndarray->len));
+    if(count) {
+        compare_nonzero_scan(ndarray, NULL, results);
+    }
+    return MP_OBJ_FROM_PTR(results);
+}
+
+MP_DEFINE_CONST_FUN_OBJ_1(compare_flatnonzero_obj, compare_flatnonzero);
+#endif /* ULAB_NUMPY_HAS_FLATNONZERO */
+
 #if ULAB_NUMPY_HAS_NONZERO
 
 //| def nonzero(x: _ScalarOrArrayLike) -> ulab.numpy.ndarray:
@@ -505,131 +860,28 @@ MP_DEFINE_CONST_FUN_OBJ_2(compare_minimum_obj, compare_minimum);
 //|         Input scalar or array. If ``x`` is a scalar, it is treated
 //|         as a single-element 1-d array.
 //|     :return:
-//|         An array of indices that are non-zero.
+//|         A tuple of arrays of indices that are non-zero, one for each
+//|         dimension. The indices are of type uint16, if they fit, and
+//|         uint32, or, if the firmware has no 32-bit integers, float otherwise.
 //|     """
 //|     ...
 mp_obj_t compare_nonzero(mp_obj_t x) {
-    ndarray_obj_t *ndarray_x = ndarray_from_mp_obj(x, 0);
-    // since ndarray_new_linear_array calls m_new0, the content of zero is a single zero
-    ndarray_obj_t *zero = ndarray_new_linear_array(1, NDARRAY_UINT8);
-
-    uint8_t ndim = 0;
-    size_t *shape = m_new(size_t, ULAB_MAX_DIMS);
-    int32_t *x_strides = m_new(int32_t, ULAB_MAX_DIMS);
-    int32_t *zero_strides = m_new(int32_t, ULAB_MAX_DIMS);
-    // we don't actually have to inspect the outcome of ndarray_can_broadcast,
-    // because the right hand side is a linear array with a single element
-    ndarray_can_broadcast(ndarray_x, zero, &ndim, shape, x_strides, zero_strides);
-
-    // equal_obj is a Boolean ndarray
-    mp_obj_t equal_obj = ndarray_binary_equality(ndarray_x, zero, ndim, shape, x_strides, zero_strides, MP_BINARY_OP_NOT_EQUAL);
-    ndarray_obj_t *ndarray = MP_OBJ_TO_PTR(equal_obj);
-
-    // these are no longer needed, get rid of them
-    m_del(size_t, shape, ULAB_MAX_DIMS);
-    m_del(int32_t, x_strides, ULAB_MAX_DIMS);
-    m_del(int32_t, zero_strides, ULAB_MAX_DIMS);
-
-    uint8_t *array = (uint8_t *)ndarray->array;
-    uint8_t *origin = (uint8_t *)ndarray->array;
+    ndarray_obj_t *ndarray = ndarray_from_mp_obj(x, 0);
 
-    // First, count the number of Trues:
-    uint16_t count = 0;
-    size_t indices[ULAB_MAX_DIMS];
-
-    #if ULAB_MAX_DIMS > 3
-    indices[3] = 0;
-    do {
-    #endif
-        #if ULAB_MAX_DIMS > 2
-        indices[2] = 0;
-        do {
-        #endif
-            #if ULAB_MAX_DIMS > 1
-            indices[1] = 0;
-            do {
-            #endif
-                indices[0] = 0;
-                do {
-                    if(*array != 0) {
-                        count++;
-                    }
-                    array += ndarray->strides[ULAB_MAX_DIMS - 1];
-                    indices[0]++;
-                } while(indices[0] < ndarray->shape[ULAB_MAX_DIMS - 1]);
-            #if ULAB_MAX_DIMS > 1
-                array -= ndarray->strides[ULAB_MAX_DIMS - 1] * ndarray->shape[ULAB_MAX_DIMS-1];
-                array += ndarray->strides[ULAB_MAX_DIMS - 2];
-                indices[1]++;
-            } while(indices[1] < ndarray->shape[ULAB_MAX_DIMS - 2]);
-            #endif
-        #if ULAB_MAX_DIMS > 2
-            array -= ndarray->strides[ULAB_MAX_DIMS - 2] * ndarray->shape[ULAB_MAX_DIMS-2];
-            array += ndarray->strides[ULAB_MAX_DIMS - 3];
-            indices[2]++;
-        } while(indices[2] < ndarray->shape[ULAB_MAX_DIMS - 3]);
-        #endif
-    #if ULAB_MAX_DIMS > 3
-        array -= ndarray->strides[ULAB_MAX_DIMS - 3] * ndarray->shape[ULAB_MAX_DIMS-3];
-        array += ndarray->strides[ULAB_MAX_DIMS - 4];
-        indices[3]++;
-    } while(indices[3] < ndarray->shape[ULAB_MAX_DIMS - 4]);
-    #endif
+    // the source is scanned directly, there is no need for a temporary Boolean array
+    size_t count = compare_nonzero_scan(ndarray, NULL, NULL);
 
     mp_obj_t *items = m_new(mp_obj_t, ndarray->ndim);
-    uint16_t *arrays[ULAB_MAX_DIMS];
+    ndarray_obj_t *results[ULAB_MAX_DIMS];
 
-    for(uint8_t i = 0; i < ndarray->ndim; i++) {
-        ndarray_obj_t *item_array = ndarray_new_linear_array(count, NDARRAY_UINT16);
-        uint16_t *iarray = (uint16_t *)item_array->array;
-        arrays[ULAB_MAX_DIMS - 1 - i] = iarray;
-        items[ndarray->ndim - 1 - i] = MP_OBJ_FROM_PTR(item_array);
+    for(uint8_t d = 0; d < ndarray->ndim; d++) {
+        uint8_t dtype = compare_nonzero_index_dtype(ndarray->shape[ULAB_MAX_DIMS - ndarray->ndim + d]);
+        results[d] = ndarray_new_linear_array(count, dtype);
+        items[d] = MP_OBJ_FROM_PTR(results[d]);
+    }
+    if(count) {
+        compare_nonzero_scan(ndarray, results, NULL);
     }
-    array = origin;
-    count = 0;
-
-    #if ULAB_MAX_DIMS > 3
-    indices[3] = 0;
-    do {
-    #endif
-        #if ULAB_MAX_DIMS > 2
-        indices[2] = 0;
-        do {
-        #endif
-            #if ULAB_MAX_DIMS > 1
-            indices[1] = 0;
-            do {
-            #endif
-                indices[0] = 0;
-                do {
-                    if(*array != 0) {
-                        for(uint8_t d = 0; d < ndarray->ndim; d++) {
-                            arrays[ULAB_MAX_DIMS - 1 - d][count] = indices[d];
-                        }
-                        count++;
-                    }
-                    array += ndarray->strides[ULAB_MAX_DIMS - 1];
-                    indices[0]++;
-                } while(indices[0] < ndarray->shape[ULAB_MAX_DIMS - 1]);
-            #if ULAB_MAX_DIMS > 1
-                array -= ndarray->strides[ULAB_MAX_DIMS - 1] * ndarray->shape[ULAB_MAX_DIMS-1];
-                array += ndarray->strides[ULAB_MAX_DIMS - 2];
-                indices[1]++;
-            } while(indices[1] < ndarray->shape[ULAB_MAX_DIMS - 2]);
-            #endif
-        #if ULAB_MAX_DIMS > 2
-            array -= ndarray->strides[ULAB_MAX_DIMS - 2] * ndarray->shape[ULAB_MAX_DIMS-2];
-            array += ndarray->strides[ULAB_MAX_DIMS - 3];
-            indices[2]++;
-        } while(indices[2] < ndarray->shape[ULAB_MAX_DIMS - 3]);
-        #endif
-    #if ULAB_MAX_DIMS > 3
-        array -= ndarray->strides[ULAB_MAX_DIMS - 3] * ndarray->shape[ULAB_MAX_DIMS-3];
-        array += ndarray->strides[ULAB_MAX_DIMS - 4];
-        indices[3]++;
-    } while(indices[3] < ndarray->shape[ULAB_MAX_DIMS - 4]);
-    #endif
-
     return mp_obj_new_tuple(ndarray->ndim, items);
 }
 
@@ -638,10 +890,60 @@ MP_DEFINE_CONST_FUN_OBJ_1(compare_nonzero_obj, compare_nonzero);
 
 #if ULAB_NUMPY_HAS_WHERE
 
+static ndarray_obj_t *compare_where_operand(mp_obj_t obj, ndarray_obj_t *scalar, mp_float_t *buffer) {
+    // scalars are held in a single-element array on the stack, so that they do not have
+    // to be boxed on the heap; the dtype is the smallest one that holds the value, i.e., what
+    // ndarray_from_mp_obj returns with other_type = 0: where has no single other operand,
+    // whose 32-bit dtype a scalar could inherit, hence, large integers are held in a float
+    uint8_t dtype;
+    if(mp_obj_is_int(obj)) {
+        int32_t ivalue = mp_obj_get_int(obj);
+        if((ivalue < -32768) || (ivalue > 65535)) {
+            dtype = NDARRAY_FLOAT;
+            *buffer = (mp_float_t)ivalue;
+        } else {
+            if(ivalue < 0) {
+                dtype = ivalue >= -128 ? NDARRAY_INT8 : NDARRAY_INT16;
+            } else {
+                dtype = ivalue < 256 ? NDARRAY_UINT8 : NDARRAY_UINT16;
+            }
+            ndarray_set_value(dtype, buffer, 0, obj);
+        }
+    } else if(mp_obj_is_float(obj)) {
+        dtype = NDARRAY_FLOAT;
+        *buffer = mp_obj_get_float(obj);
+    } else if(mp_obj_is_bool(obj)) {
+        dtype = NDARRAY_BOOL;
+        *((uint8_t *)buffer) = obj == mp_const_true ? 1 : 0;
+    } else {
+        return ndarray_from_mp_obj(obj, 0);
+    }
+    memset(scalar, 0, sizeof(ndarray_obj_t));
+    scalar->base.type = &ulab_ndarray_type;
+    scalar->dtype = dtype == NDARRAY_BOOL ? NDARRAY_UINT8 : dtype;
+    scalar->boolean = dtype == NDARRAY_BOOL ? NDARRAY_BOOLEAN : NDARRAY_NUMERIC;
+    scalar->itemsize = ulab_binary_get_size(dtype);
+    scalar->ndim = 1;
+    scalar->len = 1;
+    scalar->shape[ULAB_MAX_DIMS - 1] = 1;
+    scalar->strides[ULAB_MAX_DIMS - 1] = scalar->itemsize;
+    scalar->array = buffer;
+    scalar->origin = buffer;
+    return scalar;
+}
+
+static bool compare_where_is_dense(ndarray_obj_t *ndarray, ndarray_obj_t *out) {
+    // an operand can be walked linearly, if it is either a single element, or has the
+    // shape of the output, and its elements follow each other without gaps
+    return (ndarray->len == 1) || ((ndarray->len == out->len) && ndarray_is_contiguous(ndarray));
+}
+
 //| def where(
 //|     condition: _ScalarOrArrayLike,
 //|     x: _ScalarOrArrayLike,
 //|     y: _ScalarOrArrayLike,
+//|     *,
+//|     out: Optional[ulab.numpy.ndarray] = None
 //|     ) -> ulab.numpy.ndarray:
 //|     """
 //|     Returns elements from ``x`` or ``y`` depending on ``condition``.
@@ -654,26 +956,39 @@ MP_DEFINE_CONST_FUN_OBJ_1(compare_nonzero_obj, compare_nonzero);
 //|         shape.)
 //|     :param x, y:
 //|         Input scalar or array.
+//|     :param out:
+//|         Optional array of the output shape, into which the results are
+//|         written. The values are converted to the dtype of ``out``. ``out``
+//|         can be identical to ``x``, or ``y``.
 //|     :return:
 //|         An array with elements from ``x`` when ``condition`` is
 //|         truthy, and ``y`` elsewhere.
 //|     """
 //|     ...
-mp_obj_t compare_where(mp_obj_t _condition, mp_obj_t _x, mp_obj_t _y) {
+mp_obj_t compare_where(size_t n_args, const mp_obj_t *pos_args, mp_map_t *kw_args) {
+    static const mp_arg_t allowed_args[] = {
+        { MP_QSTR_, MP_ARG_REQUIRED | MP_ARG_OBJ, { .u_rom_obj = MP_ROM_NONE } },
+        { MP_QSTR_, MP_ARG_REQUIRED | MP_ARG_OBJ, { .u_rom_obj = MP_ROM_NONE } },
+        { MP_QSTR_, MP_ARG_REQUIRED | MP_ARG_OBJ, { .u_rom_obj = MP_ROM_NONE } },
+        { MP_QSTR_out, MP_ARG_KW_ONLY | MP_ARG_OBJ, { .u_rom_obj = MP_ROM_NONE } },
+    };
+
+    mp_arg_val_t args[MP_ARRAY_SIZE(allowed_args)];
+    mp_arg_parse_all(n_args, pos_args, kw_args, MP_ARRAY_SIZE(allowed_args), allowed_args, args);
+
     // this implementation will work with ndarrays, and scalars only
-    ndarray_obj_t *c = ndarray_from_mp_obj(_condition, 0);
-    ndarray_obj_t *x = ndarray_from_mp_obj(_x, 0);
-    ndarray_obj_t *y = ndarray_from_mp_obj(_y, 0);
+    ndarray_obj_t cscalar, xscalar, yscalar;
+    mp_float_t cbuffer, xbuffer, ybuffer;
+    ndarray_obj_t *c = compare_where_operand(args[0].u_obj, &cscalar, &cbuffer);
+    ndarray_obj_t *x = compare_where_operand(args[1].u_obj, &xscalar, &xbuffer);
+    ndarray_obj_t *y = compare_where_operand(args[2].u_obj, &yscalar, &ybuffer);
 
     COMPLEX_DTYPE_NOT_IMPLEMENTED(c->dtype)
     COMPLEX_DTYPE_NOT_IMPLEMENTED(x->dtype)
     COMPLEX_DTYPE_NOT_IMPLEMENTED(y->dtype)
 
-    int32_t *cstrides = m_new(int32_t, ULAB_MAX_DIMS);
-    int32_t *xstrides = m_new(int32_t, ULAB_MAX_DIMS);
-    int32_t *ystrides = m_new(int32_t, ULAB_MAX_DIMS);
-
-    size_t *oshape = m_new(size_t, ULAB_MAX_DIMS);
+    int32_t cstrides[ULAB_MAX_DIMS], xstrides[ULAB_MAX_DIMS], ystrides[ULAB_MAX_DIMS];
+    size_t oshape[ULAB_MAX_DIMS];
 
     uint8_t ndim;
 
@@ -695,8 +1010,64 @@ mp_obj_t compare_where(mp_obj_t _condition, mp_obj_t _x, mp_obj_t _y) {
         oshape[ULAB_MAX_DIMS - i] = MAX(MAX(c->shape[ULAB_MAX_DIMS - i], x->shape[ULAB_MAX_DIMS - i]), y->shape[ULAB_MAX_DIMS - i]);
     }
 
-    uint8_t out_dtype = ndarray_upcast_dtype(x->dtype, y->dtype);
-    ndarray_obj_t *out = ndarray_new_dense_ndarray(ndim, oshape, out_dtype);
+    ndarray_obj_t *out;
+    if(args[3].u_obj == mp_const_none) {
+        out = ndarray_new_dense_ndarray(ndim, oshape, ndarray_upcast_dtype(x->dtype, y->dtype));
+    } else {
+        if(!mp_obj_is_type(args[3].u_obj, &ulab_ndarray_type)) {
+            mp_raise_TypeError(MP_ERROR_TEXT("out has wrong type"));
+        }
+        ndarray_obj_t *_out = MP_OBJ_TO_PTR(args[3].u_obj);
+        out = ulab_tools_inspect_out(args[3].u_obj, _out->dtype, ndim, oshape, false);
+    }
+
+    #if ULAB_HAS_INT32
+    if(NDARRAY_IS_INT32(out)) {
+        // 32-bit integers might be rounded on their way through a float, hence, integer operands
+        // are converted to the type of the output, and their elements are copied below
+        if((x->dtype != out->dtype) && !NDARRAY_IS_FLOATING(x->dtype)) {
+            x = ndarray_int32_cast(x, out->dtype);
+        }
+        if((y->dtype != out->dtype) && !NDARRAY_IS_FLOATING(y->dtype)) {
+            y = ndarray_int32_cast(y, out->dtype);
+        }
+        for(uint8_t i = 1; i <= ndim; i++) {
+            xstrides[ULAB_MAX_DIMS - i] = x->shape[ULAB_MAX_DIMS - i] < 2 ? 0 : x->strides[ULAB_MAX_DIMS - i];
+            ystrides[ULAB_MAX_DIMS - i] = y->shape[ULAB_MAX_DIMS - i] < 2 ? 0 : y->strides[ULAB_MAX_DIMS - i];
+        }
+    }
+    #endif
+
+    if((out->dtype == NDARRAY_FLOAT) && (x->dtype == NDARRAY_FLOAT) && (y->dtype == NDARRAY_FLOAT) &&
+        ((c->dtype == NDARRAY_FLOAT) || (c->dtype == NDARRAY_UINT8)) &&
+        ndarray_is_contiguous(out) && compare_where_is_dense(c, out) &&
+        compare_where_is_dense(x, out) && compare_where_is_dense(y, out)) {
+        // typed fast path for dense float arrays, or scalars
+        mp_float_t *oarray = (mp_float_t *)out->array;
+        mp_float_t *xarray = (mp_float_t *)x->array;
+        mp_float_t *yarray = (mp_float_t *)y->array;
+        uint8_t xinc = x->len == 1 ? 0 : 1;
+        uint8_t yinc = y->len == 1 ? 0 : 1;
+        uint8_t cinc = c->len == 1 ? 0 : 1;
+        if(c->dtype == NDARRAY_FLOAT) {
+            mp_float_t *carray = (mp_float_t *)c->array;
+            for(size_t i = 0; i < out->len; i++) {
+                *oarray++ = *carray != MICROPY_FLOAT_CONST(0.0) ? *xarray : *yarray;
+                carray += cinc;
+                xarray += xinc;
+                yarray += yinc;
+            }
+        } else {
+            uint8_t *carray = (uint8_t *)c->array;
+            for(size_t i = 0; i < out->len; i++) {
+                *oarray++ = *carray ? *xarray : *yarray;
+                carray += cinc;
+                xarray += xinc;
+                yarray += yinc;
+            }
+        }
+        return MP_OBJ_FROM_PTR(out);
+    }
 
     mp_float_t (*cfunc)(void *) = ndarray_get_float_function(c->dtype);
     mp_float_t (*xfunc)(void *) = ndarray_get_float_function(x->dtype);
@@ -707,6 +1078,8 @@ mp_obj_t compare_where(mp_obj_t _condition, mp_obj_t _x, mp_obj_t _y) {
     uint8_t *carray = (uint8_t *)c->array;
     uint8_t *xarray = (uint8_t *)x->array;
     uint8_t *yarray = (uint8_t *)y->array;
+    // if no conversion is needed, the elements are copied, and not read through a float
+    bool copy = (x->dtype == out->dtype) && (y->dtype == out->dtype);
 
     #if ULAB_MAX_DIMS > 3
     size_t i = 0;
@@ -722,21 +1095,23 @@ mp_obj_t compare_where(mp_obj_t _condition, mp_obj_t _x, mp_obj_t _y) {
             #endif
                 size_t l = 0;
                 do {
-                    mp_float_t value;
                     mp_float_t cvalue = cfunc(carray);
-                    if(cvalue != MICROPY_FLOAT_CONST(0.0)) {
-                        value = xfunc(xarray);
+                    if(copy) {
+                        memcpy(oarray, cvalue != MICROPY_FLOAT_CONST(0.0) ? xarray : yarray, out->itemsize);
+                    } else if(cvalue != MICROPY_FLOAT_CONST(0.0)) {
+                        ofunc(oarray, xfunc(xarray));
                     } else {
-                        value = yfunc(yarray);
+                        ofunc(oarray, yfunc(yarray));
                     }
-                    ofunc(oarray, value);
-                    oarray += out->itemsize;
+                    oarray += out->strides[ULAB_MAX_DIMS - 1];
                     carray += cstrides[ULAB_MAX_DIMS - 1];
                     xarray += xstrides[ULAB_MAX_DIMS - 1];
                     yarray += ystrides[ULAB_MAX_DIMS - 1];
                     l++;
                 } while(l < out->shape[ULAB_MAX_DIMS - 1]);
             #if ULAB_MAX_DIMS > 1
+                oarray -= out->strides[ULAB_MAX_DIMS - 1] * out->shape[ULAB_MAX_DIMS-1];
+                oarray += out->strides[ULAB_MAX_DIMS - 2];
                 carray -= cstrides[ULAB_MAX_DIMS - 1] * c->shape[ULAB_MAX_DIMS-1];
                 carray += cstrides[ULAB_MAX_DIMS - 2];
                 xarray -= xstrides[ULAB_MAX_DIMS - 1] * x->shape[ULAB_MAX_DIMS-1];
@@ -747,6 +1122,8 @@ mp_obj_t compare_where(mp_obj_t _condition, mp_obj_t _x, mp_obj_t _y) {
             } while(k < out->shape[ULAB_MAX_DIMS - 2]);
             #endif
         #if ULAB_MAX_DIMS > 2
+            oarray -= out->strides[ULAB_MAX_DIMS - 2] * out->shape[ULAB_MAX_DIMS-2];
+            oarray += out->strides[ULAB_MAX_DIMS - 3];
             carray -= cstrides[ULAB_MAX_DIMS - 2] * c->shape[ULAB_MAX_DIMS-2];
             carray += cstrides[ULAB_MAX_DIMS - 3];
             xarray -= xstrides[ULAB_MAX_DIMS - 2] * x->shape[ULAB_MAX_DIMS-2];
@@ -757,6 +1134,8 @@ mp_obj_t compare_where(mp_obj_t _condition, mp_obj_t _x, mp_obj_t _y) {
         } while(j < out->shape[ULAB_MAX_DIMS - 3]);
         #endif
     #if ULAB_MAX_DIMS > 3
+        oarray -= out->strides[ULAB_MAX_DIMS - 3] * out->shape[ULAB_MAX_DIMS-3];
+        oarray += out->strides[ULAB_MAX_DIMS - 4];
         carray -= cstrides[ULAB_MAX_DIMS - 3] * c->shape[ULAB_MAX_DIMS-3];
         carray += cstrides[ULAB_MAX_DIMS - 4];
         xarray -= xstrides[ULAB_MAX_DIMS - 3] * x->shape[ULAB_MAX_DIMS-3];
@@ -769,5 +1148,5 @@ mp_obj_t compare_where(mp_obj_t _condition, mp_obj_t _x, mp_obj_t _y) {
     return MP_OBJ_FROM_PTR(out);
 }
 
-MP_DEFINE_CONST_FUN_OBJ_3(compare_where_obj, compare_where);
+MP_DEFINE_CONST_FUN_OBJ_KW(compare_where_obj, 3, compare_where);
 #endif
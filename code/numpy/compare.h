@@ -24,15 +24,67 @@ enum COMPARE_FUNCTION_TYPE {
 };
 
 MP_DECLARE_CONST_FUN_OBJ_KW(compare_bincount_obj);
+#if ULAB_NUMPY_CLIP_IS_FUSED
+MP_DECLARE_CONST_FUN_OBJ_KW(compare_clip_obj);
+#else
 MP_DECLARE_CONST_FUN_OBJ_3(compare_clip_obj);
+#endif
 MP_DECLARE_CONST_FUN_OBJ_2(compare_equal_obj);
+MP_DECLARE_CONST_FUN_OBJ_1(compare_flatnonzero_obj);
 MP_DECLARE_CONST_FUN_OBJ_2(compare_isfinite_obj);
 MP_DECLARE_CONST_FUN_OBJ_2(compare_isinf_obj);
 MP_DECLARE_CONST_FUN_OBJ_2(compare_minimum_obj);
 MP_DECLARE_CONST_FUN_OBJ_2(compare_maximum_obj);
 MP_DECLARE_CONST_FUN_OBJ_1(compare_nonzero_obj);
 MP_DECLARE_CONST_FUN_OBJ_2(compare_not_equal_obj);
-MP_DECLARE_CONST_FUN_OBJ_3(compare_where_obj);
+MP_DECLARE_CONST_FUN_OBJ_KW(compare_where_obj);
+
+#define COMPARE_IS_NONZERO(type, array) (*((type *)(array)) != (type)0)
+#define COMPARE_COMPLEX_IS_NONZERO(type, array) ((((type *)(array))[0] != (type)0) || (((type *)(array))[1] != (type)0))
+// float16 is stored as raw bits: only +0, and -0 are zero, NaN is not
+#define COMPARE_FLOAT16_IS_NONZERO(type, array) ((*((type *)(array)) & 0x7fff) != 0)
+
+// counts the non-zero elements of ndarray in a single pass over the source;
+// if results is not NULL, the per-axis indices, if flat is not NULL, the flat
+// positions of the non-zero elements are stored, too
+#define COMPARE_NONZERO_SCAN(type, IS_NONZERO, ndarray, results, flat, count)\
+    uint8_t *array = (uint8_t *)(ndarray)->array;\
+    if(((results) == NULL) && ndarray_is_contiguous(ndarray)) {\
+        for(size_t pos = 0; pos < (ndarray)->len; pos++) {\
+            if(IS_NONZERO(type, array)) {\
+                if((flat) != NULL) {\
+                    compare_nonzero_store_index((flat), (count), pos);\
+                }\
+                (count)++;\
+            }\
+            array += (ndarray)->itemsize;\
+        }\
+    } else {\
+        size_t coords[ULAB_MAX_DIMS] = { 0 };\
+        for(size_t pos = 0; pos < (ndarray)->len; pos++) {\
+            if(IS_NONZERO(type, array)) {\
+                if((results) != NULL) {\
+                    for(uint8_t d = 0; d < (ndarray)->ndim; d++) {\
+                        compare_nonzero_store_index((results)[d], (count), coords[ULAB_MAX_DIMS - (ndarray)->ndim + d]);\
+                    }\
+                }\
+                if((flat) != NULL) {\
+                    compare_nonzero_store_index((flat), (count), pos);\
+                }\
+                (count)++;\
+            }\
+            uint8_t i = ULAB_MAX_DIMS - 1;\
+            array += (ndarray)->strides[i];\
+            coords[i]++;\
+            while((coords[i] == (ndarray)->shape[i]) && (i > ULAB_MAX_DIMS - (ndarray)->ndim)) {\
+                array -= (ndarray)->strides[i] * (ndarray)->shape[i];\
+                coords[i] = 0;\
+                i--;\
+                array += (ndarray)->strides[i];\
+                coords[i]++;\
+            }\
+        }\
+    }
 
 #if ULAB_MAX_DIMS == 1
 #define COMPARE_LOOP(results, array, type_out, type_left, type_right, larray, lstrides, rarray, rstrides, OPERATOR)\
@@ -138,6 +190,29 @@ MP_DECLARE_CONST_FUN_OBJ_3(compare_where_obj);
 
 #endif // ULAB_MAX_DIMS == 4
 
+// clamps a single line of len elements; lo, or hi can be NULL, if there is no bound on that side,
+// and their strides are 0, if the bound is a scalar
+#define COMPARE_CLIP_LINE(type, array, astride, lo, lostride, hi, histride, rarray, rstride, len) do {\
+    for(size_t _l = 0; _l < (len); _l++) {\
+        type _value = *((type *)(array));\
+        if(((lo) != NULL) && (_value < *((type *)(lo)))) {\
+            _value = *((type *)(lo));\
+        }\
+        if(((hi) != NULL) && (_value > *((type *)(hi)))) {\
+            _value = *((type *)(hi));\
+        }\
+        *((type *)(rarray)) = _value;\
+        (array) += (astride);\
+        if((lo) != NULL) {\
+            (lo) += (lostride);\
+        }\
+        if((hi) != NULL) {\
+            (hi) += (histride);\
+        }\
+        (rarray) += (rstride);\
+    }\
+} while(0)
+
 #define RUN_COMPARE_LOOP(dtype, type_out, type_left, type_right, larray, lstrides, rarray, rstrides, ndim, shape, op) do {\
     ndarray_obj_t *results = ndarray_new_dense_ndarray((ndim), (shape), (dtype));\
     uint8_t *array = (uint8_t *)results->array;\
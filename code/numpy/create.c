@@ -23,30 +23,40 @@
 
 #if ULAB_NUMPY_HAS_ONES | ULAB_NUMPY_HAS_ZEROS | ULAB_NUMPY_HAS_FULL | ULAB_NUMPY_HAS_EMPTY
 static mp_obj_t create_zeros_ones_full(mp_obj_t oshape, uint8_t dtype, mp_obj_t value) {
+    // value is mp_const_none for zeros, and MP_OBJ_NULL for empty; only zeros has to clear the memory,
+    // because ones, and full overwrite each element, while empty leaves the elements undefined
     if(!mp_obj_is_int(oshape) && !mp_obj_is_type(oshape, &mp_type_tuple) && !mp_obj_is_type(oshape, &mp_type_list)) {
         mp_raise_TypeError(MP_ERROR_TEXT("input argument must be an integer, a tuple, or a list"));
     }
-    ndarray_obj_t *ndarray = NULL;
+    size_t *shape = m_new0(size_t, ULAB_MAX_DIMS);
+    uint8_t ndim = 0;
     if(mp_obj_is_int(oshape)) {
         size_t n = mp_obj_get_int(oshape);
-        ndarray = ndarray_new_linear_array(n, dtype);
+        if(n > 0) {
+            ndim = 1;
+            shape[ULAB_MAX_DIMS - 1] = n;
+        }
     } else if(mp_obj_is_type(oshape, &mp_type_tuple) || mp_obj_is_type(oshape, &mp_type_list)) {
-        uint8_t len = (uint8_t)mp_obj_get_int(mp_obj_len_maybe(oshape));
-        if(len > ULAB_MAX_DIMS) {
+        ndim = (uint8_t)mp_obj_get_int(mp_obj_len_maybe(oshape));
+        if(ndim > ULAB_MAX_DIMS) {
             mp_raise_TypeError(MP_ERROR_TEXT("too many dimensions"));
         }
-        size_t *shape = m_new0(size_t, ULAB_MAX_DIMS);
 
         size_t i = 0;
         mp_obj_iter_buf_t iter_buf;
         mp_obj_t item, iterable = mp_getiter(oshape, &iter_buf);
         while((item = mp_iternext(iterable)) != MP_OBJ_STOP_ITERATION){
-            shape[ULAB_MAX_DIMS - len + i] = (size_t)mp_obj_get_int(item);
+            shape[ULAB_MAX_DIMS - ndim + i] = (size_t)mp_obj_get_int(item);
             i++;
         }
-        ndarray = ndarray_new_dense_ndarray(len, shape, dtype);
     }
-    if(value != mp_const_none) {
+    ndarray_obj_t *ndarray;
+    if(value == mp_const_none) {
+        ndarray = ndarray_new_dense_ndarray(ndim, shape, dtype);
+    } else {
+        ndarray = ndarray_new_dense_ndarray_uninitialised(ndim, shape, dtype);
+    }
+    if((value != mp_const_none) && (value != MP_OBJ_NULL)) {
         if(dtype == NDARRAY_BOOL) {
             dtype = NDARRAY_UINT8;
             if(mp_obj_is_true(value)) {
@@ -76,7 +86,7 @@ static mp_obj_t create_zeros_ones_full(mp_obj_t oshape, uint8_t dtype, mp_obj_t
 static ndarray_obj_t *create_linspace_arange(mp_float_t start, mp_float_t step, mp_float_t stop, size_t len, uint8_t dtype) {
     mp_float_t value = start;
 
-    ndarray_obj_t *ndarray = ndarray_new_linear_array(len, dtype);
+    ndarray_obj_t *ndarray = ndarray_new_dense_ndarray_uninitialised(len == 0 ? 0 : 1, ndarray_shape_vector(0, 0, 0, len), dtype);
     if(ndarray->boolean == NDARRAY_BOOLEAN) {
         uint8_t *array = (uint8_t *)ndarray->array;
         for(size_t i=0; i < len; i++, value += step) {
@@ -90,7 +100,22 @@ static ndarray_obj_t *create_linspace_arange(mp_float_t start, mp_float_t step,
         ARANGE_LOOP(uint16_t, ndarray, len, step, stop);
     } else if(dtype == NDARRAY_INT16) {
         ARANGE_LOOP(int16_t, ndarray, len, step, stop);
-    } else {
+    }
+    #if ULAB_HAS_INT32
+    else if(dtype == NDARRAY_UINT32) {
+        ARANGE_LOOP(uint32_t, ndarray, len, step, stop);
+    } else if(dtype == NDARRAY_INT32) {
+        ARANGE_LOOP(int32_t, ndarray, len, step, stop);
+    }
+    #endif
+    #if ULAB_HAS_FLOAT16
+    else if(dtype == NDARRAY_FLOAT16) {
+        uint16_t *array = (uint16_t *)ndarray->array;
+        for(size_t i=0; i < len - 1; i++, value += step) *array++ = ulab_float_to_float16(value);
+        *array = ulab_float_to_float16(stop);
+    }
+    #endif
+    else {
         ARANGE_LOOP(mp_float_t, ndarray, len, step, stop);
     }
     return ndarray;
@@ -442,8 +467,6 @@ MP_DEFINE_CONST_FUN_OBJ_KW(create_diag_obj, 1, create_diag);
 #endif /* ULAB_NUMPY_HAS_DIAG */
 
 #if ULAB_NUMPY_HAS_EMPTY
-// This function is bound in numpy.c to numpy.zeros(), and is simply an alias for that
-
 //| def empty(shape: Union[int, Tuple[int, ...]], *, dtype: _DType = ulab.numpy.float) -> ulab.numpy.ndarray:
 //|    """
 //|    .. param: shape
@@ -451,9 +474,25 @@ MP_DEFINE_CONST_FUN_OBJ_KW(create_diag_obj, 1, create_diag);
 //|    .. param: dtype
 //|       Type of values in the array
 //|
-//|    Return a new array of the given shape with all elements set to 0. An alias for numpy.zeros."""
+//|    Return a new array of the given shape. The memory is not cleared, hence, the values of
+//|    the elements are undefined, and must be set by the caller."""
 //|    ...
 //|
+
+mp_obj_t create_empty(size_t n_args, const mp_obj_t *pos_args, mp_map_t *kw_args) {
+    static const mp_arg_t allowed_args[] = {
+        { MP_QSTR_, MP_ARG_REQUIRED | MP_ARG_OBJ, { .u_obj = MP_OBJ_NULL } },
+        { MP_QSTR_dtype, MP_ARG_KW_ONLY | MP_ARG_INT, { .u_int = NDARRAY_FLOAT } },
+    };
+
+    mp_arg_val_t args[MP_ARRAY_SIZE(allowed_args)];
+    mp_arg_parse_all(n_args, pos_args, kw_args, MP_ARRAY_SIZE(allowed_args), allowed_args, args);
+
+    uint8_t dtype = args[1].u_int;
+    return create_zeros_ones_full(args[0].u_obj, dtype, MP_OBJ_NULL);
+}
+
+MP_DEFINE_CONST_FUN_OBJ_KW(create_empty_obj, 0, create_empty);
 #endif
 
 #if ULAB_NUMPY_HAS_EYE
@@ -737,7 +776,23 @@ mp_obj_t create_logspace(size_t n_args, const mp_obj_t *pos_args, mp_map_t *kw_a
     } else if(ndarray->dtype == NDARRAY_INT16) {
         int16_t *array = (int16_t *)ndarray->array;
         for(size_t i=0; i < len; i++, value *= quotient) *array++ = (int16_t)value;
-    } else {
+    }
+    #if ULAB_HAS_INT32
+    else if(ndarray->dtype == NDARRAY_UINT32) {
+        uint32_t *array = (uint32_t *)ndarray->array;
+        for(size_t i=0; i < len; i++, value *= quotient) *array++ = (uint32_t)value;
+    } else if(ndarray->dtype == NDARRAY_INT32) {
+        int32_t *array = (int32_t *)ndarray->array;
+        for(size_t i=0; i < len; i++, value *= quotient) *array++ = (int32_t)value;
+    }
+    #endif
+    #if ULAB_HAS_FLOAT16
+    else if(ndarray->dtype == NDARRAY_FLOAT16) {
+        uint16_t *array = (uint16_t *)ndarray->array;
+        for(size_t i=0; i < len; i++, value *= quotient) *array++ = ulab_float_to_float16(value);
+    }
+    #endif
+    else {
         mp_float_t *array = (mp_float_t *)ndarray->array;
         for(size_t i=0; i < len; i++, value *= quotient) *array++ = value;
     }
@@ -942,12 +997,6 @@ MP_DEFINE_CONST_FUN_OBJ_KW(create_ones_obj, 0, create_ones);
 //|    ...
 //|
 
-enum CREATE_TAKE_MODE {
-    CREATE_TAKE_RAISE,
-    CREATE_TAKE_WRAP,
-    CREATE_TAKE_CLIP,
-};
-
 mp_obj_t create_take(size_t n_args, const mp_obj_t *pos_args, mp_map_t *kw_args) {
     static const mp_arg_t allowed_args[] = {
         { MP_QSTR_, MP_ARG_REQUIRED | MP_ARG_OBJ, { .u_obj = MP_OBJ_NULL } },
@@ -966,26 +1015,25 @@ mp_obj_t create_take(size_t n_args, const mp_obj_t *pos_args, mp_map_t *kw_args)
 
     ndarray_obj_t *a = MP_OBJ_TO_PTR(args[0].u_obj);
     int8_t axis = 0;
-    int8_t axis_index = 0;
-    int32_t axis_len;
-    uint8_t mode = CREATE_TAKE_RAISE;
-    uint8_t ndim;
+    uint8_t mode = NDARRAY_INDEX_RAISE;
 
     // axis keyword argument
     if(args[2].u_obj == mp_const_none) {
-        // work with the flattened array
-        axis_len = a->len;
-        ndim = 1;
+        // work with the flattened array; this requires a copy only, if the array is not contiguous
+        if(!ndarray_is_contiguous(a)) {
+            a = ndarray_copy_view(a);
+        }
+        size_t *shape = ndarray_shape_vector(0, 0, 0, a->len);
+        int32_t *strides = m_new0(int32_t, ULAB_MAX_DIMS);
+        strides[ULAB_MAX_DIMS - 1] = a->itemsize;
+        a = ndarray_new_view(a, 1, shape, strides, 0);
     } else { // i.e., axis is an integer
         // TODO: this pops up at quite a few places, write it as a function
         axis = mp_obj_get_int(args[2].u_obj);
-        ndim = a->ndim;
         if(axis < 0) axis += a->ndim;
         if((axis < 0) || (axis > a->ndim - 1)) {
             mp_raise_ValueError(MP_ERROR_TEXT("index out of range"));
         }
-        axis_index = ULAB_MAX_DIMS - a->ndim + axis;
-        axis_len = (int32_t)a->shape[axis_index];
     }
 
     size_t _len;
@@ -993,149 +1041,30 @@ mp_obj_t create_take(size_t n_args, const mp_obj_t *pos_args, mp_map_t *kw_args)
     if(mp_obj_is_str(args[4].u_obj)) {
         const char *_mode = mp_obj_str_get_data(args[4].u_obj, &_len);
         if(memcmp(_mode, "raise", 5) == 0) {
-            mode = CREATE_TAKE_RAISE;
+            mode = NDARRAY_INDEX_RAISE;
         } else if(memcmp(_mode, "wrap", 4) == 0) {
-            mode = CREATE_TAKE_WRAP;
+            mode = NDARRAY_INDEX_WRAP;
         } else if(memcmp(_mode, "clip", 4) == 0) {
-            mode = CREATE_TAKE_CLIP;
+            mode = NDARRAY_INDEX_CLIP;
         } else {
             mp_raise_ValueError(MP_ERROR_TEXT("mode should be raise, wrap or clip"));
         }
     }
 
-    size_t indices_len = (size_t)mp_obj_get_int(mp_obj_len_maybe(args[1].u_obj));
-
-    size_t *indices = m_new(size_t, indices_len);
-
-    mp_obj_iter_buf_t buf;
-    mp_obj_t item, iterable = mp_getiter(args[1].u_obj, &buf);
-
-    size_t z = 0;
-    while((item = mp_iternext(iterable)) != MP_OBJ_STOP_ITERATION) {
-        int32_t index = mp_obj_get_int(item);
-        if(mode == CREATE_TAKE_RAISE) {
-            if(index < 0) {
-                index += axis_len;
-            }
-            if((index < 0) || (index > axis_len - 1)) {
-                m_del(size_t, indices, indices_len);
-                mp_raise_ValueError(MP_ERROR_TEXT("index out of range"));
-            }
-        } else if(mode == CREATE_TAKE_WRAP) {
-            index %= axis_len;
-        } else { // mode == CREATE_TAKE_CLIP
-            if(index < 0) {
-                m_del(size_t, indices, indices_len);
-                mp_raise_ValueError(MP_ERROR_TEXT("index must not be negative"));
-            }
-            if(index > axis_len - 1) {
-                index = axis_len - 1;
-            }
-        }
-        indices[z++] = (size_t)index;
-    }
-
-    size_t *shape = m_new0(size_t, ULAB_MAX_DIMS);
-    if(args[2].u_obj == mp_const_none) { // flattened array
-        shape[ULAB_MAX_DIMS - 1] = indices_len;
-    } else {
-        for(uint8_t i = 0; i < ULAB_MAX_DIMS; i++) {
-            shape[i] = a->shape[i];
-            if(i == axis_index) {
-                shape[i] = indices_len;
-            }
-        }
-    }
+    size_t indices_len;
+    size_t *indices = ndarray_get_indices(args[1].u_obj, &indices_len, a->shape[ULAB_MAX_DIMS - a->ndim + axis], mode);
 
     ndarray_obj_t *out = NULL;
-    if(args[3].u_obj == mp_const_none) {
-        // no output was supplied
-        out = ndarray_new_dense_ndarray(ndim, shape, a->dtype);
-    } else {
+    if(args[3].u_obj != mp_const_none) {
+        size_t *shape = m_new0(size_t, ULAB_MAX_DIMS);
+        memcpy(shape, a->shape, ULAB_MAX_DIMS * sizeof(size_t));
+        shape[ULAB_MAX_DIMS - a->ndim + axis] = indices_len;
         // TODO: deal with last argument being false!
-        out = ulab_tools_inspect_out(args[3].u_obj, a->dtype, ndim, shape, true);
+        out = ulab_tools_inspect_out(args[3].u_obj, a->dtype, a->ndim, shape, true);
     }
+    out = ndarray_gather(a, axis, indices, indices_len, out);
 
-    #if ULAB_MAX_DIMS > 1 // we can save the hassle, if there is only one possible dimension
-    if((args[2].u_obj == mp_const_none) || (a->ndim == 1)) { // flattened array
-    #endif
-        uint8_t *out_array = (uint8_t *)out->array;
-        for(size_t x = 0; x < indices_len; x++) {
-            uint8_t *a_array = (uint8_t *)a->array;
-            size_t remainder = indices[x];
-            uint8_t q = ULAB_MAX_DIMS - 1;
-            do {
-                size_t div = (remainder / a->shape[q]);
-                a_array += remainder * a->strides[q];
-                remainder -= div * a->shape[q];
-                q--;
-            } while(q > ULAB_MAX_DIMS - a->ndim);
-            // NOTE: for floats and complexes, this might be 
-            // better with memcpy(out_array, a_array, a->itemsize)
-            for(uint8_t p = 0; p < a->itemsize; p++) {
-                out_array[p] = a_array[p];
-            }
-            out_array += a->itemsize;
-        }
-    #if ULAB_MAX_DIMS > 1
-    } else {     
-        // move the axis shape/stride to the leftmost position:
-        SWAP(size_t, a->shape[0], a->shape[axis_index]);
-        SWAP(size_t, out->shape[0], out->shape[axis_index]);
-        SWAP(int32_t, a->strides[0], a->strides[axis_index]);
-        SWAP(int32_t, out->strides[0], out->strides[axis_index]);
-
-        for(size_t x = 0; x < indices_len; x++) {
-            uint8_t *a_array = (uint8_t *)a->array;
-            uint8_t *out_array = (uint8_t *)out->array;
-            a_array += indices[x] * a->strides[0];
-            out_array += x * out->strides[0];
-
-            #if ULAB_MAX_DIMS > 3
-            size_t j = 0;
-            do {
-            #endif
-                #if ULAB_MAX_DIMS > 2
-                size_t k = 0;
-                do {
-                #endif
-                    size_t l = 0;
-                    do {
-                        // NOTE: for floats and complexes, this might be 
-                        // better with memcpy(out_array, a_array, a->itemsize)
-                        for(uint8_t p = 0; p < a->itemsize; p++) {
-                            out_array[p] = a_array[p];
-                        }
-                        out_array += out->strides[ULAB_MAX_DIMS - 1];
-                        a_array += a->strides[ULAB_MAX_DIMS - 1];
-                        l++;
-                    } while(l < a->shape[ULAB_MAX_DIMS - 1]);
-                #if ULAB_MAX_DIMS > 2
-                    out_array -= out->strides[ULAB_MAX_DIMS - 1] * out->shape[ULAB_MAX_DIMS - 1];
-                    out_array += out->strides[ULAB_MAX_DIMS - 2];
-                    a_array -= a->strides[ULAB_MAX_DIMS - 1] * a->shape[ULAB_MAX_DIMS - 1];
-                    a_array += a->strides[ULAB_MAX_DIMS - 2];
-                    k++;
-                } while(k < a->shape[ULAB_MAX_DIMS - 2]);
-                #endif
-            #if ULAB_MAX_DIMS > 3
-                out_array -= out->strides[ULAB_MAX_DIMS - 2] * out->shape[ULAB_MAX_DIMS - 2];
-                out_array += out->strides[ULAB_MAX_DIMS - 3];
-                a_array -= a->strides[ULAB_MAX_DIMS - 2] * a->shape[ULAB_MAX_DIMS - 2];
-                a_array += a->strides[ULAB_MAX_DIMS - 3];
-                j++;
-            } while(j < a->shape[ULAB_MAX_DIMS - 3]);
-            #endif
-        }
-
-        // revert back to the original order
-        SWAP(size_t, a->shape[0], a->shape[axis_index]);
-        SWAP(size_t, out->shape[0], out->shape[axis_index]);
-        SWAP(int32_t, a->strides[0], a->strides[axis_index]);
-        SWAP(int32_t, out->strides[0], out->strides[axis_index]);
-    }
-    #endif /* ULAB_MAX_DIMS > 1 */
-    m_del(size_t, indices, indices_len);
+    m_del(size_t, indices, MAX(1, indices_len));
     return MP_OBJ_FROM_PTR(out);
 }
 
@@ -1177,6 +1106,7 @@ mp_obj_t create_frombuffer(size_t n_args, const mp_obj_t *pos_args, mp_map_t *kw
         { MP_QSTR_dtype, MP_ARG_KW_ONLY | MP_ARG_OBJ, { .u_rom_obj = MP_ROM_INT(NDARRAY_FLOAT) } },
         { MP_QSTR_count, MP_ARG_KW_ONLY | MP_ARG_OBJ, { .u_rom_obj = MP_ROM_INT(-1) } },
         { MP_QSTR_offset, MP_ARG_KW_ONLY | MP_ARG_OBJ, { .u_rom_obj = MP_ROM_INT(0) } },
+        { MP_QSTR_stride, MP_ARG_KW_ONLY | MP_ARG_INT, { .u_int = 1 } },
     };
 
     mp_arg_val_t args[MP_ARRAY_SIZE(allowed_args)];
@@ -1184,32 +1114,46 @@ mp_obj_t create_frombuffer(size_t n_args, const mp_obj_t *pos_args, mp_map_t *kw
 
     uint8_t dtype = mp_obj_get_int(args[1].u_obj);
     size_t offset = mp_obj_get_int(args[3].u_obj);
+    if(args[4].u_int < 1) {
+        mp_raise_ValueError(MP_ERROR_TEXT("stride must be positive"));
+    }
+    size_t stride = args[4].u_int;
 
+    // the array is always a view on the buffer, so that writes to the array go directly
+    // into the buffer; read-only buffers (bytes) are accepted, too
     mp_buffer_info_t bufinfo;
-    if(mp_get_buffer(args[0].u_obj, &bufinfo, MP_BUFFER_READ)) {
-        size_t sz = ulab_binary_get_size(dtype);
+    if(!mp_get_buffer(args[0].u_obj, &bufinfo, MP_BUFFER_RW)) {
+        mp_get_buffer_raise(args[0].u_obj, &bufinfo, MP_BUFFER_READ);
+    }
+    size_t sz = ulab_binary_get_size(dtype);
 
-        if(bufinfo.len < offset) {
-            mp_raise_ValueError(MP_ERROR_TEXT("offset must be non-negative and no greater than buffer length"));
-        }
-        size_t len = (bufinfo.len - offset) / sz;
+    if(bufinfo.len < offset) {
+        mp_raise_ValueError(MP_ERROR_TEXT("offset must be non-negative and no greater than buffer length"));
+    }
+    size_t len;
+    if(stride == 1) {
+        len = (bufinfo.len - offset) / sz;
         if((len * sz) != (bufinfo.len - offset)) {
             mp_raise_ValueError(MP_ERROR_TEXT("buffer size must be a multiple of element size"));
         }
-        if(mp_obj_get_int(args[2].u_obj) > 0) {
-            size_t count = mp_obj_get_int(args[2].u_obj);
-            if(len < count) {
-                mp_raise_ValueError(MP_ERROR_TEXT("buffer is smaller than requested size"));
-            } else {
-                len = count;
-            }
+    } else {
+        // with a stride, the trailing part of the last frame may be missing
+        len = (bufinfo.len - offset) < sz ? 0 : (bufinfo.len - offset - sz) / (stride * sz) + 1;
+    }
+    if(mp_obj_get_int(args[2].u_obj) > 0) {
+        size_t count = mp_obj_get_int(args[2].u_obj);
+        if(len < count) {
+            mp_raise_ValueError(MP_ERROR_TEXT("buffer is smaller than requested size"));
+        } else {
+            len = count;
         }
-
-        size_t *shape = ndarray_shape_vector(0, 0, 0, len);
-        uint8_t *buffer = bufinfo.buf;
-        return ndarray_new_ndarray(1, shape, NULL, dtype, buffer + offset);
     }
-    return mp_const_none;
+
+    size_t *shape = ndarray_shape_vector(0, 0, 0, len);
+    int32_t *strides = m_new0(int32_t, ULAB_MAX_DIMS);
+    strides[ULAB_MAX_DIMS - 1] = (int32_t)(stride * sz);
+    uint8_t *buffer = bufinfo.buf;
+    return MP_OBJ_FROM_PTR(ndarray_new_ndarray(1, shape, strides, dtype, buffer + offset));
 }
 
 MP_DEFINE_CONST_FUN_OBJ_KW(create_frombuffer_obj, 1, create_frombuffer);
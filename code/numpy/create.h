@@ -35,6 +35,11 @@ mp_obj_t create_diag(size_t , const mp_obj_t *, mp_map_t *);
 MP_DECLARE_CONST_FUN_OBJ_KW(create_diag_obj);
 #endif
 
+#if ULAB_NUMPY_HAS_EMPTY
+mp_obj_t create_empty(size_t , const mp_obj_t *, mp_map_t *);
+MP_DECLARE_CONST_FUN_OBJ_KW(create_empty_obj);
+#endif
+
 #if ULAB_MAX_DIMS > 1
 #if ULAB_NUMPY_HAS_EYE
 mp_obj_t create_eye(size_t , const mp_obj_t *, mp_map_t *);
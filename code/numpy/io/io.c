@@ -104,6 +104,18 @@ static mp_obj_t io_load(mp_obj_t file) {
     } else if(memcmp(buffer, "i2", 2) == 0) {
         dtype = NDARRAY_INT16;
     }
+    #if ULAB_HAS_INT32
+    else if(memcmp(buffer, "u4", 2) == 0) {
+        dtype = NDARRAY_UINT32;
+    } else if(memcmp(buffer, "i4", 2) == 0) {
+        dtype = NDARRAY_INT32;
+    }
+    #endif
+    #if ULAB_HAS_FLOAT16
+    else if(memcmp(buffer, "f2", 2) == 0) {
+        dtype = NDARRAY_FLOAT16;
+    }
+    #endif
     #if MICROPY_FLOAT_IMPL == MICROPY_FLOAT_IMPL_FLOAT
     else if(memcmp(buffer, "f4", 2) == 0) {
         dtype = NDARRAY_FLOAT;
@@ -575,6 +587,19 @@ static mp_obj_t io_save(mp_obj_t file, mp_obj_t ndarray_) {
         case NDARRAY_INT16:
             memcpy(buffer+offset, "i2", 2);
             break;
+        #if ULAB_HAS_INT32
+        case NDARRAY_UINT32:
+            memcpy(buffer+offset, "u4", 2);
+            break;
+        case NDARRAY_INT32:
+            memcpy(buffer+offset, "i4", 2);
+            break;
+        #endif
+        #if ULAB_HAS_FLOAT16
+        case NDARRAY_FLOAT16:
+            memcpy(buffer+offset, "f2", 2);
+            break;
+        #endif
         case NDARRAY_FLOAT:
             #if MICROPY_FLOAT_IMPL == MICROPY_FLOAT_IMPL_FLOAT
             memcpy(buffer+offset, "f4", 2);
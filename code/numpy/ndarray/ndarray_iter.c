@@ -20,47 +20,141 @@
 #include "ndarray_iter.h"
 
 #ifdef NDARRAY_HAS_FLATITER
+static void ndarray_flatiter_seek(ndarray_flatiter_t *self, size_t index) {
+    // moves the iterator to the element at the flat position index;
+    // this is the only place, where division is required
+    ndarray_obj_t *ndarray = MP_OBJ_TO_PTR(self->ndarray);
+    uint8_t *array = (uint8_t *)ndarray->array;
+    self->cur = index;
+    for(uint8_t i = ULAB_MAX_DIMS; i > ULAB_MAX_DIMS - ndarray->ndim; i--) {
+        self->coords[i - 1] = index % ndarray->shape[i - 1];
+        array += self->coords[i - 1] * ndarray->strides[i - 1];
+        index /= ndarray->shape[i - 1];
+    }
+    self->array = array;
+}
+
+static inline void ndarray_flatiter_advance(ndarray_flatiter_t *self, ndarray_obj_t *ndarray) {
+    self->cur++;
+    if(self->contiguous) {
+        self->array += ndarray->itemsize;
+        return;
+    }
+    // step the last coordinate, and carry into the higher dimensions
+    uint8_t i = ULAB_MAX_DIMS - 1;
+    self->array += ndarray->strides[i];
+    self->coords[i]++;
+    while((self->coords[i] == ndarray->shape[i]) && (i > ULAB_MAX_DIMS - ndarray->ndim)) {
+        self->array -= ndarray->strides[i] * ndarray->shape[i];
+        self->coords[i] = 0;
+        i--;
+        self->array += ndarray->strides[i];
+        self->coords[i]++;
+    }
+}
+
+static void ndarray_flatiter_init(ndarray_flatiter_t *self, mp_obj_t ndarray_in) {
+    ndarray_obj_t *ndarray = MP_OBJ_TO_PTR(ndarray_in);
+    self->ndarray = ndarray_in;
+    self->contiguous = ndarray_is_contiguous(ndarray);
+    memset(self->coords, 0, ULAB_MAX_DIMS * sizeof(size_t));
+    self->array = (uint8_t *)ndarray->array;
+    self->cur = 0;
+}
+
 mp_obj_t ndarray_flatiter_make_new(mp_obj_t self_in) {
     ndarray_flatiter_t *flatiter = m_new_obj(ndarray_flatiter_t);
     flatiter->base.type = &ndarray_flatiter_type;
     flatiter->iternext = ndarray_flatiter_next;
-    flatiter->ndarray = self_in;
-    flatiter->cur = 0;
+    ndarray_flatiter_init(flatiter, self_in);
     return MP_OBJ_FROM_PTR(flatiter);
 }
 
 mp_obj_t ndarray_flatiter_next(mp_obj_t self_in) {
     ndarray_flatiter_t *self = MP_OBJ_TO_PTR(self_in);
     ndarray_obj_t *ndarray = MP_OBJ_TO_PTR(self->ndarray);
-    uint8_t *array = (uint8_t *)ndarray->array;
 
     if(self->cur < ndarray->len) {
-        uint32_t remainder = self->cur;
-        uint8_t i = ULAB_MAX_DIMS - 1;
-        do {
-            size_t div = (remainder / ndarray->shape[i]);
-            array += remainder * ndarray->strides[i];
-            remainder -= div * ndarray->shape[i];
-            i--;
-        } while(i > ULAB_MAX_DIMS - ndarray->ndim);
-        self->cur++;
+        uint8_t *array = self->array;
+        ndarray_flatiter_advance(self, ndarray);
         return ndarray_get_item(ndarray, array);
     }
     return MP_OBJ_STOP_ITERATION;
 }
 
 mp_obj_t ndarray_new_flatiterator(mp_obj_t flatiter_in, mp_obj_iter_buf_t *iter_buf) {
-    assert(sizeof(ndarray_flatiter_t) <= sizeof(mp_obj_iter_buf_t));
-    ndarray_flatiter_t *iter = (ndarray_flatiter_t *)iter_buf;
+    // the coordinates do not fit into iter_buf, hence, the iterator is allocated on the heap
+    (void)iter_buf;
     ndarray_flatiter_t *flatiter = MP_OBJ_TO_PTR(flatiter_in);
+    ndarray_flatiter_t *iter = m_new_obj(ndarray_flatiter_t);
     iter->base.type = &mp_type_polymorph_iter;
     iter->iternext = ndarray_flatiter_next;
-    iter->ndarray = flatiter->ndarray;
-    iter->cur = 0;
+    ndarray_flatiter_init(iter, flatiter->ndarray);
     return MP_OBJ_FROM_PTR(iter);
 }
 
 mp_obj_t ndarray_get_flatiterator(mp_obj_t o_in, mp_obj_iter_buf_t *iter_buf) {
     return ndarray_new_flatiterator(o_in, iter_buf);
 }
+
+mp_obj_t ndarray_flatiter_subscr(mp_obj_t self_in, mp_obj_t index, mp_obj_t value) {
+    if(value != MP_OBJ_SENTINEL) {
+        // only loading is supported
+        return MP_OBJ_NULL;
+    }
+    ndarray_flatiter_t *self = MP_OBJ_TO_PTR(self_in);
+    ndarray_obj_t *ndarray = MP_OBJ_TO_PTR(self->ndarray);
+    ndarray_flatiter_t iter;
+    ndarray_flatiter_init(&iter, self->ndarray);
+
+    if(mp_obj_is_int(index)) {
+        mp_int_t _index = mp_obj_get_int(index);
+        if(_index < 0) {
+            _index += ndarray->len;
+        }
+        if((_index < 0) || (_index >= (mp_int_t)ndarray->len)) {
+            mp_raise_msg(&mp_type_IndexError, MP_ERROR_TEXT("index is out of bounds"));
+        }
+        ndarray_flatiter_seek(&iter, (size_t)_index);
+        return ndarray_get_item(ndarray, iter.array);
+    }
+    if(!mp_obj_is_type(index, &mp_type_slice)) {
+        mp_raise_msg(&mp_type_IndexError, MP_ERROR_TEXT("indices must be integers or slices"));
+    }
+
+    mp_bound_slice_t slice;
+    mp_obj_slice_indices(index, ndarray->len, &slice);
+    ssize_t _len = (ssize_t)(slice.stop - slice.start + (slice.step > 0 ? slice.step - 1 : slice.step + 1)) / slice.step;
+    size_t len = _len < 0 ? 0 : (size_t)_len;
+
+    if(iter.contiguous) {
+        // the slice of a contiguous array can be expressed with a single stride
+        size_t *shape = ndarray_shape_vector(0, 0, 0, len);
+        int32_t *strides = m_new0(int32_t, ULAB_MAX_DIMS);
+        strides[ULAB_MAX_DIMS - 1] = slice.step * ndarray->itemsize;
+        return MP_OBJ_FROM_PTR(ndarray_new_view(ndarray, 1, shape, strides, len ? slice.start * ndarray->itemsize : 0));
+    }
+
+    uint8_t dtype = ndarray->boolean ? NDARRAY_BOOL : ndarray->dtype;
+    ndarray_obj_t *results = ndarray_new_linear_array(len, dtype);
+    uint8_t *rarray = (uint8_t *)results->array;
+    if(len) {
+        ndarray_flatiter_seek(&iter, slice.start);
+    }
+    for(size_t i = 0; i < len; i++) {
+        memcpy(rarray, iter.array, ndarray->itemsize);
+        rarray += ndarray->itemsize;
+        if(i + 1 == len) {
+            break;
+        }
+        if(slice.step > 0) {
+            for(mp_int_t j = 0; j < slice.step; j++) {
+                ndarray_flatiter_advance(&iter, ndarray);
+            }
+        } else {
+            ndarray_flatiter_seek(&iter, iter.cur + slice.step);
+        }
+    }
+    return MP_OBJ_FROM_PTR(results);
+}
 #endif /* NDARRAY_HAS_FLATITER */
@@ -26,11 +26,15 @@ typedef struct _mp_obj_ndarray_flatiter_t {
     mp_obj_base_t base;
     mp_fun_1_t iternext;
     mp_obj_t ndarray;
+    uint8_t *array;
     size_t cur;
+    size_t coords[ULAB_MAX_DIMS];
+    bool contiguous;
 } ndarray_flatiter_t;
 
 mp_obj_t ndarray_get_flatiterator(mp_obj_t , mp_obj_iter_buf_t *);
 mp_obj_t ndarray_flatiter_make_new(mp_obj_t );
 mp_obj_t ndarray_flatiter_next(mp_obj_t );
+mp_obj_t ndarray_flatiter_subscr(mp_obj_t , mp_obj_t , mp_obj_t );
 
 #endif
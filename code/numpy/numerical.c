@@ -30,6 +30,8 @@ enum NUMERICAL_FUNCTION_TYPE {
     NUMERICAL_ANY,
     NUMERICAL_ARGMAX,
     NUMERICAL_ARGMIN,
+    NUMERICAL_CUMPROD,
+    NUMERICAL_CUMSUM,
     NUMERICAL_MAX,
     NUMERICAL_MEAN,
     NUMERICAL_MIN,
@@ -247,6 +249,60 @@ static mp_obj_t numerical_all_any(mp_obj_t oin, mp_obj_t axis, uint8_t optype) {
 }
 #endif
 
+#if ULAB_NUMPY_HAS_SUM | ULAB_NUMPY_HAS_MEAN | ULAB_NUMPY_HAS_STD | ULAB_NUMPY_HAS_CUMSUM | ULAB_NUMPY_HAS_CUMPROD
+static void numerical_sum_set_value(ndarray_obj_t *results, uint8_t *rarray, int64_t sum) {
+    // writes an integer sum into the output array, and converts it to the output's dtype
+    if(results->boolean) {
+        *rarray = sum != 0;
+    } else if(results->dtype == NDARRAY_UINT8) {
+        *rarray = (uint8_t)sum;
+    } else if(results->dtype == NDARRAY_INT8) {
+        *((int8_t *)rarray) = (int8_t)sum;
+    } else if(results->dtype == NDARRAY_UINT16) {
+        *((uint16_t *)rarray) = (uint16_t)sum;
+    } else if(results->dtype == NDARRAY_INT16) {
+        *((int16_t *)rarray) = (int16_t)sum;
+    }
+    #if ULAB_HAS_INT32
+    else if(results->dtype == NDARRAY_UINT32) {
+        *((uint32_t *)rarray) = (uint32_t)sum;
+    } else if(results->dtype == NDARRAY_INT32) {
+        *((int32_t *)rarray) = (int32_t)sum;
+    }
+    #endif
+    #if ULAB_HAS_FLOAT16
+    else if(results->dtype == NDARRAY_FLOAT16) {
+        *((uint16_t *)rarray) = ulab_float_to_float16((mp_float_t)sum);
+    }
+    #endif
+    else {
+        *((mp_float_t *)rarray) = (mp_float_t)sum;
+    }
+}
+
+static uint8_t numerical_get_dtype(mp_obj_t obj, uint8_t dtype) {
+    // returns the dtype keyword argument, or dtype, if the keyword was not supplied
+    if(obj == mp_const_none) {
+        return dtype;
+    }
+    mp_int_t _dtype = mp_obj_get_int(obj);
+    dtype = (uint8_t)_dtype;
+    // the accumulators can write only real dtypes that are compiled into the firmware
+    if((_dtype != dtype) || ((dtype != NDARRAY_BOOL) && (dtype != NDARRAY_UINT8) && (dtype != NDARRAY_INT8) &&
+        (dtype != NDARRAY_UINT16) && (dtype != NDARRAY_INT16) && (dtype != NDARRAY_FLOAT)
+        #if ULAB_HAS_INT32
+        && (dtype != NDARRAY_UINT32) && (dtype != NDARRAY_INT32)
+        #endif
+        #if ULAB_HAS_FLOAT16
+        && (dtype != NDARRAY_FLOAT16)
+        #endif
+        )) {
+        mp_raise_TypeError(MP_ERROR_TEXT("dtype is not supported"));
+    }
+    return dtype;
+}
+#endif
+
 #if ULAB_NUMPY_HAS_SUM | ULAB_NUMPY_HAS_MEAN | ULAB_NUMPY_HAS_STD
 static mp_obj_t numerical_sum_mean_std_iterable(mp_obj_t oin, uint8_t optype, size_t ddof) {
     mp_float_t value = MICROPY_FLOAT_CONST(0.0);
@@ -274,8 +330,84 @@ static mp_obj_t numerical_sum_mean_std_iterable(mp_obj_t oin, uint8_t optype, si
     }
 }
 
-static mp_obj_t numerical_sum_mean_std_ndarray(ndarray_obj_t *ndarray, mp_obj_t axis, mp_obj_t keepdims, uint8_t optype, size_t ddof) {
-    COMPLEX_DTYPE_NOT_IMPLEMENTED(ndarray->dtype)
+static void numerical_mean_std_line(uint8_t dtype, uint8_t *array, int32_t stride, size_t len,
+                                    size_t *count, mp_float_t *M, mp_float_t *S, bool isStd) {
+    // accumulates a single line of the flattened array into the running moments
+    if(dtype == NDARRAY_UINT8) {
+        MEAN_STD_BLOCKED(uint8_t, array, stride, len, *count, *M, *S, isStd);
+    } else if(dtype == NDARRAY_INT8) {
+        MEAN_STD_BLOCKED(int8_t, array, stride, len, *count, *M, *S, isStd);
+    } else if(dtype == NDARRAY_UINT16) {
+        MEAN_STD_BLOCKED(uint16_t, array, stride, len, *count, *M, *S, isStd);
+    } else if(dtype == NDARRAY_INT16) {
+        MEAN_STD_BLOCKED(int16_t, array, stride, len, *count, *M, *S, isStd);
+    }
+    #if ULAB_HAS_INT32
+    else if(dtype == NDARRAY_UINT32) {
+        MEAN_STD_BLOCKED(uint32_t, array, stride, len, *count, *M, *S, isStd);
+    } else if(dtype == NDARRAY_INT32) {
+        MEAN_STD_BLOCKED(int32_t, array, stride, len, *count, *M, *S, isStd);
+    }
+    #endif
+    else {
+        MEAN_STD_BLOCKED(mp_float_t, array, stride, len, *count, *M, *S, isStd);
+    }
+}
+
+static mp_obj_t numerical_sum_mean_std_ndarray(ndarray_obj_t *, mp_obj_t , mp_obj_t , uint8_t , size_t , uint8_t );
+
+#if ULAB_SUPPORTS_COMPLEX
+static mp_obj_t numerical_sum_mean_std_complex(ndarray_obj_t *ndarray, mp_obj_t axis, mp_obj_t keepdims, uint8_t optype, size_t ddof) {
+    // The real, and imaginary parts are interleaved, so that they can be viewed as two
+    // float arrays with the same strides. These are reduced by the float kernels, and
+    // the results are recombined: the sum and the mean are complex, while the standard
+    // deviation is real, and its square is the sum of the two variances.
+    ndarray_obj_t *parts[2];
+    mp_obj_t results[2];
+    for(uint8_t i = 0; i < 2; i++) {
+        parts[i] = ndarray_new_view(ndarray, ndarray->ndim, ndarray->shape, ndarray->strides, i * sizeof(mp_float_t));
+        parts[i]->dtype = NDARRAY_FLOAT;
+        parts[i]->itemsize = sizeof(mp_float_t);
+        results[i] = numerical_sum_mean_std_ndarray(parts[i], axis, keepdims, optype, ddof, NDARRAY_FLOAT);
+    }
+
+    if(!mp_obj_is_type(results[0], &ulab_ndarray_type)) {
+        mp_float_t real = mp_obj_get_float(results[0]);
+        mp_float_t imag = mp_obj_get_float(results[1]);
+        if(optype == NUMERICAL_STD) {
+            return mp_obj_new_float(MICROPY_FLOAT_C_FUN(sqrt)(real * real + imag * imag));
+        }
+        return mp_obj_new_complex(real, imag);
+    }
+
+    // the partial results are dense float arrays of the same shape
+    ndarray_obj_t *real = MP_OBJ_TO_PTR(results[0]);
+    ndarray_obj_t *imag = MP_OBJ_TO_PTR(results[1]);
+    uint8_t dtype = optype == NUMERICAL_STD ? NDARRAY_FLOAT : NDARRAY_COMPLEX;
+    ndarray_obj_t *combined = ndarray_new_dense_ndarray_uninitialised(real->ndim, real->shape, dtype);
+    mp_float_t *rarray = (mp_float_t *)real->array;
+    mp_float_t *iarray = (mp_float_t *)imag->array;
+    mp_float_t *array = (mp_float_t *)combined->array;
+    for(size_t i = 0; i < combined->len; i++) {
+        if(optype == NUMERICAL_STD) {
+            *array++ = MICROPY_FLOAT_C_FUN(sqrt)(rarray[i] * rarray[i] + iarray[i] * iarray[i]);
+        } else {
+            *array++ = rarray[i];
+            *array++ = iarray[i];
+        }
+    }
+    return MP_OBJ_FROM_PTR(combined);
+}
+#endif /* ULAB_SUPPORTS_COMPLEX */
+
+static mp_obj_t numerical_sum_mean_std_ndarray(ndarray_obj_t *ndarray, mp_obj_t axis, mp_obj_t keepdims, uint8_t optype, size_t ddof, uint8_t dtype) {
+    // dtype is the dtype of the output of sum along an axis; it is ignored by mean, and std
+    #if ULAB_SUPPORTS_COMPLEX
+    if(ndarray->dtype == NDARRAY_COMPLEX) {
+        return numerical_sum_mean_std_complex(ndarray, axis, keepdims, optype, ddof);
+    }
+    #endif
+    FLOAT16_PROMOTE_TO_FLOAT(ndarray);
     uint8_t *array = (uint8_t *)ndarray->array;
     shape_strides _shape_strides = tools_reduce_axes(ndarray, axis);
 
@@ -285,11 +417,37 @@ static mp_obj_t numerical_sum_mean_std_ndarray(ndarray_obj_t *ndarray, mp_obj_t
             // if there are too many degrees of freedom, there is no point in calculating anything
             return mp_obj_new_float(MICROPY_FLOAT_CONST(0.0));
         }
-        mp_float_t (*func)(void *) = ndarray_get_float_function(ndarray->dtype);
+        if((optype == NUMERICAL_SUM) && !NDARRAY_IS_FLOATING(ndarray->dtype)) {
+            // integers are summed exactly, instead of being reconstructed from the float mean
+            int64_t sum = 0;
+            if(ndarray->len) {
+                if(ndarray->dtype == NDARRAY_UINT8) {
+                    RUN_SUM_FLAT(uint8_t, ndarray, array, sum);
+                } else if(ndarray->dtype == NDARRAY_INT8) {
+                    RUN_SUM_FLAT(int8_t, ndarray, array, sum);
+                } else if(ndarray->dtype == NDARRAY_UINT16) {
+                    RUN_SUM_FLAT(uint16_t, ndarray, array, sum);
+                } else if(ndarray->dtype == NDARRAY_INT16) {
+                    RUN_SUM_FLAT(int16_t, ndarray, array, sum);
+                }
+                #if ULAB_HAS_INT32
+                else if(ndarray->dtype == NDARRAY_UINT32) {
+                    RUN_SUM_FLAT(uint32_t, ndarray, array, sum);
+                } else if(ndarray->dtype == NDARRAY_INT32) {
+                    RUN_SUM_FLAT(int32_t, ndarray, array, sum);
+                }
+                #endif
+            }
+            if(dtype == ndarray->dtype) {
+                return mp_obj_new_int_from_ll(sum);
+            }
+            // any other dtype is honoured in the same way as by the sums along an axis
+            ndarray_obj_t *results = ndarray_new_linear_array(1, dtype);
+            numerical_sum_set_value(results, (uint8_t *)results->array, sum);
+            return ndarray_get_item(results, results->array);
+        }
         mp_float_t M = MICROPY_FLOAT_CONST(0.0);
-        mp_float_t m = MICROPY_FLOAT_CONST(0.0);
         mp_float_t S = MICROPY_FLOAT_CONST(0.0);
-        mp_float_t s = MICROPY_FLOAT_CONST(0.0);
         size_t count = 0;
 
         #if ULAB_MAX_DIMS > 3
@@ -304,21 +462,9 @@ static mp_obj_t numerical_sum_mean_std_ndarray(ndarray_obj_t *ndarray, mp_obj_t
                 size_t k = 0;
                 do {
                 #endif
-                    size_t l = 0;
-                    do {
-                        count++;
-                        mp_float_t value = func(array);
-                        m = M + (value - M) / (mp_float_t)count;
-                        if(optype == NUMERICAL_STD) {
-                            s = S + (value - M) * (value - m);
-                            S = s;
-                        }
-                        M = m;
-                        array += _shape_strides.strides[ULAB_MAX_DIMS - 1];
-                        l++;
-                    } while(l < _shape_strides.shape[ULAB_MAX_DIMS - 1]);
+                    numerical_mean_std_line(ndarray->dtype, array, _shape_strides.strides[ULAB_MAX_DIMS - 1],
+                                            _shape_strides.shape[ULAB_MAX_DIMS - 1], &count, &M, &S, optype == NUMERICAL_STD);
                 #if ULAB_MAX_DIMS > 1
-                    array -= _shape_strides.strides[ULAB_MAX_DIMS - 1] * _shape_strides.shape[ULAB_MAX_DIMS - 1];
                     array += _shape_strides.strides[ULAB_MAX_DIMS - 2];
                     k++;
                 } while(k < _shape_strides.shape[ULAB_MAX_DIMS - 2]);
@@ -336,12 +482,8 @@ static mp_obj_t numerical_sum_mean_std_ndarray(ndarray_obj_t *ndarray, mp_obj_t
         } while(i < _shape_strides.shape[ULAB_MAX_DIMS - 4]);
         #endif
         if(optype == NUMERICAL_SUM) {
-            // numpy returns an integer for integer input types
-            if(ndarray->dtype == NDARRAY_FLOAT) {
-                return mp_obj_new_float(M * ndarray->len);
-            } else {
-                return mp_obj_new_int((int32_t)MICROPY_FLOAT_C_FUN(round)(M * ndarray->len));
-            }
+            // integer inputs have already been taken care of
+            return mp_obj_new_float(M * ndarray->len);
         } else if(optype == NUMERICAL_MEAN) {
             return mp_obj_new_float(M);
         } else { // this must be the case of the standard deviation
@@ -353,20 +495,32 @@ static mp_obj_t numerical_sum_mean_std_ndarray(ndarray_obj_t *ndarray, mp_obj_t
         uint8_t *rarray = NULL;
         mp_float_t *farray = NULL;
         if(optype == NUMERICAL_SUM) {
-            results = ndarray_new_dense_ndarray(_shape_strides.ndim, _shape_strides.shape, ndarray->dtype);
-            rarray = (uint8_t *)results->array;
-            // TODO: numpy promotes the output to the highest integer type
+            // integers are summed in a wide accumulator, and are converted to the output dtype only at the end,
+            // hence, e.g., the column sums of a uint8 image can be returned as uint16 without a float copy
+            if(!NDARRAY_IS_FLOATING(ndarray->dtype)) {
+                results = ndarray_new_dense_ndarray_uninitialised(_shape_strides.ndim, _shape_strides.shape, dtype);
+                rarray = (uint8_t *)results->array;
+            }
             if(ndarray->dtype == NDARRAY_UINT8) {
-                RUN_SUM(uint8_t, array, results, rarray, _shape_strides);
+                RUN_SUM(uint8_t, int32_t, array, results, rarray, _shape_strides);
             } else if(ndarray->dtype == NDARRAY_INT8) {
-                RUN_SUM(int8_t, array, results, rarray, _shape_strides);
+                RUN_SUM(int8_t, int32_t, array, results, rarray, _shape_strides);
             } else if(ndarray->dtype == NDARRAY_UINT16) {
-                RUN_SUM(uint16_t, array, results, rarray, _shape_strides);
+                RUN_SUM(uint16_t, int32_t, array, results, rarray, _shape_strides);
             } else if(ndarray->dtype == NDARRAY_INT16) {
-                RUN_SUM(int16_t, array, results, rarray, _shape_strides);
-            } else {
+                RUN_SUM(int16_t, int32_t, array, results, rarray, _shape_strides);
+            }
+            #if ULAB_HAS_INT32
+            else if(ndarray->dtype == NDARRAY_UINT32) {
+                RUN_SUM(uint32_t, int64_t, array, results, rarray, _shape_strides);
+            } else if(ndarray->dtype == NDARRAY_INT32) {
+                RUN_SUM(int32_t, int64_t, array, results, rarray, _shape_strides);
+            }
+            #endif
+            else {
                 // for floats, the sum might be inaccurate with the naive summation
                 // call mean, and multiply with the number of samples
+                results = ndarray_new_dense_ndarray_uninitialised(_shape_strides.ndim, _shape_strides.shape, NDARRAY_FLOAT);
                 farray = (mp_float_t *)results->array;
                 RUN_MEAN_STD(mp_float_t, array, farray, _shape_strides, MICROPY_FLOAT_CONST(0.0), 0);
                 mp_float_t norm = (mp_float_t)_shape_strides.shape[0];
@@ -375,6 +529,9 @@ static mp_obj_t numerical_sum_mean_std_ndarray(ndarray_obj_t *ndarray, mp_obj_t
                 for(size_t i = 0; i < results->len; i++) {
                     *farray++ *= norm;
                 }
+                if(dtype != NDARRAY_FLOAT) {
+                    results = ndarray_copy_view_convert_type(results, dtype == NDARRAY_BOOL ? NDARRAY_UINT8 : dtype);
+                }
             }
         } else {
             bool isStd = optype == NUMERICAL_STD ? 1 : 0;
@@ -393,7 +550,15 @@ static mp_obj_t numerical_sum_mean_std_ndarray(ndarray_obj_t *ndarray, mp_obj_t
                 RUN_MEAN_STD(uint16_t, array, farray, _shape_strides, div, isStd);
             } else if(ndarray->dtype == NDARRAY_INT16) {
                 RUN_MEAN_STD(int16_t, array, farray, _shape_strides, div, isStd);
-            } else {
+            }
+            #if ULAB_HAS_INT32
+            else if(ndarray->dtype == NDARRAY_UINT32) {
+                RUN_MEAN_STD(uint32_t, array, farray, _shape_strides, div, isStd);
+            } else if(ndarray->dtype == NDARRAY_INT32) {
+                RUN_MEAN_STD(int32_t, array, farray, _shape_strides, div, isStd);
+            }
+            #endif
+            else {
                 RUN_MEAN_STD(mp_float_t, array, farray, _shape_strides, div, isStd);
             }
         }
@@ -439,6 +604,37 @@ static mp_obj_t numerical_argmin_argmax_iterable(mp_obj_t oin, uint8_t optype) {
     }
 }
 
+#if ULAB_HAS_INT32
+static mp_obj_t numerical_argmin_argmax_int32(ndarray_obj_t *ndarray, uint8_t optype) {
+    // the 32-bit integer types are compared directly, because the conversion to float is not exact
+    uint8_t *array = (uint8_t *)ndarray->array;
+    bool is_signed = ndarray->dtype == NDARRAY_INT32;
+    int64_t best_value = is_signed ? (int64_t)*((int32_t *)array) : (int64_t)*((uint32_t *)array);
+    size_t index = 0, best_index = 0;
+
+    ITERATOR_HEAD()
+        int64_t value = is_signed ? (int64_t)*((int32_t *)array) : (int64_t)*((uint32_t *)array);
+        if((optype == NUMERICAL_ARGMAX) || (optype == NUMERICAL_MAX)) {
+            if(best_value < value) {
+                best_value = value;
+                best_index = index;
+            }
+        } else {
+            if(best_value > value) {
+                best_value = value;
+                best_index = index;
+            }
+        }
+        index++;
+    ITERATOR_TAIL(ndarray, array);
+
+    if((optype == NUMERICAL_ARGMIN) || (optype == NUMERICAL_ARGMAX)) {
+        return mp_obj_new_int(best_index);
+    }
+    return mp_obj_new_int_from_ll(best_value);
+}
+#endif
+
 static mp_obj_t numerical_argmin_argmax_ndarray(ndarray_obj_t *ndarray, mp_obj_t keepdims, mp_obj_t axis, uint8_t optype) {
     // TODO: treat the flattened array
     if(ndarray->len == 0) {
@@ -447,6 +643,11 @@ static mp_obj_t numerical_argmin_argmax_ndarray(ndarray_obj_t *ndarray, mp_obj_t
 
     if(axis == mp_const_none) {
         // work with the flattened array
+        #if ULAB_HAS_INT32
+        if(NDARRAY_IS_INT32(ndarray)) {
+            return numerical_argmin_argmax_int32(ndarray, optype);
+        }
+        #endif
         mp_float_t (*func)(void *) = ndarray_get_float_function(ndarray->dtype);
         uint8_t *array = (uint8_t *)ndarray->array;
         mp_float_t best_value = func(array);
@@ -505,7 +706,7 @@ static mp_obj_t numerical_argmin_argmax_ndarray(ndarray_obj_t *ndarray, mp_obj_t
         if((optype == NUMERICAL_ARGMIN) || (optype == NUMERICAL_ARGMAX)) {
             return mp_obj_new_int(best_index);
         } else {
-            if(ndarray->dtype == NDARRAY_FLOAT) {
+            if(NDARRAY_IS_FLOATING(ndarray->dtype)) {
                 return mp_obj_new_float(best_value);
             } else {
                 return MP_OBJ_NEW_SMALL_INT((int32_t)best_value);
@@ -513,6 +714,7 @@ static mp_obj_t numerical_argmin_argmax_ndarray(ndarray_obj_t *ndarray, mp_obj_t
         }
     } else {
         int8_t ax = tools_get_axis(axis, ndarray->ndim);
+        FLOAT16_PROMOTE_TO_FLOAT(ndarray);
 
         uint8_t *array = (uint8_t *)ndarray->array;
         size_t *shape = m_new0(size_t, ULAB_MAX_DIMS);
@@ -541,7 +743,15 @@ static mp_obj_t numerical_argmin_argmax_ndarray(ndarray_obj_t *ndarray, mp_obj_t
             RUN_ARGMIN(ndarray, uint16_t, array, results, rarray, shape, strides, index, optype);
         } else if(ndarray->dtype == NDARRAY_INT16) {
             RUN_ARGMIN(ndarray, int16_t, array, results, rarray, shape, strides, index, optype);
-        } else {
+        }
+        #if ULAB_HAS_INT32
+        else if(ndarray->dtype == NDARRAY_UINT32) {
+            RUN_ARGMIN(ndarray, uint32_t, array, results, rarray, shape, strides, index, optype);
+        } else if(ndarray->dtype == NDARRAY_INT32) {
+            RUN_ARGMIN(ndarray, int32_t, array, results, rarray, shape, strides, index, optype);
+        }
+        #endif
+        else {
             RUN_ARGMIN(ndarray, mp_float_t, array, results, rarray, shape, strides, index, optype);
         }
 
@@ -602,8 +812,7 @@ static mp_obj_t numerical_function(size_t n_args, const mp_obj_t *pos_args, mp_m
             case NUMERICAL_MEAN:
             case NUMERICAL_STD:
             case NUMERICAL_SUM:
-                COMPLEX_DTYPE_NOT_IMPLEMENTED(ndarray->dtype)
-                return numerical_sum_mean_std_ndarray(ndarray, axis, keepdims, optype, 0);
+                return numerical_sum_mean_std_ndarray(ndarray, axis, keepdims, optype, 0, ndarray->dtype);
             default:
                 mp_raise_NotImplementedError(MP_ERROR_TEXT("operation is not implemented on ndarrays"));
         }
@@ -620,6 +829,24 @@ static mp_obj_t numerical_sort_helper(mp_obj_t oin, mp_obj_t axis, uint8_t inpla
     }
 
     ndarray_obj_t *ndarray;
+    #if ULAB_HAS_FLOAT16
+    ndarray = MP_OBJ_TO_PTR(oin);
+    if((ndarray->dtype == NDARRAY_FLOAT16) && (ndarray->len != 0)) {
+        // the bit patterns of negative half-precision floats are not ordered,
+        // so a float copy is sorted, and the results are converted back
+        ndarray_obj_t *sorted = ndarray_copy_view_convert_type(ndarray, NDARRAY_FLOAT);
+        numerical_sort_helper(MP_OBJ_FROM_PTR(sorted), axis, 1);
+        if(inplace == 0) {
+            return MP_OBJ_FROM_PTR(ndarray_copy_view_convert_type(sorted, NDARRAY_FLOAT16));
+        }
+        mp_float_t *sarray = (mp_float_t *)sorted->array;
+        uint8_t *array = (uint8_t *)ndarray->array;
+        ITERATOR_HEAD()
+            *((uint16_t *)array) = ulab_float_to_float16(*sarray++);
+        ITERATOR_TAIL(ndarray, array);
+        return mp_const_none;
+    }
+    #endif
     if(inplace == 1) {
         ndarray = MP_OBJ_TO_PTR(oin);
     } else {
@@ -657,7 +884,15 @@ static mp_obj_t numerical_sort_helper(mp_obj_t oin, mp_obj_t axis, uint8_t inpla
             HEAPSORT(ndarray, uint8_t, array, shape, strides, ax, increment, ndarray->shape[ax]);
         } else if((ndarray->dtype == NDARRAY_UINT16) || (ndarray->dtype == NDARRAY_INT16)) {
             HEAPSORT(ndarray, uint16_t, array, shape, strides, ax, increment, ndarray->shape[ax]);
-        } else {
+        }
+        #if ULAB_HAS_INT32
+        else if(ndarray->dtype == NDARRAY_UINT32) {
+            HEAPSORT(ndarray, uint32_t, array, shape, strides, ax, increment, ndarray->shape[ax]);
+        } else if(ndarray->dtype == NDARRAY_INT32) {
+            HEAPSORT(ndarray, int32_t, array, shape, strides, ax, increment, ndarray->shape[ax]);
+        }
+        #endif
+        else {
             HEAPSORT(ndarray, mp_float_t, array, shape, strides, ax, increment, ndarray->shape[ax]);
         }
     }
@@ -729,6 +964,7 @@ mp_obj_t numerical_argsort(size_t n_args, const mp_obj_t *pos_args, mp_map_t *kw
 
     ndarray_obj_t *ndarray = MP_OBJ_TO_PTR(args[0].u_obj);
     COMPLEX_DTYPE_NOT_IMPLEMENTED(ndarray->dtype)
+    FLOAT16_PROMOTE_TO_FLOAT(ndarray);
     if(args[1].u_obj == mp_const_none) {
         // bail out, though dense arrays could still be sorted
         mp_raise_NotImplementedError(MP_ERROR_TEXT("argsort is not implemented for flattened arrays"));
@@ -807,7 +1043,15 @@ mp_obj_t numerical_argsort(size_t n_args, const mp_obj_t *pos_args, mp_map_t *kw
             HEAP_ARGSORT(ndarray, uint8_t, array, shape, strides, ax, increment, ndarray->shape[ax], iarray, istrides, iincrement);
         } else if((ndarray->dtype == NDARRAY_UINT16) || (ndarray->dtype == NDARRAY_INT16)) {
             HEAP_ARGSORT(ndarray, uint16_t, array, shape, strides, ax, increment, ndarray->shape[ax], iarray, istrides, iincrement);
-        } else {
+        }
+        #if ULAB_HAS_INT32
+        else if(ndarray->dtype == NDARRAY_UINT32) {
+            HEAP_ARGSORT(ndarray, uint32_t, array, shape, strides, ax, increment, ndarray->shape[ax], iarray, istrides, iincrement);
+        } else if(ndarray->dtype == NDARRAY_INT32) {
+            HEAP_ARGSORT(ndarray, int32_t, array, shape, strides, ax, increment, ndarray->shape[ax], iarray, istrides, iincrement);
+        }
+        #endif
+        else {
             HEAP_ARGSORT(ndarray, mp_float_t, array, shape, strides, ax, increment, ndarray->shape[ax], iarray, istrides, iincrement);
         }
     }
@@ -902,6 +1146,188 @@ MP_DEFINE_CONST_FUN_OBJ_2(numerical_cross_obj, numerical_cross);
 
 #endif /* ULAB_NUMERICAL_HAS_CROSS */
 
+#if ULAB_NUMPY_HAS_CUMSUM | ULAB_NUMPY_HAS_CUMPROD
+static void numerical_cumulative_line(uint8_t dtype, uint8_t *sarray, int32_t sstride, uint8_t *rarray, int32_t rstride, size_t len, uint8_t optype) {
+    if(optype == NUMERICAL_CUMSUM) {
+        if(dtype == NDARRAY_UINT8) {
+            RUN_CUMULATIVE1(uint8_t, sarray, sstride, rarray, rstride, len, +);
+        } else if(dtype == NDARRAY_INT8) {
+            RUN_CUMULATIVE1(int8_t, sarray, sstride, rarray, rstride, len, +);
+        } else if(dtype == NDARRAY_UINT16) {
+            RUN_CUMULATIVE1(uint16_t, sarray, sstride, rarray, rstride, len, +);
+        } else if(dtype == NDARRAY_INT16) {
+            RUN_CUMULATIVE1(int16_t, sarray, sstride, rarray, rstride, len, +);
+        }
+        #if ULAB_HAS_INT32
+        else if(dtype == NDARRAY_UINT32) {
+            RUN_CUMULATIVE1(uint32_t, sarray, sstride, rarray, rstride, len, +);
+        } else if(dtype == NDARRAY_INT32) {
+            RUN_CUMULATIVE1(int32_t, sarray, sstride, rarray, rstride, len, +);
+        }
+        #endif
+        else {
+            RUN_CUMULATIVE1(mp_float_t, sarray, sstride, rarray, rstride, len, +);
+        }
+    } else {
+        if(dtype == NDARRAY_UINT8) {
+            RUN_CUMULATIVE1(uint8_t, sarray, sstride, rarray, rstride, len, *);
+        } else if(dtype == NDARRAY_INT8) {
+            RUN_CUMULATIVE1(int8_t, sarray, sstride, rarray, rstride, len, *);
+        } else if(dtype == NDARRAY_UINT16) {
+            RUN_CUMULATIVE1(uint16_t, sarray, sstride, rarray, rstride, len, *);
+        } else if(dtype == NDARRAY_INT16) {
+            RUN_CUMULATIVE1(int16_t, sarray, sstride, rarray, rstride, len, *);
+        }
+        #if ULAB_HAS_INT32
+        else if(dtype == NDARRAY_UINT32) {
+            RUN_CUMULATIVE1(uint32_t, sarray, sstride, rarray, rstride, len, *);
+        } else if(dtype == NDARRAY_INT32) {
+            RUN_CUMULATIVE1(int32_t, sarray, sstride, rarray, rstride, len, *);
+        }
+        #endif
+        else {
+            RUN_CUMULATIVE1(mp_float_t, sarray, sstride, rarray, rstride, len, *);
+        }
+    }
+}
+
+static void numerical_cumulative_wide_line(uint8_t dtype, uint8_t *sarray, int32_t sstride, ndarray_obj_t *results,
+                                            uint8_t *rarray, int32_t rstride, size_t len, uint8_t optype) {
+    // the output has a different dtype than the input, hence, the running value is kept in a wide accumulator
+    if(NDARRAY_IS_FLOATING(dtype) || NDARRAY_IS_FLOATING(results->dtype)) {
+        mp_float_t (*get_value)(void *) = ndarray_get_float_function(dtype);
+        void (*set_value)(void *, mp_float_t) = ndarray_set_float_function(results->dtype);
+        mp_float_t acc = get_value(sarray);
+        set_value(rarray, acc);
+        for(size_t i = 1; i < len; i++) {
+            sarray += sstride;
+            rarray += rstride;
+            if(optype == NUMERICAL_CUMSUM) {
+                acc += get_value(sarray);
+            } else {
+                acc *= get_value(sarray);
+            }
+            set_value(rarray, acc);
+        }
+    } else if(optype == NUMERICAL_CUMSUM) {
+        if(dtype == NDARRAY_UINT8) {
+            RUN_CUMULATIVE_WIDE1(uint8_t, sarray, sstride, results, rarray, rstride, len, +);
+        } else if(dtype == NDARRAY_INT8) {
+            RUN_CUMULATIVE_WIDE1(int8_t, sarray, sstride, results, rarray, rstride, len, +);
+        } else if(dtype == NDARRAY_UINT16) {
+            RUN_CUMULATIVE_WIDE1(uint16_t, sarray, sstride, results, rarray, rstride, len, +);
+        } else if(dtype == NDARRAY_INT16) {
+            RUN_CUMULATIVE_WIDE1(int16_t, sarray, sstride, results, rarray, rstride, len, +);
+        }
+        #if ULAB_HAS_INT32
+        else if(dtype == NDARRAY_UINT32) {
+            RUN_CUMULATIVE_WIDE1(uint32_t, sarray, sstride, results, rarray, rstride, len, +);
+        } else if(dtype == NDARRAY_INT32) {
+            RUN_CUMULATIVE_WIDE1(int32_t, sarray, sstride, results, rarray, rstride, len, +);
+        }
+        #endif
+    } else {
+        if(dtype == NDARRAY_UINT8) {
+            RUN_CUMULATIVE_WIDE1(uint8_t, sarray, sstride, results, rarray, rstride, len, *);
+        } else if(dtype == NDARRAY_INT8) {
+            RUN_CUMULATIVE_WIDE1(int8_t, sarray, sstride, results, rarray, rstride, len, *);
+        } else if(dtype == NDARRAY_UINT16) {
+            RUN_CUMULATIVE_WIDE1(uint16_t, sarray, sstride, results, rarray, rstride, len, *);
+        } else if(dtype == NDARRAY_INT16) {
+            RUN_CUMULATIVE_WIDE1(int16_t, sarray, sstride, results, rarray, rstride, len, *);
+        }
+        #if ULAB_HAS_INT32
+        else if(dtype == NDARRAY_UINT32) {
+            RUN_CUMULATIVE_WIDE1(uint32_t, sarray, sstride, results, rarray, rstride, len, *);
+        } else if(dtype == NDARRAY_INT32) {
+            RUN_CUMULATIVE_WIDE1(int32_t, sarray, sstride, results, rarray, rstride, len, *);
+        }
+        #endif
+    }
+}
+
+static mp_obj_t numerical_cumulative(size_t n_args, const mp_obj_t *pos_args, mp_map_t *kw_args, uint8_t optype) {
+    static const mp_arg_t allowed_args[] = {
+        { MP_QSTR_, MP_ARG_REQUIRED | MP_ARG_OBJ, {.u_rom_obj = MP_ROM_NONE } },
+        { MP_QSTR_axis, MP_ARG_OBJ, {.u_rom_obj = MP_ROM_NONE } },
+        { MP_QSTR_dtype, MP_ARG_KW_ONLY | MP_ARG_OBJ, { .u_rom_obj = MP_ROM_NONE } },
+    };
+
+    mp_arg_val_t args[MP_ARRAY_SIZE(allowed_args)];
+    mp_arg_parse_all(n_args, pos_args, kw_args, MP_ARRAY_SIZE(allowed_args), allowed_args, args);
+
+    if(!mp_obj_is_type(args[0].u_obj, &ulab_ndarray_type)) {
+        mp_raise_TypeError(MP_ERROR_TEXT("input must be an ndarray"));
+    }
+    ndarray_obj_t *ndarray = MP_OBJ_TO_PTR(args[0].u_obj);
+    COMPLEX_DTYPE_NOT_IMPLEMENTED(ndarray->dtype)
+    FLOAT16_PROMOTE_TO_FLOAT(ndarray);
+
+    uint8_t dtype = numerical_get_dtype(args[2].u_obj, ndarray->dtype);
+    ndarray_obj_t *results;
+    uint8_t index;
+    if(args[1].u_obj == mp_const_none) {
+        // numpy works with the flattened array, which is simply a dense copy, and the
+        // accumulation can then be carried out in place, if the dtype does not change
+        results = ndarray_new_linear_array(ndarray->len, dtype);
+        if(ndarray->len == 0) {
+            return MP_OBJ_FROM_PTR(results);
+        }
+        ndarray_obj_t *flattened = dtype == ndarray->dtype ? results : ndarray_new_linear_array(ndarray->len, ndarray->dtype);
+        ndarray_copy_array(ndarray, flattened, 0);
+        ndarray = flattened;
+        index = ULAB_MAX_DIMS - 1;
+    } else {
+        index = ULAB_MAX_DIMS - ndarray->ndim + tools_get_axis(args[1].u_obj, ndarray->ndim);
+        results = ndarray_new_dense_ndarray_uninitialised(ndarray->ndim, ndarray->shape, dtype);
+        if(ndarray->len == 0) {
+            return MP_OBJ_FROM_PTR(results);
+        }
+    }
+
+    size_t len = ndarray->shape[index];
+    size_t nlines = ndarray->len / len;
+    for(size_t line = 0; line < nlines; line++) {
+        uint8_t *sarray = (uint8_t *)ndarray->array + tools_line_offset(ndarray, index, line);
+        uint8_t *rarray = (uint8_t *)results->array + tools_line_offset(results, index, line);
+        if(dtype == ndarray->dtype) {
+            numerical_cumulative_line(dtype, sarray, ndarray->strides[index], rarray, results->strides[index], len, optype);
+        } else {
+            numerical_cumulative_wide_line(ndarray->dtype, sarray, ndarray->strides[index], results, rarray, results->strides[index], len, optype);
+        }
+    }
+    return MP_OBJ_FROM_PTR(results);
+}
+#endif
+
+#if ULAB_NUMPY_HAS_CUMPROD
+//| def cumprod(array: ulab.numpy.ndarray, axis: Optional[int] = None, *, dtype: Optional[_DType] = None) -> ulab.numpy.ndarray:
+//|     """Return the cumulative product of the elements along the given axis, or of the flattened
+//|        array, if axis is None. The result is of the same dtype as the input, unless dtype is supplied."""
+//|     ...
+//|
+
+mp_obj_t numerical_cumprod(size_t n_args, const mp_obj_t *pos_args, mp_map_t *kw_args) {
+    return numerical_cumulative(n_args, pos_args, kw_args, NUMERICAL_CUMPROD);
+}
+
+MP_DEFINE_CONST_FUN_OBJ_KW(numerical_cumprod_obj, 1, numerical_cumprod);
+#endif
+
+#if ULAB_NUMPY_HAS_CUMSUM
+//| def cumsum(array: ulab.numpy.ndarray, axis: Optional[int] = None, *, dtype: Optional[_DType] = None) -> ulab.numpy.ndarray:
+//|     """Return the cumulative sum of the elements along the given axis, or of the flattened
+//|        array, if axis is None. The result is of the same dtype as the input, unless dtype is supplied."""
+//|     ...
+//|
+
+mp_obj_t numerical_cumsum(size_t n_args, const mp_obj_t *pos_args, mp_map_t *kw_args) {
+    return numerical_cumulative(n_args, pos_args, kw_args, NUMERICAL_CUMSUM);
+}
+
+MP_DEFINE_CONST_FUN_OBJ_KW(numerical_cumsum_obj, 1, numerical_cumsum);
+#endif
+
 #if ULAB_NUMPY_HAS_DIFF
 //| def diff(array: ulab.numpy.ndarray, *, n: int = 1, axis: int = -1) -> ulab.numpy.ndarray:
 //|     """Return the numerical derivative of successive elements of the array, as
@@ -925,6 +1351,7 @@ mp_obj_t numerical_diff(size_t n_args, const mp_obj_t *pos_args, mp_map_t *kw_ar
 
     ndarray_obj_t *ndarray = MP_OBJ_TO_PTR(args[0].u_obj);
     COMPLEX_DTYPE_NOT_IMPLEMENTED(ndarray->dtype)
+    FLOAT16_PROMOTE_TO_FLOAT(ndarray);
     int8_t ax = args[2].u_int;
     if(ax < 0) ax += ndarray->ndim;
 
@@ -970,7 +1397,15 @@ mp_obj_t numerical_diff(size_t n_args, const mp_obj_t *pos_args, mp_map_t *kw_ar
         RUN_DIFF(ndarray, uint16_t, array, results, rarray, shape, strides, index, stencil, N);
     } else if(ndarray->dtype == NDARRAY_INT16) {
         RUN_DIFF(ndarray, int16_t, array, results, rarray, shape, strides, index, stencil, N);
-    } else {
+    }
+    #if ULAB_HAS_INT32
+    else if(ndarray->dtype == NDARRAY_UINT32) {
+        RUN_DIFF(ndarray, uint32_t, array, results, rarray, shape, strides, index, stencil, N);
+    } else if(ndarray->dtype == NDARRAY_INT32) {
+        RUN_DIFF(ndarray, int32_t, array, results, rarray, shape, strides, index, stencil, N);
+    }
+    #endif
+    else {
         RUN_DIFF(ndarray, mp_float_t, array, results, rarray, shape, strides, index, stencil, N);
     }
     m_del(int8_t, stencil, N+1);
@@ -1405,7 +1840,7 @@ mp_obj_t numerical_std(size_t n_args, const mp_obj_t *pos_args, mp_map_t *kw_arg
         return numerical_sum_mean_std_iterable(oin, NUMERICAL_STD, ddof);
     } else if(mp_obj_is_type(oin, &ulab_ndarray_type)) {
         ndarray_obj_t *ndarray = MP_OBJ_TO_PTR(oin);
-        return numerical_sum_mean_std_ndarray(ndarray, axis, keepdims, NUMERICAL_STD, ddof);
+        return numerical_sum_mean_std_ndarray(ndarray, axis, keepdims, NUMERICAL_STD, ddof, NDARRAY_FLOAT);
     } else {
         mp_raise_TypeError(MP_ERROR_TEXT("input must be tuple, list, range, or ndarray"));
     }
@@ -1416,13 +1851,41 @@ MP_DEFINE_CONST_FUN_OBJ_KW(numerical_std_obj, 1, numerical_std);
 #endif
 
 #if ULAB_NUMPY_HAS_SUM
-//| def sum(array: _ArrayLike, *, axis: Optional[int] = None) -> Union[_float, int, ulab.numpy.ndarray]:
-//|     """Return the sum of the array, as a number if axis is None, otherwise as an array."""
+//| def sum(array: _ArrayLike, *, axis: Optional[int] = None, dtype: Optional[_DType] = None) -> Union[_float, int, ulab.numpy.ndarray]:
+//|     """Return the sum of the array, as a number if axis is None, otherwise as an array.
+//|        If dtype is supplied, the results are converted to dtype, otherwise, they are of the same type as the input."""
 //|     ...
 //|
 
 mp_obj_t numerical_sum(size_t n_args, const mp_obj_t *pos_args, mp_map_t *kw_args) {
-    return numerical_function(n_args, pos_args, kw_args, NUMERICAL_SUM);
+    static const mp_arg_t allowed_args[] = {
+        { MP_QSTR_, MP_ARG_REQUIRED | MP_ARG_OBJ, { .u_rom_obj = MP_ROM_NONE} } ,
+        { MP_QSTR_axis, MP_ARG_OBJ, { .u_rom_obj = MP_ROM_NONE } },
+        { MP_QSTR_keepdims, MP_ARG_OBJ, { .u_rom_obj = MP_ROM_FALSE } },
+        { MP_QSTR_dtype, MP_ARG_KW_ONLY | MP_ARG_OBJ, { .u_rom_obj = MP_ROM_NONE } },
+    };
+
+    mp_arg_val_t args[MP_ARRAY_SIZE(allowed_args)];
+    mp_arg_parse_all(n_args, pos_args, kw_args, MP_ARRAY_SIZE(allowed_args), allowed_args, args);
+
+    mp_obj_t oin = args[0].u_obj;
+    mp_obj_t axis = args[1].u_obj;
+    mp_obj_t keepdims = args[2].u_obj;
+
+    if((axis != mp_const_none) && (!mp_obj_is_int(axis))) {
+        mp_raise_TypeError(MP_ERROR_TEXT("axis must be None, or an integer"));
+    }
+
+    if(mp_obj_is_type(oin, &mp_type_tuple) || mp_obj_is_type(oin, &mp_type_list) || mp_obj_is_type(oin, &mp_type_range)) {
+        return numerical_sum_mean_std_iterable(oin, NUMERICAL_SUM, 0);
+    } else if(mp_obj_is_type(oin, &ulab_ndarray_type)) {
+        ndarray_obj_t *ndarray = MP_OBJ_TO_PTR(oin);
+        uint8_t dtype = numerical_get_dtype(args[3].u_obj, ndarray->dtype);
+        return numerical_sum_mean_std_ndarray(ndarray, axis, keepdims, NUMERICAL_SUM, 0, dtype);
+    } else {
+        mp_raise_TypeError(MP_ERROR_TEXT("input must be tuple, list, range, or ndarray"));
+    }
+    return mp_const_none;
 }
 
 MP_DEFINE_CONST_FUN_OBJ_KW(numerical_sum_obj, 1, numerical_sum);
@@ -15,7 +15,33 @@
 #include "../ulab.h"
 #include "../ndarray.h"
 
-// TODO: implement cumsum
+// the running sum, or product of a single slice; the accumulator is of the same type as the
+// input, hence, integer results wrap around in the same way as the elements of the array would
+#define RUN_CUMULATIVE1(type, sarray, sstride, rarray, rstride, len, op)\
+({\
+    type acc = *((type *)(sarray));\
+    *((type *)(rarray)) = acc;\
+    for(size_t i = 1; i < (len); i++) {\
+        (sarray) += (sstride);\
+        (rarray) += (rstride);\
+        acc = acc op *((type *)(sarray));\
+        *((type *)(rarray)) = acc;\
+    }\
+})
+
+// integers are accumulated in 64 bits, and are converted to the output's dtype at each step; unsigned
+// arithmetic wraps in a well-defined way, and agrees with the signed one in the bits that are kept
+#define RUN_CUMULATIVE_WIDE1(type, sarray, sstride, results, rarray, rstride, len, op)\
+({\
+    uint64_t acc = (uint64_t)(int64_t)*((type *)(sarray));\
+    numerical_sum_set_value((results), (rarray), (int64_t)acc);\
+    for(size_t i = 1; i < (len); i++) {\
+        (sarray) += (sstride);\
+        (rarray) += (rstride);\
+        acc = acc op (uint64_t)(int64_t)*((type *)(sarray));\
+        numerical_sum_set_value((results), (rarray), (int64_t)acc);\
+    }\
+})
 
 #define RUN_ARGMIN1(ndarray, type, array, results, rarray, index, op)\
 ({\
@@ -46,32 +72,65 @@
     (rarray) += (results)->itemsize;\
 })
 
-#define RUN_SUM1(type, array, results, rarray, ss)\
+// the sum is accumulated in acctype, which is wider than the input type, so that
+// the intermediate results cannot overflow; the conversion happens only at the very end
+#define RUN_SUM1(type, acctype, array, results, rarray, ss)\
 ({\
-    type sum = 0;\
+    acctype sum = 0;\
     for(size_t i=0; i < (ss).shape[0]; i++) {\
         sum += *((type *)(array));\
         (array) += (ss).strides[0];\
     }\
-    memcpy((rarray), &sum, (results)->itemsize);\
+    numerical_sum_set_value((results), (rarray), (int64_t)sum);\
     (rarray) += (results)->itemsize;\
 })
 
-// Instead of the straightforward implementation of the definition,
-// we take the numerically stable Welford algorithm here
-// https://www.johndcook.com/blog/2008/09/26/comparing-three-methods-of-computing-standard-deviation/
-#define RUN_MEAN_STD1(type, array, rarray, ss, div, isStd)\
+// the integer sum of the flattened array; the 64-bit accumulator is exact for all integer types
+#define RUN_SUM_FLAT(type, ndarray, array, sum) do {\
+    ITERATOR_HEAD()\
+        (sum) += *((type *)(array));\
+    ITERATOR_TAIL((ndarray), (array));\
+} while(0)
+
+// Welford's algorithm is numerically stable, but it needs a division for each element. Instead, the
+// data are processed in blocks of ULAB_NUMERICAL_BLOCK_SIZE: the block is summed directly, the squared
+// deviations are accumulated around the block mean in a second pass, and then the block is merged into
+// the running mean M, and sum of squared deviations S with the parallel formula of Chan et al.
+// https://en.wikipedia.org/wiki/Algorithms_for_calculating_variance#Parallel_algorithm
+#define MEAN_STD_BLOCKED(type, array, stride, len, count, M, S, isStd)\
 ({\
-    mp_float_t M = 0.0, m = 0.0, S = 0.0;\
-    for(size_t i=0; i < (ss).shape[0]; i++) {\
-        mp_float_t value = (mp_float_t)(*(type *)(array));\
-        m = M + (value - M) / (mp_float_t)(i+1);\
+    size_t remaining = (len);\
+    while(remaining > 0) {\
+        size_t nblock = remaining < ULAB_NUMERICAL_BLOCK_SIZE ? remaining : ULAB_NUMERICAL_BLOCK_SIZE;\
+        uint8_t *block = (array);\
+        mp_float_t bsum = MICROPY_FLOAT_CONST(0.0);\
+        for(size_t b = 0; b < nblock; b++) {\
+            bsum += (mp_float_t)*((type *)(array));\
+            (array) += (stride);\
+        }\
+        mp_float_t bmean = bsum / (mp_float_t)nblock;\
+        mp_float_t delta = bmean - (M);\
+        mp_float_t weight = (mp_float_t)nblock / (mp_float_t)((count) + nblock);\
         if(isStd) {\
-            S += (value - M) * (value - m);\
+            mp_float_t bS = MICROPY_FLOAT_CONST(0.0);\
+            for(size_t b = 0; b < nblock; b++) {\
+                mp_float_t dev = (mp_float_t)*((type *)block) - bmean;\
+                bS += dev * dev;\
+                block += (stride);\
+            }\
+            (S) += bS + delta * delta * (mp_float_t)(count) * weight;\
         }\
-        M = m;\
-        (array) += (ss).strides[0];\
+        (M) += delta * weight;\
+        (count) += nblock;\
+        remaining -= nblock;\
     }\
+})
+
+#define RUN_MEAN_STD1(type, array, rarray, ss, div, isStd)\
+({\
+    mp_float_t M = MICROPY_FLOAT_CONST(0.0), S = MICROPY_FLOAT_CONST(0.0);\
+    size_t count = 0;\
+    MEAN_STD_BLOCKED(type, (array), (ss).strides[0], (ss).shape[0], count, M, S, (isStd));\
     *(rarray)++ = isStd ? MICROPY_FLOAT_C_FUN(sqrt)(S / (div)) : M;\
 })
 
@@ -163,8 +222,8 @@
 })
 
 #if ULAB_MAX_DIMS == 1
-#define RUN_SUM(type, array, results, rarray, ss) do {\
-    RUN_SUM1(type, (array), (results), (rarray), (ss));\
+#define RUN_SUM(type, acctype, array, results, rarray, ss) do {\
+    RUN_SUM1(type, acctype, (array), (results), (rarray), (ss));\
 } while(0)
 
 #define RUN_MEAN_STD(type, array, rarray, ss, div, isStd) do {\
@@ -190,10 +249,10 @@
 #endif
 
 #if ULAB_MAX_DIMS == 2
-#define RUN_SUM(type, array, results, rarray, ss) do {\
+#define RUN_SUM(type, acctype, array, results, rarray, ss) do {\
     size_t l = 0;\
     do {\
-        RUN_SUM1(type, (array), (results), (rarray), (ss));\
+        RUN_SUM1(type, acctype, (array), (results), (rarray), (ss));\
         (array) -= (ss).strides[0] * (ss).shape[0];\
         (array) += (ss).strides[ULAB_MAX_DIMS - 1];\
         l++;\
@@ -255,12 +314,12 @@
 #endif
 
 #if ULAB_MAX_DIMS == 3
-#define RUN_SUM(type, array, results, rarray, ss) do {\
+#define RUN_SUM(type, acctype, array, results, rarray, ss) do {\
     size_t k = 0;\
     do {\
         size_t l = 0;\
         do {\
-            RUN_SUM1(type, (array), (results), (rarray), (ss));\
+            RUN_SUM1(type, acctype, (array), (results), (rarray), (ss));\
             (array) -= (ss).strides[0] * (ss).shape[0];\
             (array) += (ss).strides[ULAB_MAX_DIMS - 1];\
             l++;\
@@ -359,14 +418,14 @@
 #endif
 
 #if ULAB_MAX_DIMS == 4
-#define RUN_SUM(type, array, results, rarray, ss) do {\
+#define RUN_SUM(type, acctype, array, results, rarray, ss) do {\
     size_t j = 0;\
     do {\
         size_t k = 0;\
         do {\
             size_t l = 0;\
             do {\
-                RUN_SUM1(type, (array), (results), (rarray), (ss));\
+                RUN_SUM1(type, acctype, (array), (results), (rarray), (ss));\
                 (array) -= (ss).strides[0] * (ss).shape[0];\
                 (array) += (ss).strides[ULAB_MAX_DIMS - 1];\
                 l++;\
@@ -508,6 +567,8 @@ MP_DECLARE_CONST_FUN_OBJ_KW(numerical_argmax_obj);
 MP_DECLARE_CONST_FUN_OBJ_KW(numerical_argmin_obj);
 MP_DECLARE_CONST_FUN_OBJ_KW(numerical_argsort_obj);
 MP_DECLARE_CONST_FUN_OBJ_2(numerical_cross_obj);
+MP_DECLARE_CONST_FUN_OBJ_KW(numerical_cumprod_obj);
+MP_DECLARE_CONST_FUN_OBJ_KW(numerical_cumsum_obj);
 MP_DECLARE_CONST_FUN_OBJ_KW(numerical_diff_obj);
 MP_DECLARE_CONST_FUN_OBJ_KW(numerical_flip_obj);
 MP_DECLARE_CONST_FUN_OBJ_KW(numerical_max_obj);
@@ -100,7 +100,14 @@ static const mp_rom_map_elem_t ulab_numpy_globals_table[] = {
     { MP_ROM_QSTR(MP_QSTR_int8), MP_ROM_INT(NDARRAY_INT8) },
     { MP_ROM_QSTR(MP_QSTR_uint16), MP_ROM_INT(NDARRAY_UINT16) },
     { MP_ROM_QSTR(MP_QSTR_int16), MP_ROM_INT(NDARRAY_INT16) },
+    #if ULAB_HAS_INT32
+        { MP_ROM_QSTR(MP_QSTR_uint32), MP_ROM_INT(NDARRAY_UINT32) },
+        { MP_ROM_QSTR(MP_QSTR_int32), MP_ROM_INT(NDARRAY_INT32) },
+    #endif
     { MP_ROM_QSTR(MP_QSTR_float), MP_ROM_INT(NDARRAY_FLOAT) },
+    #if ULAB_HAS_FLOAT16
+        { MP_ROM_QSTR(MP_QSTR_float16), MP_ROM_INT(NDARRAY_FLOAT16) },
+    #endif
     #if ULAB_SUPPORTS_COMPLEX
         { MP_ROM_QSTR(MP_QSTR_complex), MP_ROM_INT(NDARRAY_COMPLEX) },
     #endif
@@ -139,7 +146,7 @@ static const mp_rom_map_elem_t ulab_numpy_globals_table[] = {
         #endif
     #endif
     #if ULAB_NUMPY_HAS_EMPTY
-        { MP_ROM_QSTR(MP_QSTR_empty), MP_ROM_PTR(&create_zeros_obj) },
+        { MP_ROM_QSTR(MP_QSTR_empty), MP_ROM_PTR(&create_empty_obj) },
     #endif
     #if ULAB_MAX_DIMS > 1
         #if ULAB_NUMPY_HAS_EYE
@@ -184,6 +191,9 @@ static const mp_rom_map_elem_t ulab_numpy_globals_table[] = {
     #if ULAB_NUMPY_HAS_NOTEQUAL
         { MP_ROM_QSTR(MP_QSTR_not_equal), MP_ROM_PTR(&compare_not_equal_obj) },
     #endif
+    #if ULAB_NUMPY_HAS_FLATNONZERO
+        { MP_ROM_QSTR(MP_QSTR_flatnonzero), MP_ROM_PTR(&compare_flatnonzero_obj) },
+    #endif
     #if ULAB_NUMPY_HAS_ISFINITE
         { MP_ROM_QSTR(MP_QSTR_isfinite), MP_ROM_PTR(&compare_isfinite_obj) },
     #endif
@@ -206,6 +216,9 @@ static const mp_rom_map_elem_t ulab_numpy_globals_table[] = {
     #if ULAB_NUMPY_HAS_BITWISE_AND
         { MP_ROM_QSTR(MP_QSTR_bitwise_and), MP_ROM_PTR(&bitwise_bitwise_and_obj) },
     #endif
+    #if ULAB_NUMPY_HAS_BITWISE_COUNT
+        { MP_ROM_QSTR(MP_QSTR_bitwise_count), MP_ROM_PTR(&bitwise_bitwise_count_obj) },
+    #endif
     #if ULAB_NUMPY_HAS_BITWISE_OR
         { MP_ROM_QSTR(MP_QSTR_bitwise_or), MP_ROM_PTR(&bitwise_bitwise_or_obj) },
     #endif
@@ -218,6 +231,15 @@ static const mp_rom_map_elem_t ulab_numpy_globals_table[] = {
     #if ULAB_NUMPY_HAS_RIGHT_SHIFT
         { MP_ROM_QSTR(MP_QSTR_right_shift), MP_ROM_PTR(&right_shift_obj) },
     #endif
+    #if ULAB_NUMPY_HAS_COUNT_NONZERO
+        { MP_ROM_QSTR(MP_QSTR_count_nonzero), MP_ROM_PTR(&bitwise_count_nonzero_obj) },
+    #endif
+    #if ULAB_NUMPY_HAS_PACKBITS
+        { MP_ROM_QSTR(MP_QSTR_packbits), MP_ROM_PTR(&bitwise_packbits_obj) },
+    #endif
+    #if ULAB_NUMPY_HAS_UNPACKBITS
+        { MP_ROM_QSTR(MP_QSTR_unpackbits), MP_ROM_PTR(&bitwise_unpackbits_obj) },
+    #endif
     // functions of the filter sub-module
     #if ULAB_NUMPY_HAS_CONVOLVE
         { MP_ROM_QSTR(MP_QSTR_convolve), MP_ROM_PTR(&filter_convolve_obj) },
@@ -242,6 +264,12 @@ static const mp_rom_map_elem_t ulab_numpy_globals_table[] = {
     #if ULAB_NUMPY_HAS_CROSS
         { MP_ROM_QSTR(MP_QSTR_cross), MP_ROM_PTR(&numerical_cross_obj) },
     #endif
+    #if ULAB_NUMPY_HAS_CUMPROD
+        { MP_ROM_QSTR(MP_QSTR_cumprod), MP_ROM_PTR(&numerical_cumprod_obj) },
+    #endif
+    #if ULAB_NUMPY_HAS_CUMSUM
+        { MP_ROM_QSTR(MP_QSTR_cumsum), MP_ROM_PTR(&numerical_cumsum_obj) },
+    #endif
     #if ULAB_NUMPY_HAS_DIFF
         { MP_ROM_QSTR(MP_QSTR_diff), MP_ROM_PTR(&numerical_diff_obj) },
     #endif
@@ -387,6 +415,9 @@ static const mp_rom_map_elem_t ulab_numpy_globals_table[] = {
     { MP_ROM_QSTR(MP_QSTR_vectorize), MP_ROM_PTR(&vector_vectorize_obj) },
     #endif
     #if ULAB_SUPPORTS_COMPLEX
+        #if ULAB_NUMPY_HAS_ANGLE
+        { MP_ROM_QSTR(MP_QSTR_angle), MP_ROM_PTR(&carray_angle_obj) },
+        #endif
         #if ULAB_NUMPY_HAS_REAL
         { MP_ROM_QSTR(MP_QSTR_real), MP_ROM_PTR(&carray_real_obj) },
         #endif
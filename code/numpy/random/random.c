@@ -9,6 +9,7 @@
 */
 
 #include <math.h>
+#include <string.h>
 
 #include "py/builtin.h"
 #include "py/obj.h"
@@ -21,12 +22,36 @@ ULAB_DEFINE_FLOAT_CONST(random_one, MICROPY_FLOAT_CONST(1.0), 0x3f800000UL, 0x3f
 
 // methods of the Generator object
 static const mp_rom_map_elem_t random_generator_locals_dict_table[] = {
+    #if ULAB_NUMPY_RANDOM_HAS_ADVANCE
+        { MP_ROM_QSTR(MP_QSTR_advance), MP_ROM_PTR(&random_advance_obj) },
+    #endif
+    #if ULAB_NUMPY_RANDOM_HAS_CHOICE
+        { MP_ROM_QSTR(MP_QSTR_choice), MP_ROM_PTR(&random_choice_obj) },
+    #endif
+    #if ULAB_NUMPY_RANDOM_HAS_EXPONENTIAL
+        { MP_ROM_QSTR(MP_QSTR_exponential), MP_ROM_PTR(&random_exponential_obj) },
+    #endif
+    #if ULAB_NUMPY_RANDOM_HAS_INTEGERS
+        { MP_ROM_QSTR(MP_QSTR_integers), MP_ROM_PTR(&random_integers_obj) },
+    #endif
+    #if ULAB_NUMPY_RANDOM_HAS_JUMPED
+        { MP_ROM_QSTR(MP_QSTR_jumped), MP_ROM_PTR(&random_jumped_obj) },
+    #endif
     #if ULAB_NUMPY_RANDOM_HAS_NORMAL
         { MP_ROM_QSTR(MP_QSTR_normal), MP_ROM_PTR(&random_normal_obj) },
     #endif
+    #if ULAB_NUMPY_RANDOM_HAS_PERMUTATION
+        { MP_ROM_QSTR(MP_QSTR_permutation), MP_ROM_PTR(&random_permutation_obj) },
+    #endif
     #if ULAB_NUMPY_RANDOM_HAS_RANDOM
         { MP_ROM_QSTR(MP_QSTR_random), MP_ROM_PTR(&random_random_obj) },
     #endif
+    #if ULAB_NUMPY_RANDOM_HAS_SPAWN
+        { MP_ROM_QSTR(MP_QSTR_spawn), MP_ROM_PTR(&random_spawn_obj) },
+    #endif
+    #if ULAB_NUMPY_RANDOM_HAS_STANDARD_NORMAL
+        { MP_ROM_QSTR(MP_QSTR_standard_normal), MP_ROM_PTR(&random_standard_normal_obj) },
+    #endif
     #if ULAB_NUMPY_RANDOM_HAS_UNIFORM
         { MP_ROM_QSTR(MP_QSTR_uniform), MP_ROM_PTR(&random_uniform_obj) },
     #endif
@@ -60,6 +85,15 @@ void random_generator_print(const mp_print_t *print, mp_obj_t self_in, mp_print_
     mp_printf(MP_PYTHON_PRINTER, "Generator() at 0x%p", self);
 }
 
+static random_generator_obj_t *random_new_generator(uint64_t state, uint64_t increment) {
+    random_generator_obj_t *generator = m_new_obj(random_generator_obj_t);
+    generator->base.type = &random_generator_type;
+    generator->state = state;
+    // the increment selects the stream, and it must be odd
+    generator->increment = increment | 1;
+    return generator;
+}
+
 mp_obj_t random_generator_make_new(const mp_obj_type_t *type, size_t n_args, size_t n_kw, const mp_obj_t *args) {
     (void) type;
     mp_arg_check_num(n_args, n_kw, 0, 1, true);
@@ -77,25 +111,16 @@ mp_obj_t random_generator_make_new(const mp_obj_type_t *type, size_t n_args, siz
         #ifndef MICROPY_PY_RANDOM_SEED_INIT_FUNC
         mp_raise_ValueError(MP_ERROR_TEXT("no default seed"));
         #else
-        random_generator_obj_t *generator = m_new_obj(random_generator_obj_t);
-        generator->base.type = &random_generator_type;
-        generator->state = MICROPY_PY_RANDOM_SEED_INIT_FUNC;
-        return MP_OBJ_FROM_PTR(generator);
+        return MP_OBJ_FROM_PTR(random_new_generator(MICROPY_PY_RANDOM_SEED_INIT_FUNC, PCG_INCREMENT_64));
         #endif
     } else if(mp_obj_is_int(args[0])) {
-        random_generator_obj_t *generator = m_new_obj(random_generator_obj_t);
-        generator->base.type = &random_generator_type;
-        generator->state = (size_t)mp_obj_get_int(args[0]);
-        return MP_OBJ_FROM_PTR(generator);
+        return MP_OBJ_FROM_PTR(random_new_generator((size_t)mp_obj_get_int(args[0]), PCG_INCREMENT_64));
     } else if(mp_obj_is_type(args[0], &mp_type_tuple)){
         mp_obj_tuple_t *seeds = MP_OBJ_TO_PTR(args[0]);
         mp_obj_t *items = m_new(mp_obj_t, seeds->len);
 
         for(uint8_t i = 0; i < seeds->len; i++) {
-            random_generator_obj_t *generator = m_new_obj(random_generator_obj_t);
-            generator->base.type = &random_generator_type;
-            generator->state = (size_t)mp_obj_get_int(seeds->items[i]);
-            items[i] = generator;
+            items[i] = MP_OBJ_FROM_PTR(random_new_generator((size_t)mp_obj_get_int(seeds->items[i]), PCG_INCREMENT_64));
         }
         return mp_obj_new_tuple(seeds->len, items);
     } else {
@@ -107,130 +132,262 @@ mp_obj_t random_generator_make_new(const mp_obj_type_t *type, size_t n_args, siz
 // END OF GENERATOR COMPONENTS
 
 
-static inline uint32_t pcg32_next(uint64_t *state) {
-    uint64_t old_state = *state;
-    *state = old_state * PCG_MULTIPLIER_64 + PCG_INCREMENT_64;
+static inline uint32_t pcg32_next(random_generator_obj_t *generator) {
+    uint64_t old_state = generator->state;
+    generator->state = old_state * PCG_MULTIPLIER_64 + generator->increment;
     uint32_t value = (uint32_t)((old_state ^ (old_state >> 18)) >> 27);
     int rot = old_state >> 59;
     return rot ? (value >> rot) | (value << (32 - rot)) : value;
 }
 
 #if MICROPY_FLOAT_IMPL == MICROPY_FLOAT_IMPL_DOUBLE
-static inline uint64_t pcg32_next64(uint64_t *state) {
-    uint64_t value = pcg32_next(state);
+static inline uint64_t pcg32_next64(random_generator_obj_t *generator) {
+    uint64_t value = pcg32_next(generator);
     value <<= 32;
-    value |= pcg32_next(state);
+    value |= pcg32_next(generator);
     return value;
 }
 #endif
 
-#if ULAB_NUMPY_RANDOM_HAS_NORMAL
-static mp_obj_t random_normal(size_t n_args, const mp_obj_t *pos_args, mp_map_t *kw_args) {
-    static const mp_arg_t allowed_args[] = {
-        { MP_QSTR_, MP_ARG_OBJ, { .u_rom_obj = MP_ROM_NONE } },
-        { MP_QSTR_loc, MP_ARG_OBJ, { .u_rom_obj = ULAB_REFERENCE_FLOAT_CONST(random_zero) } },
-        { MP_QSTR_scale, MP_ARG_OBJ, { .u_rom_obj = ULAB_REFERENCE_FLOAT_CONST(random_one) } },
-        { MP_QSTR_size, MP_ARG_OBJ, { .u_rom_obj = MP_ROM_NONE } },
-    };
+#if ULAB_NUMPY_RANDOM_HAS_ADVANCE | ULAB_NUMPY_RANDOM_HAS_INTEGERS | ULAB_NUMPY_RANDOM_HAS_JUMPED
+static uint64_t random_int_bits(mp_obj_t obj) {
+    // returns the lowest 64 bits of an integer in two's complement; long integers, e.g., 2**32
+    // on 32-bit ports, do not fit into mp_int_t, so they are taken apart 32 bits at a time
+    if(!mp_obj_is_type(obj, &mp_type_int)) {
+        return (uint64_t)(int64_t)mp_obj_get_int(obj);
+    }
+    mp_obj_t mask = mp_obj_new_int_from_uint(UINT32_MAX);
+    uint64_t low = (uint32_t)mp_obj_int_get_truncated(mp_binary_op(MP_BINARY_OP_AND, obj, mask));
+    obj = mp_binary_op(MP_BINARY_OP_RSHIFT, obj, MP_OBJ_NEW_SMALL_INT(32));
+    uint64_t high = (uint32_t)mp_obj_int_get_truncated(mp_binary_op(MP_BINARY_OP_AND, obj, mask));
+    return (high << 32) | low;
+}
+#endif
 
-    mp_arg_val_t args[MP_ARRAY_SIZE(allowed_args)];
-    mp_arg_parse_all(n_args, pos_args, kw_args, MP_ARRAY_SIZE(allowed_args), allowed_args, args);
+#if ULAB_NUMPY_RANDOM_HAS_ADVANCE | ULAB_NUMPY_RANDOM_HAS_JUMPED
+static void pcg32_advance(random_generator_obj_t *generator, uint64_t delta) {
+    // advances the state by delta steps in O(log(delta)) time (F. Brown, "Random number
+    // generation with arbitrary strides"); since the arithmetic is modulo 2^64, a negative
+    // delta cast to uint64_t moves the generator backwards
+    uint64_t multiplier = PCG_MULTIPLIER_64;
+    uint64_t increment = generator->increment;
+    uint64_t acc_multiplier = 1;
+    uint64_t acc_increment = 0;
+    while(delta > 0) {
+        if(delta & 1) {
+            acc_multiplier *= multiplier;
+            acc_increment = acc_increment * multiplier + increment;
+        }
+        increment = (multiplier + 1) * increment;
+        multiplier *= multiplier;
+        delta >>= 1;
+    }
+    generator->state = acc_multiplier * generator->state + acc_increment;
+}
+#endif
 
-    random_generator_obj_t *self = MP_OBJ_TO_PTR(args[0].u_obj);
-    mp_float_t loc = mp_obj_get_float(args[1].u_obj);
-    mp_float_t scale = mp_obj_get_float(args[2].u_obj);
-    mp_obj_t size = args[3].u_obj;
+static inline mp_float_t random_next_float(random_generator_obj_t *generator) {
+    // returns a uniformly distributed number in the interval [0, 1)
+    #if MICROPY_FLOAT_IMPL == MICROPY_FLOAT_IMPL_FLOAT
+    uint32_t x = pcg32_next(generator);
+    return (float)(int32_t)(x >> 8) * 0x1.0p-24f;
+    #else
+    uint64_t x = pcg32_next64(generator);
+    return (double)(int64_t)(x >> 11) * 0x1.0p-53;
+    #endif
+}
 
-    ndarray_obj_t *ndarray = NULL;
-    mp_float_t u, v, value;
+#if ULAB_NUMPY_RANDOM_HAS_ADVANCE
+static mp_obj_t random_advance(mp_obj_t self_in, mp_obj_t delta) {
+    // delta is counted in 32-bit steps, as in numpy's PCG64.advance, and not in draws;
+    // with double-precision floats, each call to random_next_float takes two steps
+    random_generator_obj_t *self = MP_OBJ_TO_PTR(self_in);
+    // only the count modulo 2^64 matters, hence, long integers are accepted, too
+    pcg32_advance(self, random_int_bits(delta));
+    return self_in;
+}
 
-    if(size != mp_const_none) {
-        if(mp_obj_is_int(size)) {
-            ndarray = ndarray_new_linear_array((size_t)mp_obj_get_int(size), NDARRAY_FLOAT);
-        } else if(mp_obj_is_type(size, &mp_type_tuple)) {
-            mp_obj_tuple_t *_shape = MP_OBJ_TO_PTR(size);
-            ndarray = ndarray_new_ndarray_from_tuple(_shape, NDARRAY_FLOAT);
-        } else { // input type not supported
-            mp_raise_TypeError(MP_ERROR_TEXT("shape must be None, an integer or a tuple of integers"));
+MP_DEFINE_CONST_FUN_OBJ_2(random_advance_obj, random_advance);
+#endif /* ULAB_NUMPY_RANDOM_HAS_ADVANCE */
+
+#if ULAB_NUMPY_RANDOM_HAS_CHOICE | ULAB_NUMPY_RANDOM_HAS_INTEGERS | ULAB_NUMPY_RANDOM_HAS_PERMUTATION
+static uint32_t random_bounded(random_generator_obj_t *generator, uint32_t range) {
+    // returns an unbiased integer in the interval [0, range) by means of Lemire's
+    // multiply-and-reject method; the division is evaluated only in the rare case,
+    // when the sample falls into the biased region
+    uint64_t m = (uint64_t)pcg32_next(generator) * range;
+    uint32_t low = (uint32_t)m;
+    if(low < range) {
+        uint32_t threshold = (uint32_t)(-range) % range;
+        while(low < threshold) {
+            m = (uint64_t)pcg32_next(generator) * range;
+            low = (uint32_t)m;
         }
-    } else {
-        // return single value
-        #if MICROPY_FLOAT_IMPL == MICROPY_FLOAT_IMPL_FLOAT
-        uint32_t x = pcg32_next(&self->state);
-        u = (float)(int32_t)(x >> 8) * 0x1.0p-24f;
-        x = pcg32_next(&self->state);
-        v = (float)(int32_t)(x >> 8) * 0x1.0p-24f;
-        #else
-        uint64_t x = pcg32_next64(&self->state);
-        u = (double)(int64_t)(x >> 11) * 0x1.0p-53;
-        x = pcg32_next64(&self->state);
-        v = (double)(int64_t)(x >> 11) * 0x1.0p-53;
-        #endif
-        mp_float_t sqrt_log = MICROPY_FLOAT_C_FUN(sqrt)(-MICROPY_FLOAT_CONST(2.0) * MICROPY_FLOAT_C_FUN(log)(u));
-        value = sqrt_log * MICROPY_FLOAT_C_FUN(cos)(MICROPY_FLOAT_CONST(2.0) * MP_PI * v);
-        return mp_obj_new_float(loc + scale * value);
     }
+    return (uint32_t)(m >> 32);
+}
+#endif
 
-    mp_float_t *array = (mp_float_t *)ndarray->array;
+#if ULAB_NUMPY_RANDOM_HAS_NORMAL | ULAB_NUMPY_RANDOM_HAS_STANDARD_NORMAL
+// Ziggurat tables for the normal distribution (Marsaglia & Tsang, with Doornik's
+// improvement, i.e., the layer index and the abscissa are taken from disjoint bits).
+// random_ziggurat_x holds the right edges of the 128 layers of equal area,
+// random_ziggurat_x[0] is the pseudo-edge of the base layer, which includes the tail,
+// and random_ziggurat_f is the (unnormalised) density at the edges.
+#define RANDOM_ZIGGURAT_R       MICROPY_FLOAT_CONST(3.4426198558966514)
+
+static const mp_float_t random_ziggurat_x[129] = {
+    MICROPY_FLOAT_CONST(3.7130862467403629), MICROPY_FLOAT_CONST(3.4426198558966514), MICROPY_FLOAT_CONST(3.2230849845786178),
+    MICROPY_FLOAT_CONST(3.0832288582142127), MICROPY_FLOAT_CONST(2.9786962526450158), MICROPY_FLOAT_CONST(2.8943440070186695),
+    MICROPY_FLOAT_CONST(2.8231253505459653), MICROPY_FLOAT_CONST(2.7611693723841526), MICROPY_FLOAT_CONST(2.7061135731187211),
+    MICROPY_FLOAT_CONST(2.6564064112581911), MICROPY_FLOAT_CONST(2.6109722484286118), MICROPY_FLOAT_CONST(2.5690336259216378),
+    MICROPY_FLOAT_CONST(2.5300096723854653), MICROPY_FLOAT_CONST(2.4934545220919495), MICROPY_FLOAT_CONST(2.4590181774083488),
+    MICROPY_FLOAT_CONST(2.4264206455302104), MICROPY_FLOAT_CONST(2.3954342780074662), MICROPY_FLOAT_CONST(2.3658713701139864),
+    MICROPY_FLOAT_CONST(2.3375752413355295), MICROPY_FLOAT_CONST(2.3104136836950011), MICROPY_FLOAT_CONST(2.2842740596736557),
+    MICROPY_FLOAT_CONST(2.2590595738653283), MICROPY_FLOAT_CONST(2.2346863955870555), MICROPY_FLOAT_CONST(2.2110814088747262),
+    MICROPY_FLOAT_CONST(2.1881804320720186), MICROPY_FLOAT_CONST(2.165926793744839), MICROPY_FLOAT_CONST(2.1442701823562595),
+    MICROPY_FLOAT_CONST(2.1231657086697879), MICROPY_FLOAT_CONST(2.1025731351849966), MICROPY_FLOAT_CONST(2.0824562379877225),
+    MICROPY_FLOAT_CONST(2.0627822745039612), MICROPY_FLOAT_CONST(2.0435215366506672), MICROPY_FLOAT_CONST(2.0246469733729318),
+    MICROPY_FLOAT_CONST(2.0061338699589646), MICROPY_FLOAT_CONST(1.9879595741230585), MICROPY_FLOAT_CONST(1.9701032608497109),
+    MICROPY_FLOAT_CONST(1.9525457295488866), MICROPY_FLOAT_CONST(1.935269228291898), MICROPY_FLOAT_CONST(1.9182573008597299),
+    MICROPY_FLOAT_CONST(1.9014946531003156), MICROPY_FLOAT_CONST(1.8849670357028674), MICROPY_FLOAT_CONST(1.8686611409895402),
+    MICROPY_FLOAT_CONST(1.8525645117230851), MICROPY_FLOAT_CONST(1.8366654602533821), MICROPY_FLOAT_CONST(1.8209529965910032),
+    MICROPY_FLOAT_CONST(1.8054167642140468), MICROPY_FLOAT_CONST(1.790046982594617), MICROPY_FLOAT_CONST(1.7748343955807673),
+    MICROPY_FLOAT_CONST(1.75977022489423), MICROPY_FLOAT_CONST(1.7448461281083745), MICROPY_FLOAT_CONST(1.7300541605582416),
+    MICROPY_FLOAT_CONST(1.7153867407081145), MICROPY_FLOAT_CONST(1.7008366185642989), MICROPY_FLOAT_CONST(1.6863968467734842),
+    MICROPY_FLOAT_CONST(1.6720607540918502), MICROPY_FLOAT_CONST(1.6578219209482052), MICROPY_FLOAT_CONST(1.6436741568569802),
+    MICROPY_FLOAT_CONST(1.6296114794646759), MICROPY_FLOAT_CONST(1.6156280950371305), MICROPY_FLOAT_CONST(1.6017183802152746),
+    MICROPY_FLOAT_CONST(1.5878768648843984), MICROPY_FLOAT_CONST(1.5740982160167472), MICROPY_FLOAT_CONST(1.560377222359838),
+    MICROPY_FLOAT_CONST(1.5467087798535009), MICROPY_FLOAT_CONST(1.5330878776675534), MICROPY_FLOAT_CONST(1.5195095847593678),
+    MICROPY_FLOAT_CONST(1.5059690368565473), MICROPY_FLOAT_CONST(1.4924614237746121), MICROPY_FLOAT_CONST(1.4789819769830943),
+    MICROPY_FLOAT_CONST(1.4655259573357911), MICROPY_FLOAT_CONST(1.4520886428822128), MICROPY_FLOAT_CONST(1.4386653166774577),
+    MICROPY_FLOAT_CONST(1.4252512545068579), MICROPY_FLOAT_CONST(1.4118417124397566), MICROPY_FLOAT_CONST(1.3984319141236026),
+    MICROPY_FLOAT_CONST(1.3850170377251447), MICROPY_FLOAT_CONST(1.3715922024197282), MICROPY_FLOAT_CONST(1.3581524543224188),
+    MICROPY_FLOAT_CONST(1.344692751745709), MICROPY_FLOAT_CONST(1.3312079496576725), MICROPY_FLOAT_CONST(1.317692783201339),
+    MICROPY_FLOAT_CONST(1.3041418501204174), MICROPY_FLOAT_CONST(1.2905495919178691), MICROPY_FLOAT_CONST(1.2769102735516955),
+    MICROPY_FLOAT_CONST(1.2632179614460239), MICROPY_FLOAT_CONST(1.2494664995643296), MICROPY_FLOAT_CONST(1.2356494832544769),
+    MICROPY_FLOAT_CONST(1.2217602305309583), MICROPY_FLOAT_CONST(1.2077917504067532), MICROPY_FLOAT_CONST(1.1937367078237677),
+    MICROPY_FLOAT_CONST(1.1795873846544562), MICROPY_FLOAT_CONST(1.1653356361550424), MICROPY_FLOAT_CONST(1.1509728421389716),
+    MICROPY_FLOAT_CONST(1.1364898520030711), MICROPY_FLOAT_CONST(1.1218769225722494), MICROPY_FLOAT_CONST(1.1071236475235307),
+    MICROPY_FLOAT_CONST(1.0922188768965488), MICROPY_FLOAT_CONST(1.0771506248819325), MICROPY_FLOAT_CONST(1.0619059636836141),
+    MICROPY_FLOAT_CONST(1.046470900752575), MICROPY_FLOAT_CONST(1.0308302360564503), MICROPY_FLOAT_CONST(1.0149673952392939),
+    MICROPY_FLOAT_CONST(0.99886423348063791), MICROPY_FLOAT_CONST(0.98250080350275459), MICROPY_FLOAT_CONST(0.96585507938812465),
+    MICROPY_FLOAT_CONST(0.94890262549790583), MICROPY_FLOAT_CONST(0.93161619660134753), MICROPY_FLOAT_CONST(0.91396525100879533),
+    MICROPY_FLOAT_CONST(0.895915352566232), MICROPY_FLOAT_CONST(0.87742742909770899), MICROPY_FLOAT_CONST(0.85845684317804383),
+    MICROPY_FLOAT_CONST(0.83895221428120015), MICROPY_FLOAT_CONST(0.81885390668331015), MICROPY_FLOAT_CONST(0.79809206062626692),
+    MICROPY_FLOAT_CONST(0.77658398787614014), MICROPY_FLOAT_CONST(0.75423066443450149), MICROPY_FLOAT_CONST(0.73091191062187222),
+    MICROPY_FLOAT_CONST(0.70647961131359849), MICROPY_FLOAT_CONST(0.68074791864589412), MICROPY_FLOAT_CONST(0.65347863871503165),
+    MICROPY_FLOAT_CONST(0.6243585973090765), MICROPY_FLOAT_CONST(0.59296294244196524), MICROPY_FLOAT_CONST(0.558692178375504),
+    MICROPY_FLOAT_CONST(0.52065603872512911), MICROPY_FLOAT_CONST(0.47743783725376965), MICROPY_FLOAT_CONST(0.42654798630328317),
+    MICROPY_FLOAT_CONST(0.36287143102838931), MICROPY_FLOAT_CONST(0.27232086470461792), MICROPY_FLOAT_CONST(0.0)
+};
 
-    // numpy's random supports only dense output arrays, so we can simply
-    // loop through the elements in a linear fashion
-    for(size_t i = 0; i < ndarray->len; i = i + 2) {
+static const mp_float_t random_ziggurat_f[129] = {
+    MICROPY_FLOAT_CONST(0.0010143525641286163), MICROPY_FLOAT_CONST(0.0026696290839025093), MICROPY_FLOAT_CONST(0.005548995220816485),
+    MICROPY_FLOAT_CONST(0.0086244844129304953), MICROPY_FLOAT_CONST(0.011839478657982351), MICROPY_FLOAT_CONST(0.015167298010672094),
+    MICROPY_FLOAT_CONST(0.018592102737165876), MICROPY_FLOAT_CONST(0.022103304616111662), MICROPY_FLOAT_CONST(0.025693291936149706),
+    MICROPY_FLOAT_CONST(0.029356317440253937), MICROPY_FLOAT_CONST(0.033087886146505277), MICROPY_FLOAT_CONST(0.036884388786968897),
+    MICROPY_FLOAT_CONST(0.040742868074790738), MICROPY_FLOAT_CONST(0.044660862200872564), MICROPY_FLOAT_CONST(0.048636295860284208),
+    MICROPY_FLOAT_CONST(0.05266740190350333), MICROPY_FLOAT_CONST(0.056752663481538741), MICROPY_FLOAT_CONST(0.060890770348566541),
+    MICROPY_FLOAT_CONST(0.065080585213632053), MICROPY_FLOAT_CONST(0.069321117394180426), MICROPY_FLOAT_CONST(0.073611501884755084),
+    MICROPY_FLOAT_CONST(0.077950982514654946), MICROPY_FLOAT_CONST(0.082338898242957689), MICROPY_FLOAT_CONST(0.086774671895543304),
+    MICROPY_FLOAT_CONST(0.091257800827635113), MICROPY_FLOAT_CONST(0.095787849122578511), MICROPY_FLOAT_CONST(0.10036444102954595),
+    MICROPY_FLOAT_CONST(0.10498725541035502), MICROPY_FLOAT_CONST(0.10965602101581831), MICROPY_FLOAT_CONST(0.11437051244988877),
+    MICROPY_FLOAT_CONST(0.11913054670871913), MICROPY_FLOAT_CONST(0.12393598020398236), MICROPY_FLOAT_CONST(0.1287867061971045),
+    MICROPY_FLOAT_CONST(0.13368265258464826), MICROPY_FLOAT_CONST(0.13862377998585165), MICROPY_FLOAT_CONST(0.14361008009193366),
+    MICROPY_FLOAT_CONST(0.14864157424369764), MICROPY_FLOAT_CONST(0.15371831220958723), MICROPY_FLOAT_CONST(0.15884037114093572),
+    MICROPY_FLOAT_CONST(0.16400785468492834), MICROPY_FLOAT_CONST(0.16922089223892534), MICROPY_FLOAT_CONST(0.17447963833240293),
+    MICROPY_FLOAT_CONST(0.17978427212496276), MICROPY_FLOAT_CONST(0.18513499701071409), MICROPY_FLOAT_CONST(0.19053204032091436),
+    MICROPY_FLOAT_CONST(0.1959756531181111), MICROPY_FLOAT_CONST(0.20146611007620394), MICROPY_FLOAT_CONST(0.20700370944187452),
+    MICROPY_FLOAT_CONST(0.2125887730737368), MICROPY_FLOAT_CONST(0.21822164655637138), MICROPY_FLOAT_CONST(0.22390269938713464),
+    MICROPY_FLOAT_CONST(0.22963232523430352), MICROPY_FLOAT_CONST(0.23541094226572851), MICROPY_FLOAT_CONST(0.24123899354775216),
+    MICROPY_FLOAT_CONST(0.24711694751469759), MICROPY_FLOAT_CONST(0.25304529850976687), MICROPY_FLOAT_CONST(0.25902456739871177),
+    MICROPY_FLOAT_CONST(0.26505530225816298), MICROPY_FLOAT_CONST(0.27113807914102633), MICROPY_FLOAT_CONST(0.27727350292189878),
+    MICROPY_FLOAT_CONST(0.28346220822601359), MICROPY_FLOAT_CONST(0.28970486044581167), MICROPY_FLOAT_CONST(0.29600215684985709),
+    MICROPY_FLOAT_CONST(0.30235482778948097), MICROPY_FLOAT_CONST(0.30876363800925322), MICROPY_FLOAT_CONST(0.31522938806815898),
+    MICROPY_FLOAT_CONST(0.32175291587921012), MICROPY_FLOAT_CONST(0.32833509837615404), MICROPY_FLOAT_CONST(0.33497685331697291),
+    MICROPY_FLOAT_CONST(0.34167914123501547), MICROPY_FLOAT_CONST(0.34844296754987431), MICROPY_FLOAT_CONST(0.35526938485154902),
+    MICROPY_FLOAT_CONST(0.3621594953730351), MICROPY_FLOAT_CONST(0.36911445366827705), MICROPY_FLOAT_CONST(0.37613546951445642),
+    MICROPY_FLOAT_CONST(0.38322381105988573), MICROPY_FLOAT_CONST(0.39038080824139165), MICROPY_FLOAT_CONST(0.3976078564980447),
+    MICROPY_FLOAT_CONST(0.40490642081149053), MICROPY_FLOAT_CONST(0.41227804010702679), MICROPY_FLOAT_CONST(0.41972433205404047),
+    MICROPY_FLOAT_CONST(0.4272469983095647), MICROPY_FLOAT_CONST(0.43484783025466417), MICROPY_FLOAT_CONST(0.44252871528024901),
+    MICROPY_FLOAT_CONST(0.45029164368692937), MICROPY_FLOAT_CONST(0.45813871627287434), MICROPY_FLOAT_CONST(0.46607215269457342),
+    MICROPY_FLOAT_CONST(0.47409430069825209), MICROPY_FLOAT_CONST(0.48220764633484126), MICROPY_FLOAT_CONST(0.49041482528932423),
+    MICROPY_FLOAT_CONST(0.49871863547658696), MICROPY_FLOAT_CONST(0.50712205108130726), MICROPY_FLOAT_CONST(0.51562823824987469),
+    MICROPY_FLOAT_CONST(0.52424057267899549), MICROPY_FLOAT_CONST(0.53296265938999043), MICROPY_FLOAT_CONST(0.54179835503172702),
+    MICROPY_FLOAT_CONST(0.55075179312105826), MICROPY_FLOAT_CONST(0.55982741271069802), MICROPY_FLOAT_CONST(0.56902999107472474),
+    MICROPY_FLOAT_CONST(0.57836468112670547), MICROPY_FLOAT_CONST(0.58783705444182377), MICROPY_FLOAT_CONST(0.59745315095181561),
+    MICROPY_FLOAT_CONST(0.6072195366326083), MICROPY_FLOAT_CONST(0.61714337082656601), MICROPY_FLOAT_CONST(0.62723248525781816),
+    MICROPY_FLOAT_CONST(0.6374954773431486), MICROPY_FLOAT_CONST(0.64794182111855458), MICROPY_FLOAT_CONST(0.65858200005865752),
+    MICROPY_FLOAT_CONST(0.66942766735771009), MICROPY_FLOAT_CONST(0.68049184100641835), MICROPY_FLOAT_CONST(0.69178914344604003),
+    MICROPY_FLOAT_CONST(0.70333609902582173), MICROPY_FLOAT_CONST(0.7151515074204815), MICROPY_FLOAT_CONST(0.72725691835451045),
+    MICROPY_FLOAT_CONST(0.73967724368334287), MICROPY_FLOAT_CONST(0.75244155918570865), MICROPY_FLOAT_CONST(0.76558417390924105),
+    MICROPY_FLOAT_CONST(0.77914608594170842), MICROPY_FLOAT_CONST(0.79317701178386468), MICROPY_FLOAT_CONST(0.80773829469612679),
+    MICROPY_FLOAT_CONST(0.82290721139526801), MICROPY_FLOAT_CONST(0.83878360531065355), MICROPY_FLOAT_CONST(0.85550060788507098),
+    MICROPY_FLOAT_CONST(0.87324304892686078), MICROPY_FLOAT_CONST(0.89228165080231048), MICROPY_FLOAT_CONST(0.91304364799204663),
+    MICROPY_FLOAT_CONST(0.93628268170838091), MICROPY_FLOAT_CONST(0.96359969315577965), MICROPY_FLOAT_CONST(1.0)
+};
+
+static mp_float_t random_standard_normal_value(random_generator_obj_t *generator) {
+    for(;;) {
         #if MICROPY_FLOAT_IMPL == MICROPY_FLOAT_IMPL_FLOAT
-        uint32_t x = pcg32_next(&self->state);
-        u = (float)(int32_t)(x >> 8) * 0x1.0p-24f;
-        x = pcg32_next(&self->state);
-        v = (float)(int32_t)(x >> 8) * 0x1.0p-24f;
+        uint32_t x = pcg32_next(generator);
+        // the upper 24 bits give a signed number in [-1, 1)
+        mp_float_t u = (float)((int32_t)x >> 8) * 0x1.0p-23f;
         #else
-        uint64_t x = pcg32_next64(&self->state);
-        u = (double)(int64_t)(x >> 11) * 0x1.0p-53;
-        x = pcg32_next64(&self->state);
-        v = (double)(int64_t)(x >> 11) * 0x1.0p-53;
+        uint64_t x = pcg32_next64(generator);
+        mp_float_t u = (double)((int64_t)x >> 11) * 0x1.0p-52;
         #endif
-        mp_float_t sqrt_log = MICROPY_FLOAT_C_FUN(sqrt)(-MICROPY_FLOAT_CONST(2.0) * MICROPY_FLOAT_C_FUN(log)(u));
-        value = sqrt_log * MICROPY_FLOAT_C_FUN(cos)(MICROPY_FLOAT_CONST(2.0) * MP_PI * v);
-        *array++ = loc + scale * value;
-        if((i & 1) == 0) {
-            value = sqrt_log * MICROPY_FLOAT_C_FUN(sin)(MICROPY_FLOAT_CONST(2.0) * MP_PI * v);
-            *array++ = loc + scale * value;
+        // the lowest 7 bits select the layer
+        uint8_t i = x & 0x7F;
+        mp_float_t value = u * random_ziggurat_x[i];
+        if(MICROPY_FLOAT_C_FUN(fabs)(value) < random_ziggurat_x[i + 1]) {
+            // this is the fast path, taken in about 99% of the cases
+            return value;
+        }
+        if(i == 0) {
+            // sample from the tail beyond R
+            mp_float_t t, y;
+            do {
+                t = -MICROPY_FLOAT_C_FUN(log)(MICROPY_FLOAT_CONST(1.0) - random_next_float(generator)) / RANDOM_ZIGGURAT_R;
+                y = -MICROPY_FLOAT_C_FUN(log)(MICROPY_FLOAT_CONST(1.0) - random_next_float(generator));
+            } while(y + y < t * t);
+            return u < MICROPY_FLOAT_CONST(0.0) ? -(RANDOM_ZIGGURAT_R + t) : RANDOM_ZIGGURAT_R + t;
+        }
+        mp_float_t f0 = random_ziggurat_f[i];
+        if(f0 + random_next_float(generator) * (random_ziggurat_f[i + 1] - f0) < MICROPY_FLOAT_C_FUN(exp)(-MICROPY_FLOAT_CONST(0.5) * value * value)) {
+            return value;
         }
     }
-    return MP_OBJ_FROM_PTR(ndarray);
 }
+#endif /* ULAB_NUMPY_RANDOM_HAS_NORMAL | ULAB_NUMPY_RANDOM_HAS_STANDARD_NORMAL */
 
-MP_DEFINE_CONST_FUN_OBJ_KW(random_normal_obj, 1, random_normal);
-#endif /* ULAB_NUMPY_RANDOM_HAS_NORMAL */
-
-#if ULAB_NUMPY_RANDOM_HAS_RANDOM
-static mp_obj_t random_random(size_t n_args, const mp_obj_t *pos_args, mp_map_t *kw_args) {
-    static const mp_arg_t allowed_args[] = {
-        { MP_QSTR_, MP_ARG_OBJ, { .u_rom_obj = MP_ROM_NONE } },
-        { MP_QSTR_size, MP_ARG_OBJ, { .u_rom_obj = MP_ROM_NONE } },
-        { MP_QSTR_out, MP_ARG_KW_ONLY | MP_ARG_OBJ, { .u_rom_obj = MP_ROM_NONE } },
-    };
-
-    mp_arg_val_t args[MP_ARRAY_SIZE(allowed_args)];
-    mp_arg_parse_all(n_args, pos_args, kw_args, MP_ARRAY_SIZE(allowed_args), allowed_args, args);
-
-    random_generator_obj_t *self = MP_OBJ_TO_PTR(args[0].u_obj);
-
-    mp_obj_t size = args[1].u_obj;
-    mp_obj_t out = args[2].u_obj;
-
-    ndarray_obj_t *ndarray = NULL;
+static ndarray_obj_t *random_output_array(mp_obj_t size, mp_obj_t out, uint8_t dtype) {
+    // returns a dense array of the given dtype, whose shape is determined by size, or
+    // returns out, after checking that it is compatible with size, and dtype;
+    // if both size, and out are None, a single value is requested, and NULL is returned
     size_t *shape = m_new0(size_t, ULAB_MAX_DIMS);
+    uint8_t ndim = 0;
 
     if(size != mp_const_none) {
         if(mp_obj_is_int(size)) {
+            ndim = 1;
             shape[ULAB_MAX_DIMS - 1] = (size_t)mp_obj_get_int(size);
         } else if(mp_obj_is_type(size, &mp_type_tuple)) {
             mp_obj_tuple_t *_shape = MP_OBJ_TO_PTR(size);
-            ndarray = ndarray_new_ndarray_from_tuple(_shape, NDARRAY_FLOAT);
+            if(_shape->len > ULAB_MAX_DIMS) {
+                mp_raise_ValueError(MP_ERROR_TEXT("maximum number of dimensions is " MP_STRINGIFY(ULAB_MAX_DIMS)));
+            }
+            ndim = _shape->len;
+            for(uint8_t i = 0; i < ndim; i++) {
+                shape[ULAB_MAX_DIMS - ndim + i] = (size_t)mp_obj_get_int(_shape->items[i]);
+            }
         } else { // input type not supported
             mp_raise_TypeError(MP_ERROR_TEXT("shape must be None, an integer or a tuple of integers"));
         }
     }
 
+    ndarray_obj_t *ndarray = NULL;
     if(out != mp_const_none) {
         if(!mp_obj_is_type(out, &ulab_ndarray_type)) {
             mp_raise_TypeError(MP_ERROR_TEXT("out has wrong type"));
@@ -238,7 +395,7 @@ static mp_obj_t random_random(size_t n_args, const mp_obj_t *pos_args, mp_map_t
 
         ndarray = MP_OBJ_TO_PTR(out);
 
-        if(ndarray->dtype != NDARRAY_FLOAT) {
+        if(ndarray->dtype != dtype) {
             mp_raise_TypeError(MP_ERROR_TEXT("output array has wrong type"));
         }
         if(size != mp_const_none) {
@@ -251,22 +408,329 @@ static mp_obj_t random_random(size_t n_args, const mp_obj_t *pos_args, mp_map_t
         if(!ndarray_is_dense(ndarray)) {
             mp_raise_ValueError(MP_ERROR_TEXT("output array must be contiguous"));
         }
-    } else { // out == None
-        if(size != mp_const_none) {
-            mp_obj_tuple_t *_shape = MP_OBJ_TO_PTR(size);
-            ndarray = ndarray_new_ndarray_from_tuple(_shape, NDARRAY_FLOAT);
+    } else if(size != mp_const_none) {
+        // all elements will be overwritten, hence, there is no need to zero the array
+        ndarray = ndarray_new_dense_ndarray_uninitialised(ndim, shape, dtype);
+    }
+    m_del(size_t, shape, ULAB_MAX_DIMS);
+    return ndarray;
+}
+
+#if ULAB_NUMPY_RANDOM_HAS_CHOICE | ULAB_NUMPY_RANDOM_HAS_PERMUTATION
+static uint8_t random_index_dtype(size_t n) {
+    // returns the narrowest signed (if possible) dtype that can hold all integers in [0, n)
+    if(n <= 32768) {
+        return NDARRAY_INT16;
+    } else if(n <= 65536) {
+        return NDARRAY_UINT16;
+    }
+    #if ULAB_HAS_INT32
+    return NDARRAY_INT32;
+    #else
+    mp_raise_ValueError(MP_ERROR_TEXT("population is too large"));
+    return NDARRAY_INT16;
+    #endif
+}
+
+static void random_set_index(uint8_t dtype, void *array, size_t i, uint32_t value) {
+    if(dtype == NDARRAY_INT16) {
+        ((int16_t *)array)[i] = (int16_t)value;
+    } else if(dtype == NDARRAY_UINT16) {
+        ((uint16_t *)array)[i] = (uint16_t)value;
+    #if ULAB_HAS_INT32
+    } else {
+        ((int32_t *)array)[i] = (int32_t)value;
+    #endif
+    }
+}
+
+static ndarray_obj_t *random_population(mp_obj_t population, size_t *n) {
+    // returns a dense copy of population, if it is an ndarray, or a linear array with
+    // the elements 0, 1, ..., population - 1, if it is an integer; the number of
+    // items along the first axis is returned in n
+    ndarray_obj_t *ndarray;
+    if(mp_obj_is_int(population)) {
+        mp_int_t len = mp_obj_get_int(population);
+        if(len < 0) {
+            mp_raise_ValueError(MP_ERROR_TEXT("a must be non-negative"));
+        }
+        uint8_t dtype = random_index_dtype((size_t)len);
+        ndarray = ndarray_new_linear_array((size_t)len, dtype);
+        for(size_t i = 0; i < (size_t)len; i++) {
+            random_set_index(dtype, ndarray->array, i, (uint32_t)i);
+        }
+        *n = (size_t)len;
+    } else if(mp_obj_is_type(population, &ulab_ndarray_type)) {
+        ndarray = ndarray_copy_view(MP_OBJ_TO_PTR(population));
+        *n = ndarray->ndim == 0 ? 0 : ndarray->shape[ULAB_MAX_DIMS - ndarray->ndim];
+    } else {
+        mp_raise_TypeError(MP_ERROR_TEXT("a must be an integer, or an ndarray"));
+    }
+    return ndarray;
+}
+
+static void random_shuffle(random_generator_obj_t *generator, uint8_t *array, size_t n, size_t k, size_t nbytes) {
+    // Fisher-Yates shuffle of n items, each nbytes long; only the first k positions
+    // are drawn, so that these form a uniformly distributed sample without replacement
+    uint8_t *tmp = m_new(uint8_t, nbytes);
+    for(size_t i = 0; (i < k) && (i + 1 < n); i++) {
+        size_t j = i + random_bounded(generator, (uint32_t)(n - i));
+        if(j != i) {
+            memcpy(tmp, array + i * nbytes, nbytes);
+            memcpy(array + i * nbytes, array + j * nbytes, nbytes);
+            memcpy(array + j * nbytes, tmp, nbytes);
+        }
+    }
+    m_del(uint8_t, tmp, nbytes);
+}
+#endif /* ULAB_NUMPY_RANDOM_HAS_CHOICE | ULAB_NUMPY_RANDOM_HAS_PERMUTATION */
+
+#if ULAB_NUMPY_RANDOM_HAS_CHOICE
+static mp_obj_t random_choice(size_t n_args, const mp_obj_t *pos_args, mp_map_t *kw_args) {
+    static const mp_arg_t allowed_args[] = {
+        { MP_QSTR_, MP_ARG_OBJ, { .u_rom_obj = MP_ROM_NONE } },
+        { MP_QSTR_a, MP_ARG_REQUIRED | MP_ARG_OBJ, { .u_rom_obj = MP_ROM_NONE } },
+        { MP_QSTR_size, MP_ARG_OBJ, { .u_rom_obj = MP_ROM_NONE } },
+        { MP_QSTR_replace, MP_ARG_BOOL, { .u_bool = true } },
+    };
+
+    mp_arg_val_t args[MP_ARRAY_SIZE(allowed_args)];
+    mp_arg_parse_all(n_args, pos_args, kw_args, MP_ARRAY_SIZE(allowed_args), allowed_args, args);
+
+    random_generator_obj_t *self = MP_OBJ_TO_PTR(args[0].u_obj);
+    mp_obj_t population = args[1].u_obj;
+    mp_obj_t size = args[2].u_obj;
+    bool replace = args[3].u_bool;
+
+    size_t n;
+    uint8_t dtype;
+    ndarray_obj_t *source = NULL;
+
+    if(mp_obj_is_int(population)) {
+        mp_int_t len = mp_obj_get_int(population);
+        if(len < 0) {
+            mp_raise_ValueError(MP_ERROR_TEXT("a must be non-negative"));
+        }
+        n = (size_t)len;
+        // a single value is returned as an integer, so its dtype is irrelevant
+        dtype = size == mp_const_none ? NDARRAY_INT16 : random_index_dtype(n);
+    } else if(mp_obj_is_type(population, &ulab_ndarray_type)) {
+        source = MP_OBJ_TO_PTR(population);
+        if(source->ndim != 1) {
+            mp_raise_ValueError(MP_ERROR_TEXT("a must be one-dimensional"));
+        }
+        n = source->len;
+        dtype = source->dtype;
+    } else {
+        mp_raise_TypeError(MP_ERROR_TEXT("a must be an integer, or an ndarray"));
+    }
+
+    if(n == 0) {
+        mp_raise_ValueError(MP_ERROR_TEXT("a cannot be empty"));
+    }
+
+    ndarray_obj_t *results = random_output_array(size, mp_const_none, dtype);
+    size_t k = results == NULL ? 1 : results->len;
+
+    if(!replace && (k > n)) {
+        mp_raise_ValueError(MP_ERROR_TEXT("cannot take a larger sample than population when replace is False"));
+    }
+
+    if(results == NULL) {
+        uint32_t index = random_bounded(self, (uint32_t)n);
+        if(source == NULL) {
+            return mp_obj_new_int(index);
+        }
+        return ndarray_get_item(source, (uint8_t *)source->array + index * source->strides[ULAB_MAX_DIMS - 1]);
+    }
+
+    if(source != NULL) {
+        results->boolean = source->boolean;
+    }
+
+    if(replace) {
+        uint8_t *rarray = (uint8_t *)results->array;
+        for(size_t i = 0; i < k; i++) {
+            uint32_t index = random_bounded(self, (uint32_t)n);
+            if(source == NULL) {
+                random_set_index(dtype, rarray, i, index);
+            } else {
+                memcpy(rarray + i * results->itemsize, (uint8_t *)source->array + index * source->strides[ULAB_MAX_DIMS - 1], results->itemsize);
+            }
+        }
+    } else {
+        ndarray_obj_t *pool = random_population(population, &n);
+        random_shuffle(self, (uint8_t *)pool->array, n, k, pool->itemsize);
+        memcpy(results->array, pool->array, k * pool->itemsize);
+    }
+    return MP_OBJ_FROM_PTR(results);
+}
+
+MP_DEFINE_CONST_FUN_OBJ_KW(random_choice_obj, 2, random_choice);
+#endif /* ULAB_NUMPY_RANDOM_HAS_CHOICE */
+
+#if ULAB_NUMPY_RANDOM_HAS_EXPONENTIAL
+static mp_obj_t random_exponential(size_t n_args, const mp_obj_t *pos_args, mp_map_t *kw_args) {
+    static const mp_arg_t allowed_args[] = {
+        { MP_QSTR_, MP_ARG_OBJ, { .u_rom_obj = MP_ROM_NONE } },
+        { MP_QSTR_scale, MP_ARG_OBJ, { .u_rom_obj = ULAB_REFERENCE_FLOAT_CONST(random_one) } },
+        { MP_QSTR_size, MP_ARG_OBJ, { .u_rom_obj = MP_ROM_NONE } },
+    };
+
+    mp_arg_val_t args[MP_ARRAY_SIZE(allowed_args)];
+    mp_arg_parse_all(n_args, pos_args, kw_args, MP_ARRAY_SIZE(allowed_args), allowed_args, args);
+
+    random_generator_obj_t *self = MP_OBJ_TO_PTR(args[0].u_obj);
+    mp_float_t scale = mp_obj_get_float(args[1].u_obj);
+
+    // the distribution is sampled by inversion; 1 - u is in (0, 1], so the logarithm is finite
+    ndarray_obj_t *ndarray = random_output_array(args[2].u_obj, mp_const_none, NDARRAY_FLOAT);
+    if(ndarray == NULL) {
+        return mp_obj_new_float(-scale * MICROPY_FLOAT_C_FUN(log)(MICROPY_FLOAT_CONST(1.0) - random_next_float(self)));
+    }
+
+    mp_float_t *array = (mp_float_t *)ndarray->array;
+    for(size_t i = 0; i < ndarray->len; i++) {
+        *array++ = -scale * MICROPY_FLOAT_C_FUN(log)(MICROPY_FLOAT_CONST(1.0) - random_next_float(self));
+    }
+    return MP_OBJ_FROM_PTR(ndarray);
+}
+
+MP_DEFINE_CONST_FUN_OBJ_KW(random_exponential_obj, 1, random_exponential);
+#endif /* ULAB_NUMPY_RANDOM_HAS_EXPONENTIAL */
+
+#if ULAB_NUMPY_RANDOM_HAS_INTEGERS
+static int64_t random_integers_bound(mp_obj_t obj) {
+    // all valid bounds fit into 64 bits, so that anything larger can be rejected without converting it
+    if(mp_obj_is_type(obj, &mp_type_int) && (MICROPY_FLOAT_C_FUN(fabs)(mp_obj_get_float(obj)) > MICROPY_FLOAT_CONST(1e18))) {
+        mp_raise_ValueError(MP_ERROR_TEXT("bounds are out of the range of dtype"));
+    }
+    return (int64_t)random_int_bits(obj);
+}
+
+static mp_obj_t random_integers(size_t n_args, const mp_obj_t *pos_args, mp_map_t *kw_args) {
+    static const mp_arg_t allowed_args[] = {
+        { MP_QSTR_, MP_ARG_OBJ, { .u_rom_obj = MP_ROM_NONE } },
+        { MP_QSTR_low, MP_ARG_REQUIRED | MP_ARG_OBJ, { .u_rom_obj = MP_ROM_NONE } },
+        { MP_QSTR_high, MP_ARG_OBJ, { .u_rom_obj = MP_ROM_NONE } },
+        { MP_QSTR_size, MP_ARG_OBJ, { .u_rom_obj = MP_ROM_NONE } },
+        { MP_QSTR_dtype, MP_ARG_INT, { .u_int = NDARRAY_INT16 } },
+        { MP_QSTR_endpoint, MP_ARG_BOOL, { .u_bool = false } },
+    };
+
+    mp_arg_val_t args[MP_ARRAY_SIZE(allowed_args)];
+    mp_arg_parse_all(n_args, pos_args, kw_args, MP_ARRAY_SIZE(allowed_args), allowed_args, args);
+
+    random_generator_obj_t *self = MP_OBJ_TO_PTR(args[0].u_obj);
+    uint8_t dtype = (uint8_t)args[4].u_int;
+
+    int64_t low = random_integers_bound(args[1].u_obj);
+    int64_t high;
+    if(args[2].u_obj == mp_const_none) {
+        high = low;
+        low = 0;
+    } else {
+        high = random_integers_bound(args[2].u_obj);
+    }
+    if(args[5].u_bool) {
+        high++;
+    }
+    if(low >= high) {
+        mp_raise_ValueError(MP_ERROR_TEXT("low must be smaller than high"));
+    }
+
+    int64_t min, max;
+    if(dtype == NDARRAY_UINT8) {
+        min = 0;
+        max = UINT8_MAX;
+    } else if(dtype == NDARRAY_INT8) {
+        min = INT8_MIN;
+        max = INT8_MAX;
+    } else if(dtype == NDARRAY_UINT16) {
+        min = 0;
+        max = UINT16_MAX;
+    } else if(dtype == NDARRAY_INT16) {
+        min = INT16_MIN;
+        max = INT16_MAX;
+    #if ULAB_HAS_INT32
+    } else if(dtype == NDARRAY_UINT32) {
+        min = 0;
+        max = UINT32_MAX;
+    } else if(dtype == NDARRAY_INT32) {
+        min = INT32_MIN;
+        max = INT32_MAX;
+    #endif
+    } else {
+        mp_raise_TypeError(MP_ERROR_TEXT("dtype must be an integer type"));
+    }
+    if((low < min) || (high - 1 > max)) {
+        mp_raise_ValueError(MP_ERROR_TEXT("bounds are out of the range of dtype"));
+    }
+
+    // the range is at most 2^32, in which case all bits of the generator are used directly
+    uint64_t range = (uint64_t)(high - low);
+
+    ndarray_obj_t *ndarray = random_output_array(args[3].u_obj, mp_const_none, dtype);
+    if(ndarray == NULL) {
+        uint32_t value = range > UINT32_MAX ? pcg32_next(self) : random_bounded(self, (uint32_t)range);
+        return mp_obj_new_int_from_ll(low + value);
+    }
+
+    uint8_t *array = (uint8_t *)ndarray->array;
+    for(size_t i = 0; i < ndarray->len; i++) {
+        uint32_t value = range > UINT32_MAX ? pcg32_next(self) : random_bounded(self, (uint32_t)range);
+        // the conversion to an unsigned type and back is well-defined, and wraps correctly
+        if(dtype == NDARRAY_UINT8 || dtype == NDARRAY_INT8) {
+            *array = (uint8_t)(low + value);
+        } else if(dtype == NDARRAY_UINT16 || dtype == NDARRAY_INT16) {
+            ((uint16_t *)array)[0] = (uint16_t)(low + value);
+        #if ULAB_HAS_INT32
         } else {
-            // return single value
-            mp_float_t value;
-            #if MICROPY_FLOAT_IMPL == MICROPY_FLOAT_IMPL_FLOAT
-            uint32_t x = pcg32_next(&self->state);
-            value = (float)(int32_t)(x >> 8) * 0x1.0p-24f;
-            #else
-            uint64_t x = pcg32_next64(&self->state);
-            value = (double)(int64_t)(x >> 11) * 0x1.0p-53;
-            #endif
-            return mp_obj_new_float(value);
+            ((uint32_t *)array)[0] = (uint32_t)(low + value);
+        #endif
         }
+        array += ndarray->itemsize;
+    }
+    return MP_OBJ_FROM_PTR(ndarray);
+}
+
+MP_DEFINE_CONST_FUN_OBJ_KW(random_integers_obj, 2, random_integers);
+#endif /* ULAB_NUMPY_RANDOM_HAS_INTEGERS */
+
+#if ULAB_NUMPY_RANDOM_HAS_JUMPED
+static mp_obj_t random_jumped(size_t n_args, const mp_obj_t *args) {
+    // returns a new generator, whose state is that of self advanced by
+    // jumps * RANDOM_JUMP_STRIDE steps; self is not changed
+    random_generator_obj_t *self = MP_OBJ_TO_PTR(args[0]);
+    uint64_t jumps = n_args == 2 ? random_int_bits(args[1]) : 1;
+    random_generator_obj_t *generator = random_new_generator(self->state, self->increment);
+    pcg32_advance(generator, jumps * RANDOM_JUMP_STRIDE);
+    return MP_OBJ_FROM_PTR(generator);
+}
+
+MP_DEFINE_CONST_FUN_OBJ_VAR_BETWEEN(random_jumped_obj, 1, 2, random_jumped);
+#endif /* ULAB_NUMPY_RANDOM_HAS_JUMPED */
+
+#if ULAB_NUMPY_RANDOM_HAS_NORMAL
+static mp_obj_t random_normal(size_t n_args, const mp_obj_t *pos_args, mp_map_t *kw_args) {
+    static const mp_arg_t allowed_args[] = {
+        { MP_QSTR_, MP_ARG_OBJ, { .u_rom_obj = MP_ROM_NONE } },
+        { MP_QSTR_loc, MP_ARG_OBJ, { .u_rom_obj = ULAB_REFERENCE_FLOAT_CONST(random_zero) } },
+        { MP_QSTR_scale, MP_ARG_OBJ, { .u_rom_obj = ULAB_REFERENCE_FLOAT_CONST(random_one) } },
+        { MP_QSTR_size, MP_ARG_OBJ, { .u_rom_obj = MP_ROM_NONE } },
+    };
+
+    mp_arg_val_t args[MP_ARRAY_SIZE(allowed_args)];
+    mp_arg_parse_all(n_args, pos_args, kw_args, MP_ARRAY_SIZE(allowed_args), allowed_args, args);
+
+    random_generator_obj_t *self = MP_OBJ_TO_PTR(args[0].u_obj);
+    mp_float_t loc = mp_obj_get_float(args[1].u_obj);
+    mp_float_t scale = mp_obj_get_float(args[2].u_obj);
+
+    ndarray_obj_t *ndarray = random_output_array(args[3].u_obj, mp_const_none, NDARRAY_FLOAT);
+    if(ndarray == NULL) {
+        // return single value
+        return mp_obj_new_float(loc + scale * random_standard_normal_value(self));
     }
 
     mp_float_t *array = (mp_float_t *)ndarray->array;
@@ -274,16 +738,56 @@ static mp_obj_t random_random(size_t n_args, const mp_obj_t *pos_args, mp_map_t
     // numpy's random supports only dense output arrays, so we can simply
     // loop through the elements in a linear fashion
     for(size_t i = 0; i < ndarray->len; i++) {
+        *array++ = loc + scale * random_standard_normal_value(self);
+    }
+    return MP_OBJ_FROM_PTR(ndarray);
+}
 
-        #if MICROPY_FLOAT_IMPL == MICROPY_FLOAT_IMPL_FLOAT
-        uint32_t x = pcg32_next(&self->state);
-        *array = (float)(int32_t)(x >> 8) * 0x1.0p-24f;
-        #else
-        uint64_t x = pcg32_next64(&self->state);
-        *array = (double)(int64_t)(x >> 11) * 0x1.0p-53;
-        #endif
+MP_DEFINE_CONST_FUN_OBJ_KW(random_normal_obj, 1, random_normal);
+#endif /* ULAB_NUMPY_RANDOM_HAS_NORMAL */
 
-        array++;
+#if ULAB_NUMPY_RANDOM_HAS_PERMUTATION
+static mp_obj_t random_permutation(mp_obj_t self_in, mp_obj_t x) {
+    random_generator_obj_t *self = MP_OBJ_TO_PTR(self_in);
+    size_t n;
+    // random_population always returns a dense array, so that the sub-arrays
+    // along the first axis can be swapped as contiguous blocks of memory
+    ndarray_obj_t *ndarray = random_population(x, &n);
+    if(n > 1) {
+        size_t nbytes = ndarray->len / n * ndarray->itemsize;
+        random_shuffle(self, (uint8_t *)ndarray->array, n, n, nbytes);
+    }
+    return MP_OBJ_FROM_PTR(ndarray);
+}
+
+MP_DEFINE_CONST_FUN_OBJ_2(random_permutation_obj, random_permutation);
+#endif /* ULAB_NUMPY_RANDOM_HAS_PERMUTATION */
+
+#if ULAB_NUMPY_RANDOM_HAS_RANDOM
+static mp_obj_t random_random(size_t n_args, const mp_obj_t *pos_args, mp_map_t *kw_args) {
+    static const mp_arg_t allowed_args[] = {
+        { MP_QSTR_, MP_ARG_OBJ, { .u_rom_obj = MP_ROM_NONE } },
+        { MP_QSTR_size, MP_ARG_OBJ, { .u_rom_obj = MP_ROM_NONE } },
+        { MP_QSTR_out, MP_ARG_KW_ONLY | MP_ARG_OBJ, { .u_rom_obj = MP_ROM_NONE } },
+    };
+
+    mp_arg_val_t args[MP_ARRAY_SIZE(allowed_args)];
+    mp_arg_parse_all(n_args, pos_args, kw_args, MP_ARRAY_SIZE(allowed_args), allowed_args, args);
+
+    random_generator_obj_t *self = MP_OBJ_TO_PTR(args[0].u_obj);
+
+    ndarray_obj_t *ndarray = random_output_array(args[1].u_obj, args[2].u_obj, NDARRAY_FLOAT);
+    if(ndarray == NULL) {
+        // return single value
+        return mp_obj_new_float(random_next_float(self));
+    }
+
+    mp_float_t *array = (mp_float_t *)ndarray->array;
+
+    // numpy's random supports only dense output arrays, so we can simply
+    // loop through the elements in a linear fashion
+    for(size_t i = 0; i < ndarray->len; i++) {
+        *array++ = random_next_float(self);
     }
     return MP_OBJ_FROM_PTR(ndarray);
 }
@@ -291,6 +795,66 @@ static mp_obj_t random_random(size_t n_args, const mp_obj_t *pos_args, mp_map_t
 MP_DEFINE_CONST_FUN_OBJ_KW(random_random_obj, 1, random_random);
 #endif /* ULAB_NUMPY_RANDOM_HAS_RANDOM */
 
+#if ULAB_NUMPY_RANDOM_HAS_SPAWN
+static mp_obj_t random_spawn(mp_obj_t self_in, mp_obj_t n_children) {
+    // derives n_children generators from the output of self; each child runs on its own
+    // stream, i.e., it has a different increment, hence, the children's sequences are
+    // distinct from each other, and from that of self, and they are reproducible,
+    // given the state of self
+    random_generator_obj_t *self = MP_OBJ_TO_PTR(self_in);
+    mp_int_t n = mp_obj_get_int(n_children);
+    if(n < 0) {
+        mp_raise_ValueError(MP_ERROR_TEXT("number of children must be non-negative"));
+    }
+    mp_obj_list_t *children = MP_OBJ_TO_PTR(mp_obj_new_list(n, NULL));
+    for(mp_int_t i = 0; i < n; i++) {
+        uint64_t state = pcg32_next(self);
+        state = (state << 32) | pcg32_next(self);
+        uint64_t sequence = pcg32_next(self);
+        sequence = (sequence << 32) | pcg32_next(self);
+        // this is the seeding procedure of the reference implementation of PCG
+        // (pcg32_srandom_r); the sequence is shifted, and made odd, so its most significant
+        // bit is lost, and the streams are selected by the remaining 63 bits
+        random_generator_obj_t *generator = random_new_generator(0, sequence << 1);
+        pcg32_next(generator);
+        generator->state += state;
+        pcg32_next(generator);
+        children->items[i] = MP_OBJ_FROM_PTR(generator);
+    }
+    return MP_OBJ_FROM_PTR(children);
+}
+
+MP_DEFINE_CONST_FUN_OBJ_2(random_spawn_obj, random_spawn);
+#endif /* ULAB_NUMPY_RANDOM_HAS_SPAWN */
+
+#if ULAB_NUMPY_RANDOM_HAS_STANDARD_NORMAL
+static mp_obj_t random_standard_normal(size_t n_args, const mp_obj_t *pos_args, mp_map_t *kw_args) {
+    static const mp_arg_t allowed_args[] = {
+        { MP_QSTR_, MP_ARG_OBJ, { .u_rom_obj = MP_ROM_NONE } },
+        { MP_QSTR_size, MP_ARG_OBJ, { .u_rom_obj = MP_ROM_NONE } },
+        { MP_QSTR_out, MP_ARG_KW_ONLY | MP_ARG_OBJ, { .u_rom_obj = MP_ROM_NONE } },
+    };
+
+    mp_arg_val_t args[MP_ARRAY_SIZE(allowed_args)];
+    mp_arg_parse_all(n_args, pos_args, kw_args, MP_ARRAY_SIZE(allowed_args), allowed_args, args);
+
+    random_generator_obj_t *self = MP_OBJ_TO_PTR(args[0].u_obj);
+
+    ndarray_obj_t *ndarray = random_output_array(args[1].u_obj, args[2].u_obj, NDARRAY_FLOAT);
+    if(ndarray == NULL) {
+        return mp_obj_new_float(random_standard_normal_value(self));
+    }
+
+    mp_float_t *array = (mp_float_t *)ndarray->array;
+    for(size_t i = 0; i < ndarray->len; i++) {
+        *array++ = random_standard_normal_value(self);
+    }
+    return MP_OBJ_FROM_PTR(ndarray);
+}
+
+MP_DEFINE_CONST_FUN_OBJ_KW(random_standard_normal_obj, 1, random_standard_normal);
+#endif /* ULAB_NUMPY_RANDOM_HAS_STANDARD_NORMAL */
+
 #if ULAB_NUMPY_RANDOM_HAS_UNIFORM
 static mp_obj_t random_uniform(size_t n_args, const mp_obj_t *pos_args, mp_map_t *kw_args) {
     static const mp_arg_t allowed_args[] = {
@@ -314,10 +878,10 @@ static mp_obj_t random_uniform(size_t n_args, const mp_obj_t *pos_args, mp_map_t
         // return single value
         mp_float_t value;
         #if MICROPY_FLOAT_IMPL == MICROPY_FLOAT_IMPL_FLOAT
-        uint32_t x = pcg32_next(&self->state);
+        uint32_t x = pcg32_next(self);
         value = (float)(int32_t)(x >> 8) * 0x1.0p-24f;
         #else
-        uint64_t x = pcg32_next64(&self->state);
+        uint64_t x = pcg32_next64(self);
         value = (double)(int64_t)(x >> 11) * 0x1.0p-53;
         #endif
         return mp_obj_new_float(value);
@@ -332,10 +896,10 @@ static mp_obj_t random_uniform(size_t n_args, const mp_obj_t *pos_args, mp_map_t
     mp_float_t diff = high - low;
     for(size_t i = 0; i < ndarray->len; i++) {
         #if MICROPY_FLOAT_IMPL == MICROPY_FLOAT_IMPL_FLOAT
-        uint32_t x = pcg32_next(&self->state);
+        uint32_t x = pcg32_next(self);
         *array = (float)(int32_t)(x >> 8) * 0x1.0p-24f;
         #else
-        uint64_t x = pcg32_next64(&self->state);
+        uint64_t x = pcg32_next64(self);
         *array = (double)(int64_t)(x >> 11) * 0x1.0p-53;
         #endif
         *array = low + diff * *array;
@@ -16,6 +16,9 @@
 
 #define PCG_MULTIPLIER_64       6364136223846793005ULL
 #define PCG_INCREMENT_64        1442695040888963407ULL
+// the stride of Generator.jumped is 2^64 divided by the golden ratio, rounded to an odd
+// number, so that the states reached by successive jumps are spread evenly over the period
+#define RANDOM_JUMP_STRIDE      0x9E3779B97F4A7C15ULL
 
 extern const mp_obj_module_t ulab_numpy_random_module;
 
@@ -24,14 +27,23 @@ extern const mp_obj_type_t random_generator_type;
 typedef struct _random_generator_obj_t {
     mp_obj_base_t base;
     uint64_t state;
+    uint64_t increment;
 } random_generator_obj_t;
 
 mp_obj_t random_generator_make_new(const mp_obj_type_t *, size_t , size_t , const mp_obj_t *);
 void random_generator_print(const mp_print_t *, mp_obj_t , mp_print_kind_t );
 
 
+MP_DECLARE_CONST_FUN_OBJ_2(random_advance_obj);
+MP_DECLARE_CONST_FUN_OBJ_KW(random_choice_obj);
+MP_DECLARE_CONST_FUN_OBJ_KW(random_exponential_obj);
+MP_DECLARE_CONST_FUN_OBJ_KW(random_integers_obj);
+MP_DECLARE_CONST_FUN_OBJ_VAR_BETWEEN(random_jumped_obj);
 MP_DECLARE_CONST_FUN_OBJ_KW(random_normal_obj);
+MP_DECLARE_CONST_FUN_OBJ_2(random_permutation_obj);
 MP_DECLARE_CONST_FUN_OBJ_KW(random_random_obj);
+MP_DECLARE_CONST_FUN_OBJ_2(random_spawn_obj);
+MP_DECLARE_CONST_FUN_OBJ_KW(random_standard_normal_obj);
 MP_DECLARE_CONST_FUN_OBJ_KW(random_uniform_obj);
 
 #endif
@@ -43,7 +43,7 @@ static mp_obj_t stats_trace(mp_obj_t oin) {
         int32_t pos = i * (ndarray->strides[ULAB_MAX_DIMS - 1] + ndarray->strides[ULAB_MAX_DIMS - 2]);
         trace += ndarray_get_float_index(ndarray->array, ndarray->dtype, pos/ndarray->itemsize);
     }
-    if(ndarray->dtype == NDARRAY_FLOAT) {
+    if(NDARRAY_IS_FLOATING(ndarray->dtype)) {
         return mp_obj_new_float(trace);
     }
     return mp_obj_new_int_from_float(trace);
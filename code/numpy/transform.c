@@ -357,6 +357,20 @@ MP_DEFINE_CONST_FUN_OBJ_KW(transform_delete_obj, 2, transform_delete);
 //|    ...
 //|
 
+#if ULAB_SUPPORTS_COMPLEX
+static void transform_dot_load(ndarray_obj_t *ndarray, mp_float_t (*func)(void *), uint8_t *array, mp_float_t *value) {
+    // loads an element as a complex number; real elements get a zero imaginary part
+    if(ndarray->dtype == NDARRAY_COMPLEX) {
+        mp_float_t *c = (mp_float_t *)array;
+        value[0] = c[0];
+        value[1] = c[1];
+    } else {
+        value[0] = func(array);
+        value[1] = MICROPY_FLOAT_CONST(0.0);
+    }
+}
+#endif
+
 mp_obj_t transform_dot(mp_obj_t _m1, mp_obj_t _m2) {
     // TODO: should the results be upcast?
     // This implements 2D operations only!
@@ -365,14 +379,19 @@ mp_obj_t transform_dot(mp_obj_t _m1, mp_obj_t _m2) {
     }
     ndarray_obj_t *m1 = MP_OBJ_TO_PTR(_m1);
     ndarray_obj_t *m2 = MP_OBJ_TO_PTR(_m2);
-    COMPLEX_DTYPE_NOT_IMPLEMENTED(m1->dtype)
-    COMPLEX_DTYPE_NOT_IMPLEMENTED(m2->dtype)
 
     uint8_t *array1 = (uint8_t *)m1->array;
     uint8_t *array2 = (uint8_t *)m2->array;
 
+    #if ULAB_SUPPORTS_COMPLEX
+    uint8_t is_complex = (m1->dtype == NDARRAY_COMPLEX) || (m2->dtype == NDARRAY_COMPLEX);
+    // the float functions are not used for complex operands
+    mp_float_t (*func1)(void *) = m1->dtype == NDARRAY_COMPLEX ? NULL : ndarray_get_float_function(m1->dtype);
+    mp_float_t (*func2)(void *) = m2->dtype == NDARRAY_COMPLEX ? NULL : ndarray_get_float_function(m2->dtype);
+    #else
     mp_float_t (*func1)(void *) = ndarray_get_float_function(m1->dtype);
     mp_float_t (*func2)(void *) = ndarray_get_float_function(m2->dtype);
+    #endif
 
     if(m1->shape[ULAB_MAX_DIMS - 1] != m2->shape[ULAB_MAX_DIMS - m2->ndim]) {
         mp_raise_ValueError(MP_ERROR_TEXT("dimensions do not match"));
@@ -387,19 +406,44 @@ mp_obj_t transform_dot(mp_obj_t _m1, mp_obj_t _m2) {
     } else { // matrix times vector -> vector, vector times vector -> vector (size 1)
         shape = ndarray_shape_vector(0, 0, 0, shape1 * shape2);
     }
+    #if ULAB_SUPPORTS_COMPLEX
+    ndarray_obj_t *results = ndarray_new_dense_ndarray(ndim, shape, is_complex ? NDARRAY_COMPLEX : NDARRAY_FLOAT);
+    #else
     ndarray_obj_t *results = ndarray_new_dense_ndarray(ndim, shape, NDARRAY_FLOAT);
+    #endif
     mp_float_t *rarray = (mp_float_t *)results->array;
 
     for(size_t i=0; i < shape1; i++) { // rows of m1
         for(size_t j=0; j < shape2; j++) { // columns of m2
-            mp_float_t dot = 0.0;
-            for(size_t k=0; k < m1->shape[ULAB_MAX_DIMS - 1]; k++) {
-                // (i, k) * (k, j)
-                dot += func1(array1) * func2(array2);
-                array1 += m1->strides[ULAB_MAX_DIMS - 1];
-                array2 += m2->strides[ULAB_MAX_DIMS - m2->ndim];
+            #if ULAB_SUPPORTS_COMPLEX
+            if(is_complex) {
+                mp_float_t a[2], b[2];
+                mp_float_t real = MICROPY_FLOAT_CONST(0.0);
+                mp_float_t imag = MICROPY_FLOAT_CONST(0.0);
+                for(size_t k=0; k < m1->shape[ULAB_MAX_DIMS - 1]; k++) {
+                    // (i, k) * (k, j)
+                    transform_dot_load(m1, func1, array1, a);
+                    transform_dot_load(m2, func2, array2, b);
+                    real += a[0] * b[0] - a[1] * b[1];
+                    imag += a[0] * b[1] + a[1] * b[0];
+                    array1 += m1->strides[ULAB_MAX_DIMS - 1];
+                    array2 += m2->strides[ULAB_MAX_DIMS - m2->ndim];
+                }
+                *rarray++ = real;
+                *rarray++ = imag;
+            } else {
+            #endif
+                mp_float_t dot = 0.0;
+                for(size_t k=0; k < m1->shape[ULAB_MAX_DIMS - 1]; k++) {
+                    // (i, k) * (k, j)
+                    dot += func1(array1) * func2(array2);
+                    array1 += m1->strides[ULAB_MAX_DIMS - 1];
+                    array2 += m2->strides[ULAB_MAX_DIMS - m2->ndim];
+                }
+                *rarray++ = dot;
+            #if ULAB_SUPPORTS_COMPLEX
             }
-            *rarray++ = dot;
+            #endif
             array1 -= m1->strides[ULAB_MAX_DIMS - 1] * m1->shape[ULAB_MAX_DIMS - 1];
             array2 -= m2->strides[ULAB_MAX_DIMS - m2->ndim] * m2->shape[ULAB_MAX_DIMS - m2->ndim];
             array2 += m2->strides[ULAB_MAX_DIMS - 1];
@@ -408,6 +452,12 @@ mp_obj_t transform_dot(mp_obj_t _m1, mp_obj_t _m2) {
         array2 = m2->array;
     }
     if((m1->ndim * m2->ndim) == 1) { // return a scalar, if product of two vectors
+        #if ULAB_SUPPORTS_COMPLEX
+        if(is_complex) {
+            rarray -= 2;
+            return mp_obj_new_complex(rarray[0], rarray[1]);
+        }
+        #endif
         return mp_obj_new_float(*(--rarray));
     } else {
         return MP_OBJ_FROM_PTR(results);
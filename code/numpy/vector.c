@@ -60,8 +60,11 @@ static mp_obj_t vector_generic_vector(size_t n_args, const mp_obj_t *pos_args, m
     if(mp_obj_is_type(o_in, &ulab_ndarray_type)) {
         source = MP_OBJ_TO_PTR(o_in);
         COMPLEX_DTYPE_NOT_IMPLEMENTED(source->dtype)
+        #if !ULAB_VECTORISE_USES_FUN_POINTER
+        FLOAT16_PROMOTE_TO_FLOAT(source);
+        #endif
         if(out == mp_const_none) {
-            target = ndarray_new_dense_ndarray(source->ndim, source->shape, NDARRAY_FLOAT);
+            target = ndarray_new_dense_ndarray_uninitialised(source->ndim, source->shape, NDARRAY_FLOAT);
         } else {
             if(!mp_obj_is_type(out, &ulab_ndarray_type)) {
                 mp_raise_ValueError(MP_ERROR_TEXT("out must be an ndarray"));
@@ -104,7 +107,15 @@ static mp_obj_t vector_generic_vector(size_t n_args, const mp_obj_t *pos_args, m
             ITERATE_VECTOR(uint16_t, target, tarray, tstrides, source, sarray);
         } else if(source->dtype == NDARRAY_INT16) {
             ITERATE_VECTOR(int16_t, target, tarray, tstrides, source, sarray);
-        } else {
+        }
+        #if ULAB_HAS_INT32
+        else if(source->dtype == NDARRAY_UINT32) {
+            ITERATE_VECTOR(uint32_t, target, tarray, tstrides, source, sarray);
+        } else if(source->dtype == NDARRAY_INT32) {
+            ITERATE_VECTOR(int32_t, target, tarray, tstrides, source, sarray);
+        }
+        #endif
+        else {
             ITERATE_VECTOR(mp_float_t, target, tarray, tstrides, source, sarray);
         }
         #endif /* ULAB_VECTORISE_USES_FUN_POINTER */
@@ -130,8 +141,11 @@ static mp_obj_t vector_generic_vector(mp_obj_t o_in, mp_float_t (*f)(mp_float_t)
     if(mp_obj_is_type(o_in, &ulab_ndarray_type)) {
         ndarray_obj_t *source = MP_OBJ_TO_PTR(o_in);
         COMPLEX_DTYPE_NOT_IMPLEMENTED(source->dtype)
+        #if !ULAB_VECTORISE_USES_FUN_POINTER
+        FLOAT16_PROMOTE_TO_FLOAT(source);
+        #endif
         uint8_t *sarray = (uint8_t *)source->array;
-        ndarray = ndarray_new_dense_ndarray(source->ndim, source->shape, NDARRAY_FLOAT);
+        ndarray = ndarray_new_dense_ndarray_uninitialised(source->ndim, source->shape, NDARRAY_FLOAT);
         mp_float_t *array = (mp_float_t *)ndarray->array;
 
         #if ULAB_VECTORISE_USES_FUN_POINTER
@@ -151,7 +165,15 @@ static mp_obj_t vector_generic_vector(mp_obj_t o_in, mp_float_t (*f)(mp_float_t)
             ITERATE_VECTOR(uint16_t, array, source, sarray);
         } else if(source->dtype == NDARRAY_INT16) {
             ITERATE_VECTOR(int16_t, array, source, sarray);
-        } else {
+        }
+        #if ULAB_HAS_INT32
+        else if(source->dtype == NDARRAY_UINT32) {
+            ITERATE_VECTOR(uint32_t, array, source, sarray);
+        } else if(source->dtype == NDARRAY_INT32) {
+            ITERATE_VECTOR(int32_t, array, source, sarray);
+        }
+        #endif
+        else {
             ITERATE_VECTOR(mp_float_t, array, source, sarray);
         }
         #endif /* ULAB_VECTORISE_USES_FUN_POINTER */
@@ -255,7 +277,7 @@ mp_obj_t vector_around(size_t n_args, const mp_obj_t *pos_args, mp_map_t *kw_arg
         mp_raise_ValueError(MP_ERROR_TEXT("out keyword is not supported for function"));
     }
     #endif /* ULAB_MATH_FUNCTIONS_OUT_KEYWORD */
-    ndarray_obj_t *ndarray = ndarray_new_dense_ndarray(source->ndim, source->shape, NDARRAY_FLOAT);
+    ndarray_obj_t *ndarray = ndarray_new_dense_ndarray_uninitialised(source->ndim, source->shape, NDARRAY_FLOAT);
     mp_float_t *narray = (mp_float_t *)ndarray->array;
     uint8_t *sarray = (uint8_t *)source->array;
 
@@ -337,7 +359,7 @@ mp_obj_t vector_arctan2(mp_obj_t y, mp_obj_t x) {
     uint8_t *xarray = (uint8_t *)ndarray_x->array;
     uint8_t *yarray = (uint8_t *)ndarray_y->array;
 
-    ndarray_obj_t *results = ndarray_new_dense_ndarray(ndim, shape, NDARRAY_FLOAT);
+    ndarray_obj_t *results = ndarray_new_dense_ndarray_uninitialised(ndim, shape, NDARRAY_FLOAT);
     mp_float_t *rarray = (mp_float_t *)results->array;
 
     mp_float_t (*funcx)(void *) = ndarray_get_float_function(ndarray_x->dtype);
@@ -520,23 +542,29 @@ static mp_obj_t vector_exp(mp_obj_t o_in) {
         return mp_obj_new_complex(exp_real * MICROPY_FLOAT_C_FUN(cos)(imag), exp_real * MICROPY_FLOAT_C_FUN(sin)(imag));
     } else if(mp_obj_is_type(o_in, &ulab_ndarray_type)) {
         ndarray_obj_t *source = MP_OBJ_TO_PTR(o_in);
-        
-        #if ULAB_MATH_FUNCTIONS_OUT_KEYWORD
-        if((out != mp_const_none) && (source->dtype == NDARRAY_COMPLEX)){
-            mp_raise_ValueError(MP_ERROR_TEXT("out keyword is not supported for complex dtype"));
-        }
-        #endif /* ULAB_MATH_FUNCTIONS_OUT_KEYWORD */
 
         if(source->dtype == NDARRAY_COMPLEX) {
+            ndarray_obj_t *ndarray = NULL;
+            #if ULAB_MATH_FUNCTIONS_OUT_KEYWORD
+            if(out != mp_const_none) {
+                // the output is written linearly, so it must be dense; it can also be the input itself
+                ndarray = ulab_tools_inspect_out(out, NDARRAY_COMPLEX, source->ndim, source->shape, true);
+            }
+            #endif /* ULAB_MATH_FUNCTIONS_OUT_KEYWORD */
+            if(ndarray == NULL) {
+                ndarray = ndarray_new_dense_ndarray_uninitialised(source->ndim, source->shape, NDARRAY_COMPLEX);
+            }
+            if(source->len == 0) {
+                return MP_OBJ_FROM_PTR(ndarray);
+            }
             uint8_t *sarray = (uint8_t *)source->array;
-            ndarray_obj_t *ndarray = ndarray_new_dense_ndarray(source->ndim, source->shape, NDARRAY_COMPLEX);
             mp_float_t *array = (mp_float_t *)ndarray->array;
-            uint8_t itemsize = sizeof(mp_float_t);
 
             ITERATOR_HEAD();
-                mp_float_t real = *(mp_float_t *)sarray;
-                mp_float_t imag = *(mp_float_t *)(sarray + itemsize);
-                mp_float_t exp_real = MICROPY_FLOAT_C_FUN(exp)(real);
+                // the real, and imaginary parts are interleaved
+                mp_float_t *c = (mp_float_t *)sarray;
+                mp_float_t exp_real = MICROPY_FLOAT_C_FUN(exp)(c[0]);
+                mp_float_t imag = c[1];
                 *array++ = exp_real * MICROPY_FLOAT_C_FUN(cos)(imag);
                 *array++ = exp_real * MICROPY_FLOAT_C_FUN(sin)(imag);
             ITERATOR_TAIL(source, sarray);
@@ -877,7 +905,7 @@ static mp_obj_t vector_vectorized_function_call(mp_obj_t self_in, size_t n_args,
         uint8_t *narray = (uint8_t *)ndarray->array;
         
         ITERATOR_HEAD();
-            avalue[0] = mp_binary_get_val_array(source->dtype, sarray, 0);
+            avalue[0] = ndarray_get_value(source->dtype, sarray, 0);
             fvalue = MP_OBJ_TYPE_GET_SLOT(self->type, call)(self->fun, 1, 0, avalue);
             ndarray_set_value(self->otypes, narray, 0, fvalue);
             narray += ndarray->itemsize;
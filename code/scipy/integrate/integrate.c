@@ -37,6 +37,7 @@
 #include "../../ndarray.h"
 #include "../../ulab.h"
 #include "../../ulab_tools.h"
+#include "../../numpy/carray/carray_tools.h"
 #include "integrate.h"
 
 #if MICROPY_FLOAT_IMPL == MICROPY_FLOAT_IMPL_DOUBLE
@@ -66,6 +67,45 @@ static mp_float_t integrate_python_call(const mp_obj_type_t *type, mp_obj_t fun,
     return mp_obj_get_float(MP_OBJ_TYPE_GET_SLOT(type, call)(fun, nparams+1, 0, fargs));
 }
 
+#if ULAB_INTEGRATE_HAS_VECTORIZED
+// number of nodes per side that tanhsinh evaluates in a single call in vectorized mode
+#define ULAB_INTEGRATE_TANHSINH_CHUNK   32
+
+static void integrate_python_call_vectorized(const mp_obj_type_t *type, mp_obj_t fun, ndarray_obj_t *x, size_t n, mp_float_t *y) {
+    // Helper function for calculating the values of f at the first n abscissas stored in x in a single call.
+    // x must be a linear float array that can hold at least n values, and the function values are written into y.
+    // The python function must return an iterable of length n (typically an ndarray), or a scalar.
+    x->shape[ULAB_MAX_DIMS - 1] = n;
+    x->len = n;
+    mp_obj_t fargs[1] = { MP_OBJ_FROM_PTR(x) };
+    mp_obj_t result = MP_OBJ_TYPE_GET_SLOT(type, call)(fun, 1, 0, fargs);
+
+    if(mp_obj_is_type(result, &ulab_ndarray_type)) {
+        ndarray_obj_t *ndarray = MP_OBJ_TO_PTR(result);
+        COMPLEX_DTYPE_NOT_IMPLEMENTED(ndarray->dtype)
+        if(ndarray->len != n) {
+            mp_raise_ValueError(MP_ERROR_TEXT("vectorized function must return an array of the same length as its input"));
+        }
+        mp_float_t (*func)(void *) = ndarray_get_float_function(ndarray->dtype);
+        uint8_t *array = (uint8_t *)ndarray->array;
+        ITERATOR_HEAD();
+            *y++ = func(array);
+        ITERATOR_TAIL(ndarray, array);
+    } else if(mp_obj_is_int(result) || mp_obj_is_float(result)) {
+        // a constant function may return a scalar
+        mp_float_t value = mp_obj_get_float(result);
+        for(size_t i = 0; i < n; i++) {
+            *y++ = value;
+        }
+    } else {
+        if(mp_obj_get_int(mp_obj_len(result)) != (mp_int_t)n) {
+            mp_raise_ValueError(MP_ERROR_TEXT("vectorized function must return an array of the same length as its input"));
+        }
+        fill_array_iterable(y, result);
+    }
+}
+#endif /* ULAB_INTEGRATE_HAS_VECTORIZED */
+
 // sign helper function
 int sign(mp_float_t x) {
     if (x >= ULAB_ZERO) 
@@ -131,8 +171,115 @@ mp_float_t exp_sinh_opt_d(mp_float_t (*fun)(mp_float_t), mp_float_t a, mp_float_
 }
 
 
+#if ULAB_INTEGRATE_HAS_VECTORIZED
+// return the partial sum of a single level, evaluating the function at up to ULAB_INTEGRATE_TANHSINH_CHUNK nodes
+// per side in a single call; the sum is accumulated in exactly the same order as in the scalar loops of tanhsinh
+static mp_float_t tanhsinh_level_vectorized(mp_float_t (*fun)(mp_float_t), ndarray_obj_t *xarray, int mode, mp_float_t a, mp_float_t b,
+                                            mp_float_t c, mp_float_t d, mp_float_t t, mp_float_t eh, mp_float_t eps) {
+    const mp_obj_type_t *type = mp_obj_get_type(fun);
+    mp_float_t *nodes = (mp_float_t *)xarray->array;
+    mp_float_t fv[2 * ULAB_INTEGRATE_TANHSINH_CHUNK];
+    mp_float_t weights[ULAB_INTEGRATE_TANHSINH_CHUNK], chs[ULAB_INTEGRATE_TANHSINH_CHUNK];
+    // bit 0: the left node was evaluated, bit 1: the right node was evaluated, bit 2: the loop must stop here
+    uint8_t flags[ULAB_INTEGRATE_TANHSINH_CHUNK];
+    mp_float_t p = ULAB_ZERO, q, fp = ULAB_ZERO, fm = ULAB_ZERO;
+    // start with a short chunk, so that few evaluations are wasted, if the sum converges quickly
+    uint8_t chunk = 4;
+
+    while(1) {
+        // fill in the abscissas of the next chunk
+        size_t count = 0;
+        uint8_t m;
+        for(m = 0; m < chunk; m++) {
+            flags[m] = 0;
+            if(mode == 0) {                     // Tanh-Sinh
+                mp_float_t u = MICROPY_FLOAT_C_FUN(exp)(ULAB_ONE / t - t);
+                mp_float_t r = ULAB_TWO * u / (ULAB_ONE + u);
+                weights[m] = (t + ULAB_ONE / t) * r / (ULAB_ONE + u);
+                mp_float_t xm = d*r;
+                if(a+xm > a) {
+                    nodes[count++] = a+xm;
+                    flags[m] |= 1;
+                }
+                if(b-xm < b) {
+                    nodes[count++] = b-xm;
+                    flags[m] |= 2;
+                }
+            } else {
+                mp_float_t r = MICROPY_FLOAT_C_FUN(exp)(t - ULAB_POINT_TWO_FIVE / t);
+                mp_float_t w = r;
+                chs[m] = t + ULAB_POINT_TWO_FIVE / t;
+                if(!isfinite(r)) {              // the abscissas would be infinite, stop here
+                    flags[m] = 4;
+                    m++;
+                    break;
+                }
+                if(mode == 1) {                 // Exp-Sinh
+                    mp_float_t xm = c + d/r;
+                    if(xm == c) {               // the finite endpoint was hit, there is nothing more to evaluate
+                        flags[m] = 4;
+                        m++;
+                        break;
+                    }
+                    nodes[count++] = xm;
+                } else {                        // Sinh-Sinh
+                    r = (r - ULAB_ONE / r) / ULAB_TWO;
+                    w = (w + ULAB_ONE / w) / ULAB_TWO;
+                    nodes[count++] = c - d*r;
+                }
+                nodes[count++] = c + d*r;
+                weights[m] = w;
+                flags[m] = 3;
+            }
+            t *= eh;
+        }
+        if(count > 0) {
+            integrate_python_call_vectorized(type, fun, xarray, count, fv);
+        }
+        if(chunk < ULAB_INTEGRATE_TANHSINH_CHUNK) {
+            chunk *= 2;
+        }
+        // replay the chunk
+        mp_float_t *y = fv;
+        for(uint8_t l = 0; l < m; l++) {
+            if(mode == 0) {
+                if(flags[l] & 1) {
+                    if(isfinite(*y))
+                        fp = *y;
+                    y++;
+                }
+                if(flags[l] & 2) {
+                    if(isfinite(*y))
+                        fm = *y;
+                    y++;
+                }
+                q = weights[l]*(fp+fm);
+            } else {
+                if(flags[l] & 4) {
+                    return p;
+                }
+                q = ULAB_ZERO;
+                if(isfinite(*y))
+                    q += (mode == 1) ? *y / weights[l] : *y * weights[l];
+                y++;
+                if(isfinite(*y))
+                    q += *y * weights[l];
+                y++;
+                q *= chs[l];
+            }
+            p += q;
+            if(!(MICROPY_FLOAT_C_FUN(fabs)(q) > eps*MICROPY_FLOAT_C_FUN(fabs)(p))) {
+                return p;
+            }
+        }
+    }
+}
+#endif /* ULAB_INTEGRATE_HAS_VECTORIZED */
+
 // integrate function f, range a..b, max levels n, error tolerance eps
-mp_float_t tanhsinh(mp_float_t (*fun)(mp_float_t), mp_float_t a, mp_float_t b, uint16_t n, mp_float_t eps, mp_float_t *e) {
+// if xarray is not NULL, it must be a linear float array of length 2 * ULAB_INTEGRATE_TANHSINH_CHUNK,
+// and the function is evaluated on chunks of nodes in a single call
+mp_float_t tanhsinh(mp_float_t (*fun)(mp_float_t), mp_float_t a, mp_float_t b, uint16_t n, mp_float_t eps, mp_float_t *e, ndarray_obj_t *xarray) {
     const mp_obj_type_t *type = mp_obj_get_type(fun);
     mp_obj_t fargs[1];
     const mp_float_t tol = ULAB_TEN * eps;
@@ -174,6 +321,12 @@ mp_float_t tanhsinh(mp_float_t (*fun)(mp_float_t), mp_float_t a, mp_float_t b, u
         t = eh = MICROPY_FLOAT_C_FUN(exp)(h);
         if (k > ULAB_ZERO)
            eh *= eh;
+        #if ULAB_INTEGRATE_HAS_VECTORIZED
+        if (xarray != NULL) {
+            p = tanhsinh_level_vectorized(fun, xarray, mode, a, b, c, d, mode == 0 ? t : t / ULAB_TWO, eh, eps);
+        }
+        else
+        #endif
         if (mode == 0) {                        // Tanh-Sinh
             do {
                 mp_float_t u = MICROPY_FLOAT_C_FUN(exp)(ULAB_ONE / t - t); // = exp(-2*sinh(j*h)) = 1/exp(sinh(j*h))^2
@@ -201,6 +354,8 @@ mp_float_t tanhsinh(mp_float_t (*fun)(mp_float_t), mp_float_t a, mp_float_t b, u
                 mp_float_t r = MICROPY_FLOAT_C_FUN(exp)(t - ULAB_POINT_TWO_FIVE / t);    // = exp(sinh(j*h))
                 mp_float_t x, y, w = r;
                 q = ULAB_ZERO;
+                if (!isfinite(r))               // if the abscissas would be infinite then break
+                    break;
                 if (mode == 1) {                // Exp-Sinh
                     x = c + d/r;
                     if (x == c)                 // if x hit the finite endpoint then break
@@ -241,7 +396,8 @@ mp_float_t tanhsinh(mp_float_t (*fun)(mp_float_t), mp_float_t a, mp_float_t b, u
 //|     b: float,
 //|     *,
 //|     levels: int = 6
-//|     eps: float = etolerance
+//|     eps: float = etolerance,
+//|     vectorized: bool = False
 //| ) -> float:
 //|     """
 //|     :param callable f: The function to integrate
@@ -249,6 +405,7 @@ mp_float_t tanhsinh(mp_float_t (*fun)(mp_float_t), mp_float_t a, mp_float_t b, u
 //|     :param float b: The upper integration limit
 //|     :param float levels: The number of levels to perform (6..7 is optimal)
 //|     :param float eps: The error tolerance value 
+//|     :param bool vectorized: If True, ``f`` is called with an ndarray of abscissas, and must return an iterable of the same length
 //|
 //|     Find a quadrature of the function ``f(x)`` on the interval
 //|     (``a``..``b``) using an optimized double exponential.  The result is accurate to within
@@ -263,6 +420,9 @@ static mp_obj_t integrate_tanhsinh(size_t n_args, const mp_obj_t *pos_args, mp_m
         { MP_QSTR_, MP_ARG_REQUIRED | MP_ARG_OBJ, {.u_rom_obj = MP_ROM_NONE } },
         { MP_QSTR_levels, MP_ARG_KW_ONLY | MP_ARG_INT, {.u_int = 6} },
         { MP_QSTR_eps, MP_ARG_KW_ONLY | MP_ARG_OBJ, {.u_rom_obj = ULAB_REFERENCE_FLOAT_CONST(etolerance)} },
+        #if ULAB_INTEGRATE_HAS_VECTORIZED
+        { MP_QSTR_vectorized, MP_ARG_KW_ONLY | MP_ARG_OBJ, {.u_rom_obj = MP_ROM_FALSE } },
+        #endif
     };
 
     mp_arg_val_t args[MP_ARRAY_SIZE(allowed_args)];
@@ -293,7 +453,13 @@ static mp_obj_t integrate_tanhsinh(size_t n_args, const mp_obj_t *pos_args, mp_m
     
     mp_obj_t res[2];
     mp_float_t e;
-    res[0] = mp_obj_new_float(tanhsinh(fun, a, b, n, eps, &e));
+    ndarray_obj_t *xarray = NULL;
+    #if ULAB_INTEGRATE_HAS_VECTORIZED
+    if(mp_obj_is_true(args[5].u_obj)) {
+        xarray = ndarray_new_linear_array(2 * ULAB_INTEGRATE_TANHSINH_CHUNK, NDARRAY_FLOAT);
+    }
+    #endif
+    res[0] = mp_obj_new_float(tanhsinh(fun, a, b, n, eps, &e, xarray));
     res[1] = mp_obj_new_float(e);
     return mp_obj_new_tuple(2, res); 
 }
@@ -308,13 +474,31 @@ MP_DEFINE_CONST_FUN_OBJ_KW(integrate_tanhsinh_obj, 2, integrate_tanhsinh);
 // https://docs.scipy.org/doc/scipy/reference/generated/scipy.integrate.romberg.html (which is different 
 // insofar as the latter expects an array of function values). 
 
-mp_float_t qromb(mp_float_t (*fun)(mp_float_t), mp_float_t a, mp_float_t b, uint16_t n, mp_float_t eps) {
+// if vectorized is true, the new abscissas of each level are passed to fun in a single call
+mp_float_t qromb(mp_float_t (*fun)(mp_float_t), mp_float_t a, mp_float_t b, uint16_t n, mp_float_t eps, bool vectorized) {
     const mp_obj_type_t *type = mp_obj_get_type(fun);
     mp_obj_t fargs[1];
     mp_float_t R1[n], R2[n];
     mp_float_t *Ro = &R1[0], *Ru = &R2[0];
-    mp_float_t h = b-a;
+    mp_float_t h = b-a, result = ULAB_ZERO;
     uint16_t i, j;
+    #if ULAB_INTEGRATE_HAS_VECTORIZED
+    ndarray_obj_t *xarray = NULL;
+    mp_float_t *fv = NULL;
+    size_t fv_len = 2;
+    if (vectorized) {
+        xarray = ndarray_new_linear_array(2, NDARRAY_FLOAT);
+        fv = m_new(mp_float_t, fv_len);
+        mp_float_t *nodes = (mp_float_t *)xarray->array;
+        nodes[0] = a;
+        nodes[1] = b;
+        integrate_python_call_vectorized(type, fun, xarray, 2, fv);
+        Ro[0] = (fv[0] + fv[1]) * h/2;
+    }
+    else
+    #else
+    (void)vectorized;
+    #endif
     Ro[0] = (integrate_python_call(type, fun, a, fargs, 0) + integrate_python_call(type, fun, b, fargs, 0)) * h/2;
     for (i = 1; i < n; ++i) {
         unsigned long long k = 1UL << i;
@@ -322,6 +506,25 @@ mp_float_t qromb(mp_float_t (*fun)(mp_float_t), mp_float_t a, mp_float_t b, uint
         mp_float_t sum = ULAB_ZERO;
         mp_float_t *Rt;
         h /= ULAB_TWO;
+        #if ULAB_INTEGRATE_HAS_VECTORIZED
+        if (vectorized) {
+            // level i adds the k/2 odd multiples of h; the arrays grow with the level
+            size_t count = (size_t)(k / 2);
+            if (count > fv_len) {
+                m_del(mp_float_t, fv, fv_len);
+                fv_len = count;
+                fv = m_new(mp_float_t, fv_len);
+                xarray = ndarray_new_linear_array(count, NDARRAY_FLOAT);
+            }
+            mp_float_t *nodes = (mp_float_t *)xarray->array;
+            for (j = 1; j < k; j += 2)
+                *nodes++ = a+j*h;
+            integrate_python_call_vectorized(type, fun, xarray, count, fv);
+            for (size_t l = 0; l < count; l++)
+                sum += fv[l];
+        }
+        else
+        #endif
         for (j = 1; j < k; j += 2)
             sum += integrate_python_call(type, fun, a+j*h, fargs, 0);
         Ru[0] = h*sum + Ro[0] / ULAB_TWO;
@@ -329,13 +532,21 @@ mp_float_t qromb(mp_float_t (*fun)(mp_float_t), mp_float_t a, mp_float_t b, uint
             s <<= 2;
             Ru[j] = (s*Ru[j-1] - Ro[j-1])/(s-1);
         }
-        if (i > 2 && MICROPY_FLOAT_C_FUN(fabs)(Ro[i-1]-Ru[i]) <= eps*MICROPY_FLOAT_C_FUN(fabs)(Ru[i])+eps)
-            return Ru[i];
+        if (i > 2 && MICROPY_FLOAT_C_FUN(fabs)(Ro[i-1]-Ru[i]) <= eps*MICROPY_FLOAT_C_FUN(fabs)(Ru[i])+eps) {
+            result = Ru[i];
+            break;
+        }
         Rt = Ro;
         Ro = Ru;
         Ru = Rt;
     }
-    return Ro[n-1];
+    if (i == n)
+        result = Ro[n-1];
+    #if ULAB_INTEGRATE_HAS_VECTORIZED
+    if (fv != NULL)
+        m_del(mp_float_t, fv, fv_len);
+    #endif
+    return result;
 }
 
 //| def romberg(
@@ -344,7 +555,8 @@ mp_float_t qromb(mp_float_t (*fun)(mp_float_t), mp_float_t a, mp_float_t b, uint
 //|     b: float,
 //|     *,
 //|     steps: int = 100
-//|     eps: float = etolerance
+//|     eps: float = etolerance,
+//|     vectorized: bool = False
 //| ) -> float:
 //|     """
 //|     :param callable f: The function to integrate
@@ -352,6 +564,7 @@ mp_float_t qromb(mp_float_t (*fun)(mp_float_t), mp_float_t a, mp_float_t b, uint
 //|     :param float b: The upper integration limit
 //|     :param float steps: The number of equidistant steps
 //|     :param float eps: The tolerance value
+//|     :param bool vectorized: If True, ``f`` is called with an ndarray of abscissas, and must return an iterable of the same length
 //|
 //|     Find a quadrature of the function ``f(x)`` on the interval
 //|     (``a``..``b``) using the Romberg method.  The result is accurate to within
@@ -366,6 +579,9 @@ static mp_obj_t integrate_romberg(size_t n_args, const mp_obj_t *pos_args, mp_ma
         { MP_QSTR_, MP_ARG_REQUIRED | MP_ARG_OBJ, {.u_rom_obj = MP_ROM_NONE } },
         { MP_QSTR_steps, MP_ARG_KW_ONLY | MP_ARG_INT, {.u_int = 100} },
         { MP_QSTR_eps, MP_ARG_KW_ONLY | MP_ARG_OBJ, {.u_rom_obj = ULAB_REFERENCE_FLOAT_CONST(etolerance)} },
+        #if ULAB_INTEGRATE_HAS_VECTORIZED
+        { MP_QSTR_vectorized, MP_ARG_KW_ONLY | MP_ARG_OBJ, {.u_rom_obj = MP_ROM_FALSE } },
+        #endif
     };
 
     mp_arg_val_t args[MP_ARRAY_SIZE(allowed_args)];
@@ -394,7 +610,11 @@ static mp_obj_t integrate_romberg(size_t n_args, const mp_obj_t *pos_args, mp_ma
     }			
     mp_float_t eps = mp_obj_get_float(args[4].u_obj);
     
-    return mp_obj_new_float(qromb(fun, a, b, steps, eps)); 
+    bool vectorized = false;
+    #if ULAB_INTEGRATE_HAS_VECTORIZED
+    vectorized = mp_obj_is_true(args[5].u_obj);
+    #endif
+    return mp_obj_new_float(qromb(fun, a, b, steps, eps, vectorized)); 
 }
 
 MP_DEFINE_CONST_FUN_OBJ_KW(integrate_romberg_obj, 2, integrate_romberg);
@@ -424,6 +644,82 @@ mp_float_t as(mp_float_t (*fun)(mp_float_t), mp_float_t a, mp_float_t b, mp_floa
     return as(fun, m, b, fm, f2, fb, sr, eps, n, t);
 }
 
+#if ULAB_INTEGRATE_HAS_VECTORIZED
+typedef struct _integrate_simpson_interval_t {
+    mp_float_t a;
+    mp_float_t b;
+    mp_float_t fa;
+    mp_float_t fm;
+    mp_float_t fb;
+    mp_float_t v;
+} integrate_simpson_interval_t;
+
+// Breadth-first variant of the recursion in as(): all intervals of a given depth share eps and n,
+// hence the two inner points of all active intervals can be evaluated in a single call
+static mp_float_t qasi_vectorized(mp_float_t (*fun)(mp_float_t), mp_float_t a, mp_float_t b, int n, mp_float_t eps) {
+    const mp_obj_type_t *type = mp_obj_get_type(fun);
+    ndarray_obj_t *xarray = ndarray_new_linear_array(3, NDARRAY_FLOAT);
+    mp_float_t *nodes = (mp_float_t *)xarray->array;
+    mp_float_t fv[3];
+    nodes[0] = a;
+    nodes[1] = (a+b)/2;
+    nodes[2] = b;
+    integrate_python_call_vectorized(type, fun, xarray, 3, fv);
+
+    size_t active = 1, allocated = 1;
+    integrate_simpson_interval_t *intervals = m_new(integrate_simpson_interval_t, allocated);
+    intervals[0].a = a;
+    intervals[0].b = b;
+    intervals[0].fa = fv[0];
+    intervals[0].fm = fv[1];
+    intervals[0].fb = fv[2];
+    intervals[0].v = (fv[0] + ULAB_FOUR * fv[1] + fv[2]) * (b-a) / ULAB_SIX;
+
+    mp_float_t t = ULAB_ZERO;
+    while (active > 0) {
+        xarray = ndarray_new_linear_array(2 * active, NDARRAY_FLOAT);
+        nodes = (mp_float_t *)xarray->array;
+        mp_float_t *f12 = m_new(mp_float_t, 2 * active);
+        for (size_t i = 0; i < active; i++) {
+            mp_float_t h = (intervals[i].b - intervals[i].a) / ULAB_TWO;
+            *nodes++ = intervals[i].a + h / ULAB_TWO;
+            *nodes++ = intervals[i].b - h / ULAB_TWO;
+        }
+        integrate_python_call_vectorized(type, fun, xarray, 2 * active, f12);
+
+        // each active interval either converges, or is replaced by its two halves
+        integrate_simpson_interval_t *next = m_new(integrate_simpson_interval_t, 2 * active);
+        size_t next_active = 0;
+        for (size_t i = 0; i < active; i++) {
+            integrate_simpson_interval_t *interval = &intervals[i];
+            mp_float_t h = (interval->b - interval->a) / ULAB_TWO;
+            mp_float_t f1 = f12[2*i];
+            mp_float_t f2 = f12[2*i+1];
+            mp_float_t sl = h*(interval->fa + ULAB_FOUR * f1 + interval->fm) / ULAB_SIX;
+            mp_float_t sr = h*(interval->fm + ULAB_FOUR * f2 + interval->fb) / ULAB_SIX;
+            mp_float_t s = sl+sr;
+            mp_float_t d = (s - interval->v) / ULAB_FIFTEEN;
+            mp_float_t m = interval->a + h;
+            if (n <= 0 || MICROPY_FLOAT_C_FUN(fabs)(d) < eps) {
+                t += s + d;
+                continue;
+            }
+            next[next_active++] = (integrate_simpson_interval_t){ interval->a, m, interval->fa, f1, interval->fm, sl };
+            next[next_active++] = (integrate_simpson_interval_t){ m, interval->b, interval->fm, f2, interval->fb, sr };
+        }
+        m_del(mp_float_t, f12, 2 * active);
+        m_del(integrate_simpson_interval_t, intervals, allocated);
+        intervals = next;
+        allocated = 2 * active;
+        active = next_active;
+        eps /= ULAB_TWO;
+        --n;
+    }
+    m_del(integrate_simpson_interval_t, intervals, allocated);
+    return t;
+}
+#endif /* ULAB_INTEGRATE_HAS_VECTORIZED */
+
 mp_float_t qasi(mp_float_t (*fun)(mp_float_t), mp_float_t a, mp_float_t b, int n, mp_float_t eps) {
     const mp_obj_type_t *type = mp_obj_get_type(fun);
     mp_obj_t fargs[1];
@@ -440,7 +736,8 @@ mp_float_t qasi(mp_float_t (*fun)(mp_float_t), mp_float_t a, mp_float_t b, int n
 //|     b: float,
 //|     *,
 //|     steps: int = 100
-//|     eps: float = etolerance
+//|     eps: float = etolerance,
+//|     vectorized: bool = False
 //| ) -> float:
 //|     """
 //|     :param callable f: The function to integrate
@@ -448,6 +745,7 @@ mp_float_t qasi(mp_float_t (*fun)(mp_float_t), mp_float_t a, mp_float_t b, int n
 //|     :param float b: The upper integration limit
 //|     :param float steps: The number of equidistant steps
 //|     :param float eps: The tolerance value
+//|     :param bool vectorized: If True, ``f`` is called with an ndarray of abscissas, and must return an iterable of the same length
 //|
 //|     Find a quadrature of the function ``f(x)`` on the interval
 //|     (``a``..``b``) using the Adaptive Simpson's method.  The result is accurate to within
@@ -462,6 +760,9 @@ static mp_obj_t integrate_simpson(size_t n_args, const mp_obj_t *pos_args, mp_ma
         { MP_QSTR_, MP_ARG_REQUIRED | MP_ARG_OBJ, {.u_rom_obj = MP_ROM_NONE } },
         { MP_QSTR_steps, MP_ARG_KW_ONLY | MP_ARG_INT, {.u_int = 100} },
         { MP_QSTR_eps, MP_ARG_KW_ONLY | MP_ARG_OBJ, {.u_rom_obj = ULAB_REFERENCE_FLOAT_CONST(etolerance)} },
+        #if ULAB_INTEGRATE_HAS_VECTORIZED
+        { MP_QSTR_vectorized, MP_ARG_KW_ONLY | MP_ARG_OBJ, {.u_rom_obj = MP_ROM_FALSE } },
+        #endif
     };
 
     mp_arg_val_t args[MP_ARRAY_SIZE(allowed_args)];
@@ -490,6 +791,11 @@ static mp_obj_t integrate_simpson(size_t n_args, const mp_obj_t *pos_args, mp_ma
     }			
     mp_float_t eps = mp_obj_get_float(args[4].u_obj);
     
+    #if ULAB_INTEGRATE_HAS_VECTORIZED
+    if(mp_obj_is_true(args[5].u_obj)) {
+        return mp_obj_new_float(qasi_vectorized(fun, a, b, steps, eps));
+    }
+    #endif
     return mp_obj_new_float(qasi(fun, a, b, steps, eps)); 
 }
 
@@ -500,7 +806,8 @@ MP_DEFINE_CONST_FUN_OBJ_KW(integrate_simpson_obj, 2, integrate_simpson);
 // Adaptive Gauss-Kronrod (G10,K21) quadrature
 // https://en.wikipedia.org/wiki/Gauss%E2%80%93Kronrod_quadrature_formula, https://www.genivia.com/qthsh.html
 
-mp_float_t gk(mp_float_t (*fun)(mp_float_t), mp_float_t c, mp_float_t d, mp_float_t *err) {
+// if xarray is not NULL, it must be a linear float array of length 41, and the nodes are passed to fun in a single call
+mp_float_t gk(mp_float_t (*fun)(mp_float_t), mp_float_t c, mp_float_t d, mp_float_t *err, ndarray_obj_t *xarray) {
 // abscissas and weights pre-calculated with Legendre Stieltjes polynomials
     static const mp_float_t abscissas[21] = {
         MICROPY_FLOAT_CONST(0.00000000000000000e+00),
@@ -567,6 +874,28 @@ mp_float_t gk(mp_float_t (*fun)(mp_float_t), mp_float_t c, mp_float_t d, mp_floa
     mp_float_t fp, fm;
     mp_float_t e;
     int i;
+    #if ULAB_INTEGRATE_HAS_VECTORIZED
+    if(xarray != NULL) {
+        // evaluate the function at all 41 nodes in a single call:
+        // fv[0] = f(c), fv[2i-1] = f(c + d * abscissas[i]), fv[2i] = f(c - d * abscissas[i])
+        mp_float_t fv[41];
+        mp_float_t *nodes = (mp_float_t *)xarray->array;
+        nodes[0] = c;
+        for (i = 1; i < 21; i++) {
+            nodes[2*i-1] = c + d * abscissas[i];
+            nodes[2*i] = c - d * abscissas[i];
+        }
+        integrate_python_call_vectorized(type, fun, xarray, 41, fv);
+        p = fv[0] * weights[0];
+        for (i = 1; i < 21; i += 2) {
+            p += (fv[2*i-1] + fv[2*i]) * weights[i];
+            q += (fv[2*i-1] + fv[2*i]) * gauss_weights[i/2];
+        }
+        for (i = 2; i < 21; i += 2) {
+            p += (fv[2*i-1] + fv[2*i]) * weights[i];
+        }
+    } else {
+    #endif
     fp = integrate_python_call(type, fun, c, fargs, 0);
     p = fp * weights[0];
     for (i = 1; i < 21; i += 2) {
@@ -580,6 +909,9 @@ mp_float_t gk(mp_float_t (*fun)(mp_float_t), mp_float_t c, mp_float_t d, mp_floa
         fm = integrate_python_call(type, fun, c - d * abscissas[i], fargs, 0);
         p += (fp + fm) * weights[i];
     }
+    #if ULAB_INTEGRATE_HAS_VECTORIZED
+    }
+    #endif
     *err = MICROPY_FLOAT_C_FUN(fabs)(p - q);
     e = MICROPY_FLOAT_C_FUN(fabs)(2 * p * ULAB_MACHEPS); // optional, to take 1e-17 MachEps prec. into account
     if (*err < e)
@@ -587,18 +919,18 @@ mp_float_t gk(mp_float_t (*fun)(mp_float_t), mp_float_t c, mp_float_t d, mp_floa
     return p;
 }
 
-mp_float_t qakro(mp_float_t (*fun)(mp_float_t), mp_float_t a, mp_float_t b, int n, mp_float_t tol, mp_float_t eps, mp_float_t *err) {
+mp_float_t qakro(mp_float_t (*fun)(mp_float_t), mp_float_t a, mp_float_t b, int n, mp_float_t tol, mp_float_t eps, mp_float_t *err, ndarray_obj_t *xarray) {
     mp_float_t c = (a+b) / ULAB_TWO;
     mp_float_t d = (b-a) / ULAB_TWO;
     mp_float_t e;
-    mp_float_t r = gk(fun, c, d, &e);
+    mp_float_t r = gk(fun, c, d, &e, xarray);
     mp_float_t s = d*r;
     mp_float_t t = MICROPY_FLOAT_C_FUN(fabs)(s*tol);
     if (tol == ULAB_ZERO)
         tol = t;
     if (n > 0 && t < e && tol < e) {
-        s = qakro(fun, a, c, n-1, t / ULAB_TWO, eps, err);
-        s += qakro(fun, c, b, n-1, t / ULAB_TWO, eps, &e);
+        s = qakro(fun, a, c, n-1, t / ULAB_TWO, eps, err, xarray);
+        s += qakro(fun, c, b, n-1, t / ULAB_TWO, eps, &e, xarray);
         *err += e;
         return s;
     }
@@ -613,7 +945,8 @@ mp_float_t qakro(mp_float_t (*fun)(mp_float_t), mp_float_t a, mp_float_t b, int
 //|     b: float,
 //|     *,
 //|     order: int = 5
-//|     eps: float = etolerance
+//|     eps: float = etolerance,
+//|     vectorized: bool = False
 //| ) -> float:
 //|     """
 //|     :param callable f: The function to integrate
@@ -621,6 +954,7 @@ mp_float_t qakro(mp_float_t (*fun)(mp_float_t), mp_float_t a, mp_float_t b, int
 //|     :param float b: The upper integration limit
 //|     :param float order: Order of quadrature integration. Default is 5.
 //|     :param float eps: The tolerance value
+//|     :param bool vectorized: If True, ``f`` is called with an ndarray of abscissas, and must return an iterable of the same length
 //|
 //|     Find a quadrature of the function ``f(x)`` on the interval
 //|     (``a``..``b``) using the Adaptive Gauss-Kronrod method.  The result is accurate to within
@@ -635,6 +969,9 @@ static mp_obj_t integrate_quad(size_t n_args, const mp_obj_t *pos_args, mp_map_t
         { MP_QSTR_, MP_ARG_REQUIRED | MP_ARG_OBJ, {.u_rom_obj = MP_ROM_NONE } },
         { MP_QSTR_order, MP_ARG_KW_ONLY | MP_ARG_INT, {.u_int = 5} },
         { MP_QSTR_eps, MP_ARG_KW_ONLY | MP_ARG_OBJ, {.u_rom_obj = ULAB_REFERENCE_FLOAT_CONST(etolerance)} },
+        #if ULAB_INTEGRATE_HAS_VECTORIZED
+        { MP_QSTR_vectorized, MP_ARG_KW_ONLY | MP_ARG_OBJ, {.u_rom_obj = MP_ROM_FALSE } },
+        #endif
     };
 
     mp_arg_val_t args[MP_ARRAY_SIZE(allowed_args)];
@@ -665,7 +1002,14 @@ static mp_obj_t integrate_quad(size_t n_args, const mp_obj_t *pos_args, mp_map_t
     
     mp_obj_t res[2];
     mp_float_t e;
-    res[0] = mp_obj_new_float(qakro(fun, a, b, order, 0, eps, &e));
+    ndarray_obj_t *xarray = NULL;
+    #if ULAB_INTEGRATE_HAS_VECTORIZED
+    if(mp_obj_is_true(args[5].u_obj)) {
+        // the 41 nodes of the (G10,K21) rule are passed to the function in a single call
+        xarray = ndarray_new_linear_array(41, NDARRAY_FLOAT);
+    }
+    #endif
+    res[0] = mp_obj_new_float(qakro(fun, a, b, order, 0, eps, &e, xarray));
     res[1] = mp_obj_new_float(e);
     return mp_obj_new_tuple(2, res); 
 }
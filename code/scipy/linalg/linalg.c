@@ -19,6 +19,7 @@
 
 #include "../../ulab.h"
 #include "../../ulab_tools.h"
+#include "../../numpy/carray/carray_tools.h"
 #include "../../numpy/linalg/linalg_tools.h"
 #include "linalg.h"
 
@@ -32,11 +33,90 @@
 
 #if ULAB_MAX_DIMS > 1
 
-//| def solve_triangular(A: ulab.numpy.ndarray, b: ulab.numpy.ndarray, lower: bool) -> ulab.numpy.ndarray:
+// the number of right-hand sides that are processed in a single sweep over the matrix
+#ifndef ULAB_SCIPY_LINALG_BLOCK_SIZE
+#define ULAB_SCIPY_LINALG_BLOCK_SIZE    32
+#endif
+
+static ndarray_obj_t *linalg_prepare_rhs(ndarray_obj_t *A, ndarray_obj_t *b, mp_obj_t out, bool overwrite_b) {
+    // Checks the shape of the right-hand side, and returns the dense float array in which the solution is
+    // to be calculated. This is out, if supplied, b itself, if it can be overwritten, or a new array.
+    // The values of b are copied into the returned array, unless it is b itself.
+    tools_object_is_square(MP_OBJ_FROM_PTR(A));
+    if((b->ndim > 2) || (b->shape[ULAB_MAX_DIMS - b->ndim] != A->shape[ULAB_MAX_DIMS - 2])) {
+        mp_raise_ValueError(MP_ERROR_TEXT("shapes of A, and b are not compatible"));
+    }
+    ndarray_obj_t *x;
+    if(out != mp_const_none) {
+        x = ulab_tools_inspect_out(out, NDARRAY_FLOAT, b->ndim, b->shape, true);
+    } else if(overwrite_b && (b->dtype == NDARRAY_FLOAT)) {
+        return b;
+    } else {
+        x = ndarray_new_dense_ndarray(b->ndim, b->shape, NDARRAY_FLOAT);
+    }
+    if(x != b) {
+        mp_float_t (*get_b_ele)(void *) = ndarray_get_float_function(b->dtype);
+        mp_float_t *x_arr = (mp_float_t *)x->array;
+        uint8_t *b_arr = (uint8_t *)b->array;
+        for(size_t i = 0; i < b->len; i++) {
+            *x_arr++ = get_b_ele(b_arr);
+            b_arr += b->strides[ULAB_MAX_DIMS - 1];
+        }
+    }
+    return x;
+}
+
+static void linalg_triangular_substitution(ndarray_obj_t *A, ndarray_obj_t *x, bool lower, bool transpose) {
+    // Solves A x = b in place, where x holds b on entry, and is a dense float array of shape (n,), or (n, k).
+    // If transpose is true, the transpose of A is used, so that an upper triangular system can be solved
+    // with a lower triangular matrix, and vice versa.
+    // The right-hand sides are processed in blocks of ULAB_SCIPY_LINALG_BLOCK_SIZE columns: the
+    // matrix is traversed once per block, and each of its entries is applied to all columns of the block.
+    size_t n = A->shape[ULAB_MAX_DIMS - 2];
+    size_t k = x->ndim == 1 ? 1 : x->shape[ULAB_MAX_DIMS - 1];
+    mp_float_t (*get_A_ele)(void *) = ndarray_get_float_function(A->dtype);
+    int32_t row_stride = transpose ? A->strides[ULAB_MAX_DIMS - 1] : A->strides[ULAB_MAX_DIMS - 2];
+    int32_t col_stride = transpose ? A->strides[ULAB_MAX_DIMS - 2] : A->strides[ULAB_MAX_DIMS - 1];
+    mp_float_t *x_arr = (mp_float_t *)x->array;
+
+    for(size_t c0 = 0; c0 < k; c0 += ULAB_SCIPY_LINALG_BLOCK_SIZE) {
+        size_t c1 = c0 + ULAB_SCIPY_LINALG_BLOCK_SIZE < k ? c0 + ULAB_SCIPY_LINALG_BLOCK_SIZE : k;
+        for(size_t m = 0; m < n; m++) {
+            // in the lower triangular case, the rows are solved from the top, otherwise, from the bottom
+            size_t i = lower ? m : n - 1 - m;
+            uint8_t *A_row = (uint8_t *)A->array + i * row_stride;
+            mp_float_t *xi = x_arr + i * k;
+            size_t j0 = lower ? 0 : i + 1;
+            size_t j1 = lower ? i : n;
+            for(size_t j = j0; j < j1; j++) {
+                mp_float_t a = get_A_ele(A_row + j * col_stride);
+                mp_float_t *xj = x_arr + j * k;
+                for(size_t c = c0; c < c1; c++) {
+                    xi[c] -= a * xj[c];
+                }
+            }
+            mp_float_t diagonal = get_A_ele(A_row + i * col_stride);
+            for(size_t c = c0; c < c1; c++) {
+                xi[c] /= diagonal;
+            }
+        }
+    }
+}
+
+//| def solve_triangular(
+//|     A: ulab.numpy.ndarray,
+//|     b: ulab.numpy.ndarray,
+//|     lower: bool,
+//|     *,
+//|     out: Optional[ulab.numpy.ndarray] = None,
+//|     overwrite_b: bool = False
+//| ) -> ulab.numpy.ndarray:
 //|    """
 //|    :param ~ulab.numpy.ndarray A: a matrix
-//|    :param ~ulab.numpy.ndarray b: a vector
+//|    :param ~ulab.numpy.ndarray b: a vector, or a matrix, whose columns are the right-hand sides
 //|    :param ~bool lower: if true, use only data contained in lower triangle of A, else use upper triangle of A
+//|    :param ~ulab.numpy.ndarray out: a dense float array of the shape of b, into which the solution is written
+//|    :param ~bool overwrite_b: if true, and b is a dense float array, the solution is written into b
 //|    :return: solution to the system A x = b. Shape of return matches b
 //|    :raises TypeError: if A and b are not of type ndarray and are not dense
 //|    :raises ValueError: if A is a singular matrix
@@ -47,12 +127,12 @@
 
 static mp_obj_t solve_triangular(size_t n_args, const mp_obj_t *pos_args, mp_map_t *kw_args) {
 
-    size_t i, j;
-
     static const mp_arg_t allowed_args[] = {
         { MP_QSTR_, MP_ARG_REQUIRED | MP_ARG_OBJ, { .u_rom_obj = MP_ROM_NONE} } ,
         { MP_QSTR_, MP_ARG_REQUIRED | MP_ARG_OBJ, { .u_rom_obj = MP_ROM_NONE} } ,
         { MP_QSTR_lower, MP_ARG_OBJ, { .u_rom_obj = MP_ROM_TRUE } },
+        { MP_QSTR_out, MP_ARG_KW_ONLY | MP_ARG_OBJ, { .u_rom_obj = MP_ROM_NONE } },
+        { MP_QSTR_overwrite_b, MP_ARG_KW_ONLY | MP_ARG_OBJ, { .u_rom_obj = MP_ROM_FALSE } },
     };
 
     mp_arg_val_t args[MP_ARRAY_SIZE(allowed_args)];
@@ -69,88 +149,40 @@ static mp_obj_t solve_triangular(size_t n_args, const mp_obj_t *pos_args, mp_map
         mp_raise_TypeError(MP_ERROR_TEXT("input must be a dense ndarray"));
     }
 
-    size_t A_rows = A->shape[ULAB_MAX_DIMS - 2];
-    size_t A_cols = A->shape[ULAB_MAX_DIMS - 1];
-
-    uint8_t *A_arr = (uint8_t *)A->array;
-    uint8_t *b_arr = (uint8_t *)b->array;
+    COMPLEX_DTYPE_NOT_IMPLEMENTED(A->dtype)
+    COMPLEX_DTYPE_NOT_IMPLEMENTED(b->dtype)
 
     mp_float_t (*get_A_ele)(void *) = ndarray_get_float_function(A->dtype);
-    mp_float_t (*get_b_ele)(void *) = ndarray_get_float_function(b->dtype);
-
-    uint8_t *temp_A = A_arr;
+    uint8_t *A_arr = (uint8_t *)A->array;
 
     // check if input matrix A is singular
-    for (i = 0; i < A_rows; i++) {
+    for (size_t i = 0; i < A->shape[ULAB_MAX_DIMS - 2]; i++) {
         if (MICROPY_FLOAT_C_FUN(fabs)(get_A_ele(A_arr)) < LINALG_EPSILON)
             mp_raise_ValueError(MP_ERROR_TEXT("input matrix is singular"));
         A_arr += A->strides[ULAB_MAX_DIMS - 2];
         A_arr += A->strides[ULAB_MAX_DIMS - 1];
     }
 
-    A_arr = temp_A;
-
-    ndarray_obj_t *x = ndarray_new_dense_ndarray(b->ndim, b->shape, NDARRAY_FLOAT);
-    mp_float_t *x_arr = (mp_float_t *)x->array;
-
-    if (mp_obj_is_true(args[2].u_obj)) {
-        // Solve the lower triangular matrix by iterating each row of A.
-        // Start by finding the first unknown using the first row.
-        // On finding this unknown, find the second unknown using the second row.
-        // Continue the same till the last unknown is found using the last row.
-
-        for (i = 0; i < A_rows; i++) {
-            mp_float_t sum = 0.0;
-            for (j = 0; j < i; j++) {
-                sum += (get_A_ele(A_arr) * (*x_arr++));
-                A_arr += A->strides[ULAB_MAX_DIMS - 1];
-            }
-
-            sum = (get_b_ele(b_arr) - sum) / (get_A_ele(A_arr));
-            *x_arr = sum;
-
-            x_arr -= j;
-            A_arr -= A->strides[ULAB_MAX_DIMS - 1] * j;
-            A_arr += A->strides[ULAB_MAX_DIMS - 2];
-            b_arr += b->strides[ULAB_MAX_DIMS - 1];
-        }
-    } else {
-        // Solve the upper triangular matrix by iterating each row of A.
-        // Start by finding the last unknown using the last row.
-        // On finding this unknown, find the last-but-one unknown using the last-but-one row.
-        // Continue the same till the first unknown is found using the first row.
-
-        A_arr += (A->strides[ULAB_MAX_DIMS - 2] * A_rows);
-        b_arr += (b->strides[ULAB_MAX_DIMS - 1] * A_cols);
-        x_arr += A_cols;
-
-        for (i = A_rows - 1; i < A_rows; i--) {
-            mp_float_t sum = 0.0;
-            for (j = i + 1; j < A_cols; j++) {
-                sum += (get_A_ele(A_arr) * (*x_arr++));
-                A_arr += A->strides[ULAB_MAX_DIMS - 1];
-            }
-
-            x_arr -= (j - i);
-            A_arr -= (A->strides[ULAB_MAX_DIMS - 1] * (j - i));
-            b_arr -= b->strides[ULAB_MAX_DIMS - 1];
-
-            sum = (get_b_ele(b_arr) - sum) / get_A_ele(A_arr);
-            *x_arr = sum;
-
-            A_arr -= A->strides[ULAB_MAX_DIMS - 2];
-        }
-    }
+    ndarray_obj_t *x = linalg_prepare_rhs(A, b, args[3].u_obj, mp_obj_is_true(args[4].u_obj));
+    linalg_triangular_substitution(A, x, mp_obj_is_true(args[2].u_obj), false);
 
     return MP_OBJ_FROM_PTR(x);
 }
 
 MP_DEFINE_CONST_FUN_OBJ_KW(linalg_solve_triangular_obj, 2, solve_triangular);
 
-//| def cho_solve(L: ulab.numpy.ndarray, b: ulab.numpy.ndarray) -> ulab.numpy.ndarray:
+//| def cho_solve(
+//|     L: ulab.numpy.ndarray,
+//|     b: ulab.numpy.ndarray,
+//|     *,
+//|     out: Optional[ulab.numpy.ndarray] = None,
+//|     overwrite_b: bool = False
+//| ) -> ulab.numpy.ndarray:
 //|    """
 //|    :param ~ulab.numpy.ndarray L: the lower triangular, Cholesky factorization of A
-//|    :param ~ulab.numpy.ndarray b: right-hand-side vector b
+//|    :param ~ulab.numpy.ndarray b: right-hand-side vector b, or a matrix, whose columns are the right-hand sides
+//|    :param ~ulab.numpy.ndarray out: a dense float array of the shape of b, into which the solution is written
+//|    :param ~bool overwrite_b: if true, and b is a dense float array, the solution is written into b
 //|    :return: solution to the system A x = b. Shape of return matches b
 //|    :raises TypeError: if L and b are not of type ndarray and are not dense
 //|
@@ -158,102 +190,42 @@ MP_DEFINE_CONST_FUN_OBJ_KW(linalg_solve_triangular_obj, 2, solve_triangular);
 //|    ...
 //|
 
-static mp_obj_t cho_solve(mp_obj_t _L, mp_obj_t _b) {
+static mp_obj_t cho_solve(size_t n_args, const mp_obj_t *pos_args, mp_map_t *kw_args) {
+
+    static const mp_arg_t allowed_args[] = {
+        { MP_QSTR_, MP_ARG_REQUIRED | MP_ARG_OBJ, { .u_rom_obj = MP_ROM_NONE} } ,
+        { MP_QSTR_, MP_ARG_REQUIRED | MP_ARG_OBJ, { .u_rom_obj = MP_ROM_NONE} } ,
+        { MP_QSTR_out, MP_ARG_KW_ONLY | MP_ARG_OBJ, { .u_rom_obj = MP_ROM_NONE } },
+        { MP_QSTR_overwrite_b, MP_ARG_KW_ONLY | MP_ARG_OBJ, { .u_rom_obj = MP_ROM_FALSE } },
+    };
+
+    mp_arg_val_t args[MP_ARRAY_SIZE(allowed_args)];
+    mp_arg_parse_all(n_args, pos_args, kw_args, MP_ARRAY_SIZE(allowed_args), allowed_args, args);
 
-    if(!mp_obj_is_type(_L, &ulab_ndarray_type) || !mp_obj_is_type(_b, &ulab_ndarray_type)) {
+    if(!mp_obj_is_type(args[0].u_obj, &ulab_ndarray_type) || !mp_obj_is_type(args[1].u_obj, &ulab_ndarray_type)) {
         mp_raise_TypeError(MP_ERROR_TEXT("first two arguments must be ndarrays"));
     }
 
-    ndarray_obj_t *L = MP_OBJ_TO_PTR(_L);
-    ndarray_obj_t *b = MP_OBJ_TO_PTR(_b);
+    ndarray_obj_t *L = MP_OBJ_TO_PTR(args[0].u_obj);
+    ndarray_obj_t *b = MP_OBJ_TO_PTR(args[1].u_obj);
 
     if(!ndarray_is_dense(L) || !ndarray_is_dense(b)) {
         mp_raise_TypeError(MP_ERROR_TEXT("input must be a dense ndarray"));
     }
 
-    mp_float_t (*get_L_ele)(void *) = ndarray_get_float_function(L->dtype);
-    mp_float_t (*get_b_ele)(void *) = ndarray_get_float_function(b->dtype);
-    void (*set_L_ele)(void *, mp_float_t) = ndarray_set_float_function(L->dtype);
-
-    size_t L_rows = L->shape[ULAB_MAX_DIMS - 2];
-    size_t L_cols = L->shape[ULAB_MAX_DIMS - 1];
+    COMPLEX_DTYPE_NOT_IMPLEMENTED(L->dtype)
+    COMPLEX_DTYPE_NOT_IMPLEMENTED(b->dtype)
 
-    // Obtain transpose of the input matrix L in L_t
-    size_t L_t_shape[ULAB_MAX_DIMS];
-    size_t L_t_rows = L_t_shape[ULAB_MAX_DIMS - 2] = L_cols;
-    size_t L_t_cols = L_t_shape[ULAB_MAX_DIMS - 1] = L_rows;
-    ndarray_obj_t *L_t = ndarray_new_dense_ndarray(L->ndim, L_t_shape, L->dtype);
-
-    uint8_t *L_arr = (uint8_t *)L->array;
-    uint8_t *L_t_arr = (uint8_t *)L_t->array;
-    uint8_t *b_arr = (uint8_t *)b->array;
-
-    size_t i, j;
-
-    uint8_t *L_ptr = L_arr;
-    uint8_t *L_t_ptr = L_t_arr;
-    for (i = 0; i < L_rows; i++) {
-        for (j = 0; j < L_cols; j++) {
-            set_L_ele(L_t_ptr, get_L_ele(L_ptr));
-            L_t_ptr += L_t->strides[ULAB_MAX_DIMS - 2];
-            L_ptr += L->strides[ULAB_MAX_DIMS - 1];
-        }
-
-        L_t_ptr -= j * L_t->strides[ULAB_MAX_DIMS - 2];
-        L_t_ptr += L_t->strides[ULAB_MAX_DIMS - 1];
-        L_ptr -= j * L->strides[ULAB_MAX_DIMS - 1];
-        L_ptr += L->strides[ULAB_MAX_DIMS - 2];
-    }
-
-    ndarray_obj_t *x = ndarray_new_dense_ndarray(b->ndim, b->shape, NDARRAY_FLOAT);
-    mp_float_t *x_arr = (mp_float_t *)x->array;
-
-    ndarray_obj_t *y = ndarray_new_dense_ndarray(b->ndim, b->shape, NDARRAY_FLOAT);
-    mp_float_t *y_arr = (mp_float_t *)y->array;
-
-    // solve L y = b to obtain y, where L_t x = y
-    for (i = 0; i < L_rows; i++) {
-        mp_float_t sum = 0.0;
-        for (j = 0; j < i; j++) {
-            sum += (get_L_ele(L_arr) * (*y_arr++));
-            L_arr += L->strides[ULAB_MAX_DIMS - 1];
-        }
-
-        sum = (get_b_ele(b_arr) - sum) / (get_L_ele(L_arr));
-        *y_arr = sum;
-
-        y_arr -= j;
-        L_arr -= L->strides[ULAB_MAX_DIMS - 1] * j;
-        L_arr += L->strides[ULAB_MAX_DIMS - 2];
-        b_arr += b->strides[ULAB_MAX_DIMS - 1];
-    }
-
-    // using y, solve L_t x = y to obtain x
-    L_t_arr += (L_t->strides[ULAB_MAX_DIMS - 2] * L_t_rows);
-    y_arr += L_t_cols;
-    x_arr += L_t_cols;
-
-    for (i = L_t_rows - 1; i < L_t_rows; i--) {
-        mp_float_t sum = 0.0;
-        for (j = i + 1; j < L_t_cols; j++) {
-            sum += (get_L_ele(L_t_arr) * (*x_arr++));
-            L_t_arr += L_t->strides[ULAB_MAX_DIMS - 1];
-        }
-
-        x_arr -= (j - i);
-        L_t_arr -= (L_t->strides[ULAB_MAX_DIMS - 1] * (j - i));
-        y_arr--;
-
-        sum = ((*y_arr) - sum) / get_L_ele(L_t_arr);
-        *x_arr = sum;
-
-        L_t_arr -= L_t->strides[ULAB_MAX_DIMS - 2];
-    }
+    ndarray_obj_t *x = linalg_prepare_rhs(L, b, args[2].u_obj, mp_obj_is_true(args[3].u_obj));
+    // solve L y = b to obtain y, and then, using y, solve L_t x = y to obtain x;
+    // the transpose of L is never formed, its elements are read from L directly
+    linalg_triangular_substitution(L, x, true, false);
+    linalg_triangular_substitution(L, x, false, true);
 
     return MP_OBJ_FROM_PTR(x);
 }
 
-MP_DEFINE_CONST_FUN_OBJ_2(linalg_cho_solve_obj, cho_solve);
+MP_DEFINE_CONST_FUN_OBJ_KW(linalg_cho_solve_obj, 2, cho_solve);
 
 #endif
 
@@ -13,6 +13,7 @@
 */
 
 #include <math.h>
+#include <string.h>
 #include "py/obj.h"
 #include "py/runtime.h"
 #include "py/misc.h"
@@ -20,6 +21,8 @@
 #include "../../ndarray.h"
 #include "../../ulab.h"
 #include "../../ulab_tools.h"
+#include "../../numpy/carray/carray_tools.h"
+#include "../../numpy/linalg/linalg_tools.h"
 #include "optimize.h"
 
 ULAB_DEFINE_FLOAT_CONST(xtolerance, MICROPY_FLOAT_CONST(2.4e-7), 0x3480d959UL, 0x3e901b2b29a4692bULL);
@@ -33,7 +36,129 @@ static mp_float_t optimize_python_call(const mp_obj_type_t *type, mp_obj_t fun,
     return mp_obj_get_float(MP_OBJ_TYPE_GET_SLOT(type, call)(fun, nparams+1, 0, fargs));
 }
 
+#if ULAB_SCIPY_OPTIMIZE_HAS_BATCHED_ROOTS && (ULAB_SCIPY_OPTIMIZE_HAS_BISECT || ULAB_SCIPY_OPTIMIZE_HAS_NEWTON)
+static void optimize_python_call_batch(const mp_obj_type_t *type, mp_obj_t fun, ndarray_obj_t *x, mp_float_t *y) {
+    // Helper function for calculating the values of f at all elements of the dense float array x
+    // in a single call. The python function must return an ndarray, or an iterable of the same length as x,
+    // or a scalar. The function values are written into y.
+    mp_obj_t fargs[1] = { MP_OBJ_FROM_PTR(x) };
+    mp_obj_t result = MP_OBJ_TYPE_GET_SLOT(type, call)(fun, 1, 0, fargs);
+
+    if(mp_obj_is_type(result, &ulab_ndarray_type)) {
+        ndarray_obj_t *ndarray = MP_OBJ_TO_PTR(result);
+        COMPLEX_DTYPE_NOT_IMPLEMENTED(ndarray->dtype)
+        if(ndarray->len != x->len) {
+            mp_raise_ValueError(MP_ERROR_TEXT("function must return an array of the same length as its input"));
+        }
+        mp_float_t (*func)(void *) = ndarray_get_float_function(ndarray->dtype);
+        uint8_t *array = (uint8_t *)ndarray->array;
+        ITERATOR_HEAD();
+            *y++ = func(array);
+        ITERATOR_TAIL(ndarray, array);
+    } else if(mp_obj_is_int(result) || mp_obj_is_float(result)) {
+        mp_float_t value = mp_obj_get_float(result);
+        for(size_t i = 0; i < x->len; i++) {
+            *y++ = value;
+        }
+    } else {
+        if((size_t)mp_obj_get_int(mp_obj_len(result)) != x->len) {
+            mp_raise_ValueError(MP_ERROR_TEXT("function must return an array of the same length as its input"));
+        }
+        fill_array_iterable(y, result);
+    }
+}
+
+static void optimize_fill_batch(mp_float_t *y, mp_obj_t obj, ndarray_obj_t *x) {
+    // Copies the values of obj into y; obj is either a scalar, or an ndarray of the same shape as x
+    if(mp_obj_is_type(obj, &ulab_ndarray_type)) {
+        ndarray_obj_t *ndarray = MP_OBJ_TO_PTR(obj);
+        COMPLEX_DTYPE_NOT_IMPLEMENTED(ndarray->dtype)
+        for(uint8_t i = 0; i < ULAB_MAX_DIMS; i++) {
+            if(ndarray->shape[i] != x->shape[i]) {
+                mp_raise_ValueError(MP_ERROR_TEXT("operands could not be broadcast together"));
+            }
+        }
+        mp_float_t (*func)(void *) = ndarray_get_float_function(ndarray->dtype);
+        uint8_t *array = (uint8_t *)ndarray->array;
+        ITERATOR_HEAD();
+            *y++ = func(array);
+        ITERATOR_TAIL(ndarray, array);
+    } else {
+        mp_float_t value = mp_obj_get_float(obj);
+        for(size_t i = 0; i < x->len; i++) {
+            *y++ = value;
+        }
+    }
+}
+#endif /* ULAB_SCIPY_OPTIMIZE_HAS_BATCHED_ROOTS */
+
 #if ULAB_SCIPY_OPTIMIZE_HAS_BISECT
+#if ULAB_SCIPY_OPTIMIZE_HAS_BATCHED_ROOTS
+static mp_obj_t optimize_bisect_batch(const mp_obj_type_t *type, mp_obj_t fun, ndarray_obj_t *source, mp_obj_t a_obj, mp_obj_t b_obj, mp_float_t xtol, mp_int_t maxiter) {
+    // Solves independent problems on the intervals defined by the elements of a, and b.
+    // The function is called with a float array of the shape of source once per iteration,
+    // and elements that have already converged are left untouched.
+    ndarray_obj_t *x = ndarray_new_dense_ndarray(source->ndim, source->shape, NDARRAY_FLOAT);
+    ndarray_obj_t *results = ndarray_new_dense_ndarray(source->ndim, source->shape, NDARRAY_FLOAT);
+    size_t len = x->len;
+
+    mp_float_t *xarray = (mp_float_t *)x->array;
+    mp_float_t *rtb = (mp_float_t *)results->array;
+    mp_float_t *dx = m_new(mp_float_t, len);
+    mp_float_t *fx = m_new(mp_float_t, len);
+    mp_float_t *b = m_new(mp_float_t, len);
+    uint8_t *active = m_new(uint8_t, len);
+
+    optimize_fill_batch(xarray, a_obj, x);
+    optimize_fill_batch(b, b_obj, x);
+    optimize_python_call_batch(type, fun, x, fx);
+    for(size_t i = 0; i < len; i++) {
+        rtb[i] = xarray[i];
+        xarray[i] = b[i];
+    }
+    optimize_python_call_batch(type, fun, x, dx);
+    for(size_t i = 0; i < len; i++) {
+        // fx holds f(a), dx holds f(b)
+        if(fx[i] * dx[i] > 0) {
+            mp_raise_ValueError(MP_ERROR_TEXT("function has the same sign at the ends of interval"));
+        }
+        mp_float_t a = rtb[i];
+        rtb[i] = fx[i] < MICROPY_FLOAT_CONST(0.0) ? a : b[i];
+        dx[i] = fx[i] < MICROPY_FLOAT_CONST(0.0) ? b[i] - a : a - b[i];
+        active[i] = 1;
+    }
+    m_del(mp_float_t, b, len);
+
+    size_t remaining = len;
+    for(mp_int_t iter = 0; (iter < maxiter) && (remaining > 0); iter++) {
+        for(size_t i = 0; i < len; i++) {
+            if(active[i]) {
+                dx[i] *= MICROPY_FLOAT_CONST(0.5);
+                xarray[i] = rtb[i] + dx[i];
+            } else {
+                xarray[i] = rtb[i];
+            }
+        }
+        optimize_python_call_batch(type, fun, x, fx);
+        for(size_t i = 0; i < len; i++) {
+            if(active[i]) {
+                if(fx[i] < MICROPY_FLOAT_CONST(0.0)) {
+                    rtb[i] = xarray[i];
+                }
+                if(MICROPY_FLOAT_C_FUN(fabs)(dx[i]) < xtol) {
+                    active[i] = 0;
+                    remaining--;
+                }
+            }
+        }
+    }
+    m_del(mp_float_t, dx, len);
+    m_del(mp_float_t, fx, len);
+    m_del(uint8_t, active, len);
+    return MP_OBJ_FROM_PTR(results);
+}
+#endif /* ULAB_SCIPY_OPTIMIZE_HAS_BATCHED_ROOTS */
+
 //| def bisect(
 //|     fun: Callable[[float], float],
 //|     a: float,
@@ -51,7 +176,12 @@ static mp_float_t optimize_python_call(const mp_obj_type_t *type, mp_obj_t fun,
 //|
 //|     Find a solution (zero) of the function ``f(x)`` on the interval
 //|     (``a``..``b``) using the bisection method.  The result is accurate to within
-//|     ``xtol`` unless more than ``maxiter`` steps are required."""
+//|     ``xtol`` unless more than ``maxiter`` steps are required.
+//|
+//|     If ``a``, or ``b`` is an ndarray, or ``f(a)`` returns an ndarray, the independent
+//|     problems defined by the elements are solved at the same time, and an ndarray is returned.
+//|     In this case, ``f`` is called with an ndarray once per iteration, and must return an
+//|     ndarray of the same length."""
 //|     ...
 //|
 
@@ -74,21 +204,36 @@ static mp_obj_t optimize_bisect(size_t n_args, const mp_obj_t *pos_args, mp_map_
         mp_raise_TypeError(MP_ERROR_TEXT("first argument must be a function"));
     }
     mp_float_t xtol = mp_obj_get_float(args[3].u_obj);
+    if(args[4].u_int < 0) {
+        mp_raise_ValueError(MP_ERROR_TEXT("maxiter should be > 0"));
+    }
+    #if ULAB_SCIPY_OPTIMIZE_HAS_BATCHED_ROOTS
+    if(mp_obj_is_type(args[1].u_obj, &ulab_ndarray_type) || mp_obj_is_type(args[2].u_obj, &ulab_ndarray_type)) {
+        mp_obj_t source = mp_obj_is_type(args[1].u_obj, &ulab_ndarray_type) ? args[1].u_obj : args[2].u_obj;
+        return optimize_bisect_batch(type, fun, MP_OBJ_TO_PTR(source), args[1].u_obj, args[2].u_obj, xtol, args[4].u_int);
+    }
+    #endif
     mp_obj_t fargs[1];
     mp_float_t left, right;
     mp_float_t x_mid;
     mp_float_t a = mp_obj_get_float(args[1].u_obj);
     mp_float_t b = mp_obj_get_float(args[2].u_obj);
-    left = optimize_python_call(type, fun, a, fargs, 0);
+    fargs[0] = mp_obj_new_float(a);
+    mp_obj_t fa = MP_OBJ_TYPE_GET_SLOT(type, call)(fun, 1, 0, fargs);
+    #if ULAB_SCIPY_OPTIMIZE_HAS_BATCHED_ROOTS
+    if(mp_obj_is_type(fa, &ulab_ndarray_type)) {
+        // the bounds are scalars, but the function returns an array, e.g., because it
+        // depends on an array of parameters: the problems are then solved in a batch
+        return optimize_bisect_batch(type, fun, MP_OBJ_TO_PTR(fa), args[1].u_obj, args[2].u_obj, xtol, args[4].u_int);
+    }
+    #endif
+    left = mp_obj_get_float(fa);
     right = optimize_python_call(type, fun, b, fargs, 0);
     if(left * right > 0) {
         mp_raise_ValueError(MP_ERROR_TEXT("function has the same sign at the ends of interval"));
     }
     mp_float_t rtb = left < MICROPY_FLOAT_CONST(0.0) ? a : b;
     mp_float_t dx = left < MICROPY_FLOAT_CONST(0.0) ? b - a : a - b;
-    if(args[4].u_int < 0) {
-        mp_raise_ValueError(MP_ERROR_TEXT("maxiter should be > 0"));
-    }
     for(uint16_t i=0; i < args[4].u_int; i++) {
         dx *= MICROPY_FLOAT_CONST(0.5);
         x_mid = rtb + dx;
@@ -104,35 +249,79 @@ MP_DEFINE_CONST_FUN_OBJ_KW(optimize_bisect_obj, 3, optimize_bisect);
 #endif
 
 #if ULAB_SCIPY_OPTIMIZE_HAS_FMIN
+static mp_float_t optimize_fmin_call(const mp_obj_type_t *type, mp_obj_t fun, mp_obj_t *fargs, uint8_t nparams, ndarray_obj_t *x, mp_float_t *vertex, size_t n) {
+    // Evaluates f(x, *args) at vertex. The vertex is copied into the array x, which is re-used in all calls,
+    // even in the one-dimensional case, so that the argument does not have to be boxed in each call
+    memcpy(x->array, vertex, n * sizeof(mp_float_t));
+    fargs[0] = MP_OBJ_FROM_PTR(x);
+    mp_obj_t result = MP_OBJ_TYPE_GET_SLOT(type, call)(fun, nparams+1, 0, fargs);
+    if(mp_obj_is_type(result, &ulab_ndarray_type)) {
+        // a function of x[0] written with array arithmetic returns an array of length 1
+        ndarray_obj_t *ndarray = MP_OBJ_TO_PTR(result);
+        COMPLEX_DTYPE_NOT_IMPLEMENTED(ndarray->dtype)
+        if(ndarray->len != 1) {
+            mp_raise_ValueError(MP_ERROR_TEXT("function must return a scalar"));
+        }
+        return ndarray_get_float_value(ndarray->array, ndarray->dtype);
+    }
+    return mp_obj_get_float(result);
+}
+
+static void optimize_fmin_sort(mp_float_t *simplex, mp_float_t *fsim, mp_float_t *tmp, size_t n) {
+    // sorts the vertices by the function values (insertion sort, the simplex is nearly sorted)
+    for(size_t k=1; k <= n; k++) {
+        mp_float_t fk = fsim[k];
+        size_t j = k;
+        if(fsim[j-1] <= fk) continue;
+        memcpy(tmp, simplex + k * n, n * sizeof(mp_float_t));
+        while((j > 0) && (fsim[j-1] > fk)) {
+            fsim[j] = fsim[j-1];
+            memcpy(simplex + j * n, simplex + (j - 1) * n, n * sizeof(mp_float_t));
+            j--;
+        }
+        fsim[j] = fk;
+        memcpy(simplex + j * n, tmp, n * sizeof(mp_float_t));
+    }
+}
+
 //| def fmin(
-//|     fun: Callable[[float], float],
-//|     x0: float,
+//|     fun: Callable[..., float],
+//|     x0: Union[float, _ArrayLike],
 //|     *,
+//|     args: tuple = (),
 //|     xatol: float = 2.4e-7,
 //|     fatol: float = 2.4e-7,
-//|     maxiter: int = 200
-//| ) -> float:
+//|     maxiter: Optional[int] = None,
+//|     callback: Optional[Callable[[ulab.numpy.ndarray], None]] = None
+//| ) -> Union[float, ulab.numpy.ndarray]:
 //|     """
-//|     :param callable f: The function to bisect
-//|     :param float x0: The initial x value
-//|     :param float xatol: The absolute tolerance value
-//|     :param float fatol: The relative tolerance value
+//|     :param callable f: The function to minimise, ``f(x, *args)``
+//|     :param x0: The initial x value, a float, or an iterable in the multi-dimensional case
+//|     :param tuple args: Extra arguments passed to ``f``
+//|     :param float xatol: The absolute tolerance value in ``x``
+//|     :param float fatol: The absolute tolerance value in ``f(x)``
+//|     :param int maxiter: The maximum number of iterations to perform, 200 times the number of variables by default
+//|     :param callable callback: Called after each iteration with the current best ``x``
 //|
 //|     Find a minimum of the function ``f(x)`` using the downhill simplex method.
 //|     The located ``x`` is within ``fxtol`` of the actual minimum, and ``f(x)``
 //|     is within ``fatol`` of the actual minimum unless more than ``maxiter``
-//|     steps are requried."""
+//|     steps are requried. ``f`` is called with an ndarray, which is re-used in
+//|     all calls, and is of length 1, if ``x0`` is a float. The result is a float,
+//|     if ``x0`` is a float, and an ndarray otherwise."""
 //|     ...
 //|
 
 static mp_obj_t optimize_fmin(size_t n_args, const mp_obj_t *pos_args, mp_map_t *kw_args) {
-    // downhill simplex method in 1D
+    // downhill simplex method in n dimensions, following scipy's implementation of the Nelder-Mead algorithm
     static const mp_arg_t allowed_args[] = {
         { MP_QSTR_, MP_ARG_REQUIRED | MP_ARG_OBJ, {.u_rom_obj = MP_ROM_NONE } },
         { MP_QSTR_, MP_ARG_REQUIRED | MP_ARG_OBJ, {.u_rom_obj = MP_ROM_NONE } },
         { MP_QSTR_xatol, MP_ARG_KW_ONLY | MP_ARG_OBJ, {.u_rom_obj = ULAB_REFERENCE_FLOAT_CONST(xtolerance)} },
         { MP_QSTR_fatol, MP_ARG_KW_ONLY | MP_ARG_OBJ, {.u_rom_obj = ULAB_REFERENCE_FLOAT_CONST(xtolerance)} },
-        { MP_QSTR_maxiter, MP_ARG_KW_ONLY | MP_ARG_INT, {.u_int = 200} },
+        { MP_QSTR_maxiter, MP_ARG_KW_ONLY | MP_ARG_OBJ, {.u_rom_obj = MP_ROM_NONE} },
+        { MP_QSTR_args, MP_ARG_KW_ONLY | MP_ARG_OBJ, {.u_rom_obj = MP_ROM_NONE} },
+        { MP_QSTR_callback, MP_ARG_KW_ONLY | MP_ARG_OBJ, {.u_rom_obj = MP_ROM_NONE} },
     };
 
     mp_arg_val_t args[MP_ARRAY_SIZE(allowed_args)];
@@ -143,121 +332,294 @@ static mp_obj_t optimize_fmin(size_t n_args, const mp_obj_t *pos_args, mp_map_t
     if(!MP_OBJ_TYPE_HAS_SLOT(type, call)) {
         mp_raise_TypeError(MP_ERROR_TEXT("first argument must be a function"));
     }
+    mp_obj_t callback = args[6].u_obj;
+    if((callback != mp_const_none) && !MP_OBJ_TYPE_HAS_SLOT(mp_obj_get_type(callback), call)) {
+        mp_raise_TypeError(MP_ERROR_TEXT("callback must be a function"));
+    }
 
     // parameters controlling convergence conditions
     mp_float_t xatol = mp_obj_get_float(args[2].u_obj);
     mp_float_t fatol = mp_obj_get_float(args[3].u_obj);
-    if(args[4].u_int <= 0) {
+
+    // the function is always called with an ndarray, which is of length 1, if the initial value is a scalar
+    mp_obj_t x0_obj = args[1].u_obj;
+    bool scalar = mp_obj_is_int(x0_obj) || mp_obj_is_float(x0_obj);
+    size_t n = 1;
+    if(!scalar) {
+        if(!ndarray_object_is_array_like(x0_obj)) {
+            mp_raise_TypeError(MP_ERROR_TEXT("initial values must be a float, or an iterable"));
+        }
+        n = (size_t)mp_obj_get_int(mp_obj_len_maybe(x0_obj));
+        if(n == 0) {
+            mp_raise_ValueError(MP_ERROR_TEXT("initial values must not be empty"));
+        }
+    }
+    ndarray_obj_t *x = ndarray_new_linear_array(n, NDARRAY_FLOAT);
+
+    mp_int_t maxiter = 200 * n;
+    if(args[4].u_obj != mp_const_none) {
+        maxiter = mp_obj_get_int(args[4].u_obj);
+    }
+    if(maxiter <= 0) {
         mp_raise_ValueError(MP_ERROR_TEXT("maxiter must be > 0"));
     }
-    uint16_t maxiter = (uint16_t)args[4].u_int;
 
-    mp_float_t x0 = mp_obj_get_float(args[1].u_obj);
-    mp_float_t x1 = MICROPY_FLOAT_C_FUN(fabs)(x0) > OPTIMIZE_EPSILON ? (MICROPY_FLOAT_CONST(1.0) + OPTIMIZE_NONZDELTA) * x0 : OPTIMIZE_ZDELTA;
-    mp_obj_t fargs[1];
-    mp_float_t f0 = optimize_python_call(type, fun, x0, fargs, 0);
-    mp_float_t f1 = optimize_python_call(type, fun, x1, fargs, 0);
-    if(f1 < f0) {
-        SWAP(mp_float_t, x0, x1);
-        SWAP(mp_float_t, f0, f1);
+    // extra arguments of the function
+    size_t nextra = 0;
+    mp_obj_t *extra = NULL;
+    if(args[5].u_obj != mp_const_none) {
+        mp_obj_get_array(args[5].u_obj, &nextra, &extra);
+    }
+    if(nextra > 254) {
+        mp_raise_ValueError(MP_ERROR_TEXT("too many arguments"));
+    }
+    mp_obj_t *fargs = m_new(mp_obj_t, nextra+1);
+    for(size_t i=0; i < nextra; i++) {
+        fargs[i+1] = extra[i];
     }
-    for(uint16_t i=0; i < maxiter; i++) {
-        uint8_t shrink = 0;
-        f0 = optimize_python_call(type, fun, x0, fargs, 0);
-        f1 = optimize_python_call(type, fun, x1, fargs, 0);
+
+    // The simplex (n+1 vertices of length n), the function values at the vertices, the centroid,
+    // and the trial points are all held in a single workspace that is not re-allocated in the iteration
+    size_t wlen = (n + 1) * n + (n + 1) + 4 * n;
+    mp_float_t *workspace = m_new(mp_float_t, wlen);
+    mp_float_t *simplex = workspace;
+    mp_float_t *fsim = simplex + (n + 1) * n;
+    mp_float_t *xbar = fsim + (n + 1);
+    mp_float_t *xr = xbar + n;
+    mp_float_t *xe = xr + n;
+    mp_float_t *tmp = xe + n;
+
+    if(scalar) {
+        simplex[0] = mp_obj_get_float(x0_obj);
+    } else {
+        fill_array_iterable(simplex, x0_obj);
+    }
+    // the initial simplex
+    for(size_t k=0; k < n; k++) {
+        mp_float_t *vertex = simplex + (k + 1) * n;
+        memcpy(vertex, simplex, n * sizeof(mp_float_t));
+        vertex[k] = vertex[k] != MICROPY_FLOAT_CONST(0.0) ? (MICROPY_FLOAT_CONST(1.0) + OPTIMIZE_NONZDELTA) * vertex[k] : OPTIMIZE_ZDELTA;
+    }
+    for(size_t k=0; k <= n; k++) {
+        fsim[k] = optimize_fmin_call(type, fun, fargs, nextra, x, simplex + k * n, n);
+    }
+    optimize_fmin_sort(simplex, fsim, tmp, n);
+
+    for(mp_int_t iter=0; iter < maxiter; iter++) {
+        // convergence conditions
+        mp_float_t dx = MICROPY_FLOAT_CONST(0.0), df = MICROPY_FLOAT_CONST(0.0);
+        for(size_t k=1; k <= n; k++) {
+            for(size_t i=0; i < n; i++) {
+                mp_float_t d = MICROPY_FLOAT_C_FUN(fabs)(simplex[k * n + i] - simplex[i]);
+                if(d > dx) dx = d;
+            }
+            if(MICROPY_FLOAT_C_FUN(fabs)(fsim[k] - fsim[0]) > df) {
+                df = MICROPY_FLOAT_C_FUN(fabs)(fsim[k] - fsim[0]);
+            }
+        }
+        if((dx <= xatol) && (df <= fatol)) {
+            break;
+        }
+
+        // the centroid of all vertices but the worst one
+        mp_float_t *worst = simplex + n * n;
+        for(size_t i=0; i < n; i++) {
+            xbar[i] = MICROPY_FLOAT_CONST(0.0);
+            for(size_t k=0; k < n; k++) {
+                xbar[i] += simplex[k * n + i];
+            }
+            xbar[i] /= n;
+        }
 
         // reflection
-        mp_float_t xr = (MICROPY_FLOAT_CONST(1.0) + OPTIMIZE_ALPHA) * x0 - OPTIMIZE_ALPHA * x1;
-        mp_float_t fr = optimize_python_call(type, fun, xr, fargs, 0);
-        if(fr < f0) { // expansion
-            mp_float_t xe = (1 + OPTIMIZE_ALPHA * OPTIMIZE_BETA) * x0 - OPTIMIZE_ALPHA * OPTIMIZE_BETA * x1;
-            mp_float_t fe = optimize_python_call(type, fun, xe, fargs, 0);
-            if(fe < fr) {
-                x1 = xe;
-                f1 = fe;
+        for(size_t i=0; i < n; i++) {
+            xr[i] = (MICROPY_FLOAT_CONST(1.0) + OPTIMIZE_ALPHA) * xbar[i] - OPTIMIZE_ALPHA * worst[i];
+        }
+        mp_float_t fxr = optimize_fmin_call(type, fun, fargs, nextra, x, xr, n);
+        uint8_t shrink = 0;
+        if(fxr < fsim[0]) { // expansion
+            for(size_t i=0; i < n; i++) {
+                xe[i] = (MICROPY_FLOAT_CONST(1.0) + OPTIMIZE_ALPHA * OPTIMIZE_BETA) * xbar[i] - OPTIMIZE_ALPHA * OPTIMIZE_BETA * worst[i];
+            }
+            mp_float_t fxe = optimize_fmin_call(type, fun, fargs, nextra, x, xe, n);
+            if(fxe < fxr) {
+                memcpy(worst, xe, n * sizeof(mp_float_t));
+                fsim[n] = fxe;
             } else {
-                x1 = xr;
-                f1 = fr;
+                memcpy(worst, xr, n * sizeof(mp_float_t));
+                fsim[n] = fxr;
             }
-        } else {
-            if(fr < f1) { // contraction
-                mp_float_t xc = (1 + OPTIMIZE_GAMMA * OPTIMIZE_ALPHA) * x0 - OPTIMIZE_GAMMA * OPTIMIZE_ALPHA * x1;
-                mp_float_t fc = optimize_python_call(type, fun, xc, fargs, 0);
-                if(fc < fr) {
-                    x1 = xc;
-                    f1 = fc;
-                } else {
-                    shrink = 1;
-                }
-            } else { // inside contraction
-                mp_float_t xc = (MICROPY_FLOAT_CONST(1.0) - OPTIMIZE_GAMMA) * x0 + OPTIMIZE_GAMMA * x1;
-                mp_float_t fc = optimize_python_call(type, fun, xc, fargs, 0);
-                if(fc < f1) {
-                    x1 = xc;
-                    f1 = fc;
-                } else {
-                    shrink = 1;
-                }
+        } else if(fxr < fsim[n-1]) {
+            memcpy(worst, xr, n * sizeof(mp_float_t));
+            fsim[n] = fxr;
+        } else if(fxr < fsim[n]) { // contraction
+            for(size_t i=0; i < n; i++) {
+                xe[i] = (MICROPY_FLOAT_CONST(1.0) + OPTIMIZE_GAMMA * OPTIMIZE_ALPHA) * xbar[i] - OPTIMIZE_GAMMA * OPTIMIZE_ALPHA * worst[i];
             }
-            if(shrink == 1) {
-                x1 = x0 + OPTIMIZE_DELTA * (x1 - x0);
-                f1 = optimize_python_call(type, fun, x1, fargs, 0);
+            mp_float_t fxc = optimize_fmin_call(type, fun, fargs, nextra, x, xe, n);
+            if(fxc <= fxr) {
+                memcpy(worst, xe, n * sizeof(mp_float_t));
+                fsim[n] = fxc;
+            } else {
+                shrink = 1;
             }
-            if((MICROPY_FLOAT_C_FUN(fabs)(f1 - f0) < fatol) ||
-                (MICROPY_FLOAT_C_FUN(fabs)(x1 - x0) < xatol)) {
-                break;
+        } else { // inside contraction
+            for(size_t i=0; i < n; i++) {
+                xe[i] = (MICROPY_FLOAT_CONST(1.0) - OPTIMIZE_GAMMA) * xbar[i] + OPTIMIZE_GAMMA * worst[i];
             }
-            if(f1 < f0) {
-                SWAP(mp_float_t, x0, x1);
-                SWAP(mp_float_t, f0, f1);
+            mp_float_t fxc = optimize_fmin_call(type, fun, fargs, nextra, x, xe, n);
+            if(fxc < fsim[n]) {
+                memcpy(worst, xe, n * sizeof(mp_float_t));
+                fsim[n] = fxc;
+            } else {
+                shrink = 1;
             }
         }
+        if(shrink == 1) {
+            for(size_t k=1; k <= n; k++) {
+                mp_float_t *vertex = simplex + k * n;
+                for(size_t i=0; i < n; i++) {
+                    vertex[i] = simplex[i] + OPTIMIZE_DELTA * (vertex[i] - simplex[i]);
+                }
+                fsim[k] = optimize_fmin_call(type, fun, fargs, nextra, x, vertex, n);
+            }
+        }
+        optimize_fmin_sort(simplex, fsim, tmp, n);
+        if(callback != mp_const_none) {
+            memcpy(x->array, simplex, n * sizeof(mp_float_t));
+            mp_call_function_1(callback, MP_OBJ_FROM_PTR(x));
+        }
     }
-    return mp_obj_new_float(x0);
+
+    mp_obj_t result;
+    if(scalar) {
+        result = mp_obj_new_float(simplex[0]);
+    } else {
+        // x might have been stored by the callback, so the result is a fresh array
+        ndarray_obj_t *results = ndarray_new_linear_array(n, NDARRAY_FLOAT);
+        memcpy(results->array, simplex, n * sizeof(mp_float_t));
+        result = MP_OBJ_FROM_PTR(results);
+    }
+    m_del(mp_float_t, workspace, wlen);
+    m_del(mp_obj_t, fargs, nextra+1);
+    return result;
 }
 
 MP_DEFINE_CONST_FUN_OBJ_KW(optimize_fmin_obj, 2, optimize_fmin);
 #endif
 
 #if ULAB_SCIPY_OPTIMIZE_HAS_CURVE_FIT
-static void optimize_jacobi(const mp_obj_type_t *type, mp_obj_t fun, mp_float_t *x, mp_float_t *y, uint16_t len, mp_float_t *params, uint8_t nparams, mp_float_t *jacobi, mp_float_t *grad) {
-    /* Calculates the Jacobian and the gradient of the cost function
+static void optimize_model_call(const mp_obj_type_t *type, mp_obj_t fun, mp_obj_t *fargs, uint8_t nparams, mp_float_t *params, size_t len, mp_float_t *f) {
+    // Evaluates f(x, a1, a2, ...) over the whole x array, which must be stored in fargs[0], in a single call
+    for(uint8_t p=0; p < nparams; p++) {
+        fargs[p+1] = mp_obj_new_float(params[p]);
+    }
+    mp_obj_t result = MP_OBJ_TYPE_GET_SLOT(type, call)(fun, nparams+1, 0, fargs);
+    if(mp_obj_is_type(result, &ulab_ndarray_type)) {
+        // read the values directly, instead of iterating over the array, which would box each element
+        ndarray_obj_t *ndarray = MP_OBJ_TO_PTR(result);
+        COMPLEX_DTYPE_NOT_IMPLEMENTED(ndarray->dtype)
+        if(ndarray->len != len) {
+            mp_raise_ValueError(MP_ERROR_TEXT("function must return an array of the same length as the data"));
+        }
+        mp_float_t (*func)(void *) = ndarray_get_float_function(ndarray->dtype);
+        uint8_t *array = (uint8_t *)ndarray->array;
+        ITERATOR_HEAD();
+            *f++ = func(array);
+        ITERATOR_TAIL(ndarray, array);
+        return;
+    }
+    if(!ndarray_object_is_array_like(result) || ((size_t)mp_obj_get_int(mp_obj_len_maybe(result)) != len)) {
+        mp_raise_ValueError(MP_ERROR_TEXT("function must return an array of the same length as the data"));
+    }
+    fill_array_iterable(f, result);
+}
+
+static void optimize_jacobi(const mp_obj_type_t *type, mp_obj_t fun, mp_obj_t jac, mp_obj_t *fargs, size_t len,
+                            mp_float_t *params, uint8_t nparams, mp_float_t *f0, mp_float_t *f1, mp_float_t *jacobi) {
+    /* Calculates the Jacobian of the model at params
      *
      * The entries in the Jacobian are
-     * J(m, n) = de_m/da_n,
-     *
-     * where
-     *
-     * e_m = (f(x_m, a1, a2, ...) - y_m)/sigma_m is the error at x_m,
+     * J(m, n) = df(x_m, a1, a2, ...)/da_n,
      *
-     * and
-     *
-     * a1, a2, ..., a_n are the free parameters
+     * where a1, a2, ..., a_n are the free parameters. If jac is not None, it is called with
+     * the same arguments as the model, and must return an array of shape (len, nparams),
+     * otherwise, the derivatives are approximated by forward differences: f0 must hold the
+     * model at params, and the model is evaluated once per parameter over the whole x array.
      */
-    mp_obj_t *fargs0 = m_new(mp_obj_t, lenp+1);
-    mp_obj_t *fargs1 = m_new(mp_obj_t, lenp+1);
-    for(uint8_t p=0; p < nparams; p++) {
-        fargs0[p+1] = mp_obj_new_float(params[p]);
-        fargs1[p+1] = mp_obj_new_float(params[p]);
+    if(jac != mp_const_none) {
+        for(uint8_t p=0; p < nparams; p++) {
+            fargs[p+1] = mp_obj_new_float(params[p]);
+        }
+        mp_obj_t result = MP_OBJ_TYPE_GET_SLOT(mp_obj_get_type(jac), call)(jac, nparams+1, 0, fargs);
+        if(!mp_obj_is_type(result, &ulab_ndarray_type)) {
+            mp_raise_TypeError(MP_ERROR_TEXT("jac must return an ndarray"));
+        }
+        ndarray_obj_t *ndarray = MP_OBJ_TO_PTR(result);
+        COMPLEX_DTYPE_NOT_IMPLEMENTED(ndarray->dtype)
+        if((ndarray->ndim != 2) || (ndarray->shape[ULAB_MAX_DIMS - 2] != len) || (ndarray->shape[ULAB_MAX_DIMS - 1] != nparams)) {
+            mp_raise_ValueError(MP_ERROR_TEXT("jac must return an array of shape (len(x), len(p0))"));
+        }
+        mp_float_t (*func)(void *) = ndarray_get_float_function(ndarray->dtype);
+        uint8_t *array = (uint8_t *)ndarray->array;
+        for(size_t i=0; i < len; i++) {
+            for(uint8_t p=0; p < nparams; p++) {
+                *jacobi++ = func(array);
+                array += ndarray->strides[ULAB_MAX_DIMS - 1];
+            }
+            array -= ndarray->strides[ULAB_MAX_DIMS - 1] * nparams;
+            array += ndarray->strides[ULAB_MAX_DIMS - 2];
+        }
+        return;
     }
     for(uint8_t p=0; p < nparams; p++) {
-        mp_float_t da = params[p] != MICROPY_FLOAT_CONST(0.0) ? (MICROPY_FLOAT_CONST(1.0) + APPROX_NONZDELTA) * params[p] : APPROX_ZDELTA;
-        fargs1[p+1] = mp_obj_new_float(params[p] + da);
-        grad[p] = MICROPY_FLOAT_CONST(0.0);
-        for(uint16_t i=0; i < len; i++) {
-            mp_float_t f0 = optimize_python_call(type, fun, x[i], fargs0, nparams);
-            mp_float_t f1 = optimize_python_call(type, fun, x[i], fargs1, nparams);
-            jacobi[i*nparamp+p] = (f1 - f0) / da;
-            grad[p] += (f0 - y[i]) * jacobi[i*nparamp+p];
+        mp_float_t a = params[p];
+        mp_float_t da = a != MICROPY_FLOAT_CONST(0.0) ? OPTIMIZE_EPS * MICROPY_FLOAT_C_FUN(fabs)(a) : OPTIMIZE_EPS;
+        params[p] = a + da;
+        optimize_model_call(type, fun, fargs, nparams, params, len, f1);
+        params[p] = a; // set back to the original value
+        for(size_t i=0; i < len; i++) {
+            jacobi[i*nparams+p] = (f1[i] - f0[i]) / da;
         }
-        fargs1[p+1] = fargs0[p+1]; // set back to the original value
     }
 }
 
-static void optimize_delta(mp_float_t *jacobi, mp_float_t *grad, uint16_t len, uint8_t nparams, mp_float_t lambda) {
-    //
+static mp_float_t optimize_cost(mp_float_t *f, mp_float_t *y, size_t len) {
+    mp_float_t cost = MICROPY_FLOAT_CONST(0.0);
+    for(size_t i=0; i < len; i++) {
+        cost += (f[i] - y[i]) * (f[i] - y[i]);
+    }
+    return cost;
 }
 
+//| def curve_fit(
+//|     fun: Callable[..., _ArrayLike],
+//|     xdata: _ArrayLike,
+//|     ydata: _ArrayLike,
+//|     p0: _ArrayLike,
+//|     *,
+//|     jac: Optional[Callable[..., ulab.numpy.ndarray]] = None,
+//|     xatol: float = 2.4e-7,
+//|     fatol: float = 2.4e-7,
+//|     maxiter: int = 100
+//| ) -> Tuple[ulab.numpy.ndarray, ulab.numpy.ndarray]:
+//|     """
+//|     :param callable f: The model function, ``f(x, *params)``
+//|     :param array xdata: The independent variable
+//|     :param array ydata: The dependent data
+//|     :param array p0: The initial values of the parameters
+//|     :param callable jac: The Jacobian of the model with respect to the parameters, ``jac(x, *params)``
+//|     :param float xatol: The absolute tolerance in the parameters
+//|     :param float fatol: The absolute tolerance in the sum of squared residuals
+//|     :param int maxiter: The maximum number of iterations to perform
+//|
+//|     Fit the parameters of ``f`` to the data with the Levenberg-Marquardt method.
+//|     ``f`` (and ``jac``) are called with the whole ``xdata`` array, and must return
+//|     an array of the same length (of shape ``(len(xdata), len(p0))`` in the case of ``jac``).
+//|     Returns the optimal parameters, and their estimated covariance."""
+//|     ...
+//|
+
 mp_obj_t optimize_curve_fit(size_t n_args, const mp_obj_t *pos_args, mp_map_t *kw_args) {
     // Levenberg-Marquardt non-linear fit
     // The implementation follows the introductory discussion in Mark Tanstrum's paper, https://arxiv.org/abs/1201.5885
@@ -266,9 +628,10 @@ mp_obj_t optimize_curve_fit(size_t n_args, const mp_obj_t *pos_args, mp_map_t *k
         { MP_QSTR_, MP_ARG_REQUIRED | MP_ARG_OBJ, {.u_rom_obj = MP_ROM_NONE } },
         { MP_QSTR_, MP_ARG_REQUIRED | MP_ARG_OBJ, {.u_rom_obj = MP_ROM_NONE } },
         { MP_QSTR_p0, MP_ARG_REQUIRED | MP_ARG_OBJ, {.u_rom_obj = MP_ROM_NONE } },
-        { MP_QSTR_xatol, MP_ARG_KW_ONLY | MP_ARG_OBJ, {.u_rom_obj = MP_ROM_PTR(&xtolerance)} },
-        { MP_QSTR_fatol, MP_ARG_KW_ONLY | MP_ARG_OBJ, {.u_rom_obj = MP_ROM_PTR(&xtolerance)} },
-        { MP_QSTR_maxiter, MP_ARG_KW_ONLY | MP_ARG_OBJ, {.u_rom_obj = MP_ROM_NONE} },
+        { MP_QSTR_jac, MP_ARG_KW_ONLY | MP_ARG_OBJ, {.u_rom_obj = MP_ROM_NONE } },
+        { MP_QSTR_xatol, MP_ARG_KW_ONLY | MP_ARG_OBJ, {.u_rom_obj = ULAB_REFERENCE_FLOAT_CONST(xtolerance)} },
+        { MP_QSTR_fatol, MP_ARG_KW_ONLY | MP_ARG_OBJ, {.u_rom_obj = ULAB_REFERENCE_FLOAT_CONST(xtolerance)} },
+        { MP_QSTR_maxiter, MP_ARG_KW_ONLY | MP_ARG_INT, {.u_int = 100} },
     };
 
     mp_arg_val_t args[MP_ARRAY_SIZE(allowed_args)];
@@ -279,6 +642,10 @@ mp_obj_t optimize_curve_fit(size_t n_args, const mp_obj_t *pos_args, mp_map_t *k
     if(!MP_OBJ_TYPE_HAS_SLOT(type, call)) {
         mp_raise_TypeError(MP_ERROR_TEXT("first argument must be a function"));
     }
+    mp_obj_t jac = args[4].u_obj;
+    if((jac != mp_const_none) && !MP_OBJ_TYPE_HAS_SLOT(mp_obj_get_type(jac), call)) {
+        mp_raise_TypeError(MP_ERROR_TEXT("jac must be a function"));
+    }
 
     mp_obj_t x_obj = args[1].u_obj;
     mp_obj_t y_obj = args[2].u_obj;
@@ -286,47 +653,210 @@ mp_obj_t optimize_curve_fit(size_t n_args, const mp_obj_t *pos_args, mp_map_t *k
     if(!ndarray_object_is_array_like(x_obj) || !ndarray_object_is_array_like(y_obj)) {
         mp_raise_TypeError(MP_ERROR_TEXT("data must be iterable"));
     }
-    if(!ndarray_object_is_nditerable(p0_obj)) {
+    if(!ndarray_object_is_array_like(p0_obj)) {
         mp_raise_TypeError(MP_ERROR_TEXT("initial values must be iterable"));
     }
     size_t len = (size_t)mp_obj_get_int(mp_obj_len_maybe(x_obj));
-    uint8_t lenp = (uint8_t)mp_obj_get_int(mp_obj_len_maybe(p0_obj));
-    if(len != (uint16_t)mp_obj_get_int(mp_obj_len_maybe(y_obj))) {
+    size_t lenp = (size_t)mp_obj_get_int(mp_obj_len_maybe(p0_obj));
+    if(len != (size_t)mp_obj_get_int(mp_obj_len_maybe(y_obj))) {
         mp_raise_ValueError(MP_ERROR_TEXT("data must be of equal length"));
     }
+    if((lenp == 0) || (lenp > 255)) {
+        mp_raise_ValueError(MP_ERROR_TEXT("number of parameters must be between 1, and 255"));
+    }
+    if(len < lenp) {
+        mp_raise_ValueError(MP_ERROR_TEXT("number of data points must not be less than the number of parameters"));
+    }
+    uint8_t nparams = (uint8_t)lenp;
 
-    mp_float_t *x = m_new(mp_float_t, len);
-    fill_array_iterable(x, x_obj);
-    mp_float_t *y = m_new(mp_float_t, len);
-    fill_array_iterable(y, y_obj);
-    mp_float_t *p0 = m_new(mp_float_t, lenp);
-    fill_array_iterable(p0, p0_obj);
-    mp_float_t *grad = m_new(mp_float_t, len);
-    mp_float_t *jacobi = m_new(mp_float_t, len*len);
-    mp_obj_t *fargs = m_new(mp_obj_t, lenp+1);
-
-    m_del(mp_float_t, p0, lenp);
     // parameters controlling convergence conditions
-    //mp_float_t xatol = mp_obj_get_float(args[2].u_obj);
-    //mp_float_t fatol = mp_obj_get_float(args[3].u_obj);
+    mp_float_t xatol = mp_obj_get_float(args[5].u_obj);
+    mp_float_t fatol = mp_obj_get_float(args[6].u_obj);
+    if(args[7].u_int <= 0) {
+        mp_raise_ValueError(MP_ERROR_TEXT("maxiter must be > 0"));
+    }
+
+    // the model is always called with the same float array holding the independent variable
+    ndarray_obj_t *xdata = ndarray_new_linear_array(len, NDARRAY_FLOAT);
+    fill_array_iterable((mp_float_t *)xdata->array, x_obj);
+    mp_obj_t *fargs = m_new(mp_obj_t, nparams+1);
+    fargs[0] = MP_OBJ_FROM_PTR(xdata);
+
+    ndarray_obj_t *popt = ndarray_new_linear_array(nparams, NDARRAY_FLOAT);
+    mp_float_t *params = (mp_float_t *)popt->array;
+    fill_array_iterable(params, p0_obj);
+
+    // the workspace for the iteration is allocated in a single block
+    size_t wlen = 3 * len + len * nparams + 2 * nparams * nparams + 3 * nparams;
+    mp_float_t *workspace = m_new(mp_float_t, wlen);
+    mp_float_t *y = workspace;
+    mp_float_t *f0 = y + len;               // the model at the current parameters
+    mp_float_t *f1 = f0 + len;              // the model at the trial parameters
+    mp_float_t *jacobi = f1 + len;          // J, len x nparams
+    mp_float_t *alpha = jacobi + len * nparams; // J^T J, nparams x nparams
+    mp_float_t *inverse = alpha + nparams * nparams;
+    mp_float_t *beta = inverse + nparams * nparams; // J^T (y - f)
+    mp_float_t *delta = beta + nparams;
+    mp_float_t *trial = delta + nparams;
+
+    fill_array_iterable(y, y_obj);
+    optimize_model_call(type, fun, fargs, nparams, params, len, f0);
+    mp_float_t cost = optimize_cost(f0, y, len);
 
     // this has finite binary representation; we will multiply/divide by 4
-    //mp_float_t lambda = 0.0078125;
+    mp_float_t lambda = MICROPY_FLOAT_CONST(0.0078125);
+    bool update = true;
+
+    for(mp_int_t iter=0; iter < args[7].u_int; iter++) {
+        if(update) {
+            optimize_jacobi(type, fun, jac, fargs, len, params, nparams, f0, f1, jacobi);
+            for(uint8_t m=0; m < nparams; m++) {
+                beta[m] = MICROPY_FLOAT_CONST(0.0);
+                for(size_t i=0; i < len; i++) {
+                    beta[m] += jacobi[i*nparams+m] * (y[i] - f0[i]);
+                }
+                for(uint8_t n=0; n <= m; n++) {
+                    mp_float_t sum = MICROPY_FLOAT_CONST(0.0);
+                    for(size_t i=0; i < len; i++) {
+                        sum += jacobi[i*nparams+m] * jacobi[i*nparams+n];
+                    }
+                    alpha[m*nparams+n] = alpha[n*nparams+m] = sum;
+                }
+            }
+            update = false;
+        }
+        // solve (J^T J + lambda diag(J^T J)) delta = J^T (y - f)
+        memcpy(inverse, alpha, nparams * nparams * sizeof(mp_float_t));
+        for(uint8_t m=0; m < nparams; m++) {
+            mp_float_t d = alpha[m*(nparams+1)];
+            inverse[m*(nparams+1)] += lambda * (d > MICROPY_FLOAT_CONST(0.0) ? d : MICROPY_FLOAT_CONST(1.0));
+        }
+        if(!linalg_invert_matrix(inverse, nparams)) {
+            lambda *= MICROPY_FLOAT_CONST(4.0);
+            continue;
+        }
+        mp_float_t dmax = MICROPY_FLOAT_CONST(0.0);
+        for(uint8_t m=0; m < nparams; m++) {
+            delta[m] = MICROPY_FLOAT_CONST(0.0);
+            for(uint8_t n=0; n < nparams; n++) {
+                delta[m] += inverse[m*nparams+n] * beta[n];
+            }
+            trial[m] = params[m] + delta[m];
+            if(MICROPY_FLOAT_C_FUN(fabs)(delta[m]) > dmax) {
+                dmax = MICROPY_FLOAT_C_FUN(fabs)(delta[m]);
+            }
+        }
+        optimize_model_call(type, fun, fargs, nparams, trial, len, f1);
+        mp_float_t trial_cost = optimize_cost(f1, y, len);
+        if(trial_cost < cost) {
+            // accept the step, and move towards the Gauss-Newton method
+            mp_float_t dcost = cost - trial_cost;
+            memcpy(params, trial, nparams * sizeof(mp_float_t));
+            memcpy(f0, f1, len * sizeof(mp_float_t));
+            cost = trial_cost;
+            lambda /= MICROPY_FLOAT_CONST(4.0);
+            update = true;
+            if((dcost < fatol) || (dmax < xatol)) {
+                break;
+            }
+        } else {
+            // reject the step, and move towards the gradient descent
+            lambda *= MICROPY_FLOAT_CONST(4.0);
+            if(dmax < xatol) {
+                break;
+            }
+        }
+    }
 
-    //linalg_invert_matrix(mp_float_t *data, size_t N)
+    // the covariance matrix is the inverse of J^T J at the optimum, scaled by the residual variance
+    if(update) {
+        optimize_jacobi(type, fun, jac, fargs, len, params, nparams, f0, f1, jacobi);
+        for(uint8_t m=0; m < nparams; m++) {
+            for(uint8_t n=0; n <= m; n++) {
+                mp_float_t sum = MICROPY_FLOAT_CONST(0.0);
+                for(size_t i=0; i < len; i++) {
+                    sum += jacobi[i*nparams+m] * jacobi[i*nparams+n];
+                }
+                alpha[m*nparams+n] = alpha[n*nparams+m] = sum;
+            }
+        }
+    }
+    ndarray_obj_t *pcov = ndarray_new_dense_ndarray(2, ndarray_shape_vector(0, 0, nparams, nparams), NDARRAY_FLOAT);
+    mp_float_t *pcov_array = (mp_float_t *)pcov->array;
+    memcpy(pcov_array, alpha, nparams * nparams * sizeof(mp_float_t));
+    if((len > nparams) && linalg_invert_matrix(pcov_array, nparams)) {
+        mp_float_t variance = cost / (len - nparams);
+        for(size_t i=0; i < pcov->len; i++) {
+            pcov_array[i] *= variance;
+        }
+    } else {
+        for(size_t i=0; i < pcov->len; i++) {
+            pcov_array[i] = INFINITY;
+        }
+    }
 
-    m_del(mp_float_t, x, len);
-    m_del(mp_float_t, y, len);
-    m_del(mp_float_t, grad, len);
-    m_del(mp_float_t, jacobi, len*len);
-    m_del(mp_obj_t, fargs, lenp+1);
-    return mp_const_none;
+    m_del(mp_float_t, workspace, wlen);
+    m_del(mp_obj_t, fargs, nparams+1);
+
+    mp_obj_t tuple[2] = { MP_OBJ_FROM_PTR(popt), MP_OBJ_FROM_PTR(pcov) };
+    return mp_obj_new_tuple(2, tuple);
 }
 
-MP_DEFINE_CONST_FUN_OBJ_KW(optimize_curve_fit_obj, 2, optimize_curve_fit);
+MP_DEFINE_CONST_FUN_OBJ_KW(optimize_curve_fit_obj, 4, optimize_curve_fit);
 #endif
 
 #if ULAB_SCIPY_OPTIMIZE_HAS_NEWTON
+#if ULAB_SCIPY_OPTIMIZE_HAS_BATCHED_ROOTS
+static mp_obj_t optimize_newton_batch(const mp_obj_type_t *type, mp_obj_t fun, ndarray_obj_t *x0, mp_float_t tol, mp_float_t rtol, mp_int_t maxiter) {
+    // Solves independent problems starting from the elements of x0 with the secant method.
+    // The function is called twice per iteration with a float array of the shape of x0,
+    // and elements that have already converged are left untouched.
+    ndarray_obj_t *x = ndarray_new_dense_ndarray(x0->ndim, x0->shape, NDARRAY_FLOAT);
+    ndarray_obj_t *results = ndarray_new_dense_ndarray(x0->ndim, x0->shape, NDARRAY_FLOAT);
+    size_t len = x->len;
+
+    mp_float_t *xarray = (mp_float_t *)x->array;
+    mp_float_t *rarray = (mp_float_t *)results->array;
+    mp_float_t *dx = m_new(mp_float_t, len);
+    mp_float_t *fx = m_new(mp_float_t, len);
+    mp_float_t *fdx = m_new(mp_float_t, len);
+    uint8_t *active = m_new(uint8_t, len);
+
+    optimize_fill_batch(rarray, MP_OBJ_FROM_PTR(x0), x);
+    for(size_t i = 0; i < len; i++) {
+        dx[i] = rarray[i] > MICROPY_FLOAT_CONST(0.0) ? OPTIMIZE_EPS * rarray[i] : -OPTIMIZE_EPS * rarray[i];
+        active[i] = 1;
+    }
+
+    size_t remaining = len;
+    for(mp_int_t iter = 0; (iter < maxiter) && (remaining > 0); iter++) {
+        memcpy(xarray, rarray, len * sizeof(mp_float_t));
+        optimize_python_call_batch(type, fun, x, fx);
+        for(size_t i = 0; i < len; i++) {
+            // converged elements are evaluated at the same point twice
+            xarray[i] = active[i] ? rarray[i] + dx[i] : rarray[i];
+        }
+        optimize_python_call_batch(type, fun, x, fdx);
+        for(size_t i = 0; i < len; i++) {
+            if(active[i]) {
+                mp_float_t df = (fdx[i] - fx[i]) / dx[i];
+                dx[i] = fx[i] / df;
+                rarray[i] -= dx[i];
+                if(MICROPY_FLOAT_C_FUN(fabs)(dx[i]) < (tol + rtol * MICROPY_FLOAT_C_FUN(fabs)(rarray[i]))) {
+                    active[i] = 0;
+                    remaining--;
+                }
+            }
+        }
+    }
+    m_del(mp_float_t, dx, len);
+    m_del(mp_float_t, fx, len);
+    m_del(mp_float_t, fdx, len);
+    m_del(uint8_t, active, len);
+    return MP_OBJ_FROM_PTR(results);
+}
+#endif /* ULAB_SCIPY_OPTIMIZE_HAS_BATCHED_ROOTS */
+
 //| def newton(
 //|     fun: Callable[[float], float],
 //|     x0: float,
@@ -344,7 +874,11 @@ MP_DEFINE_CONST_FUN_OBJ_KW(optimize_curve_fit_obj, 2, optimize_curve_fit);
 //|
 //|     Find a solution (zero) of the function ``f(x)`` using Newton's Method.
 //|     The result is accurate to within ``xtol * rtol * |f(x)|`` unless more than
-//|     ``maxiter`` steps are requried."""
+//|     ``maxiter`` steps are requried.
+//|
+//|     If ``x0`` is an ndarray, the independent problems starting from its elements are
+//|     solved at the same time, and an ndarray is returned. In this case, ``f`` is called
+//|     with an ndarray twice per iteration, and must return an ndarray of the same length."""
 //|     ...
 //|
 
@@ -368,15 +902,20 @@ static mp_obj_t optimize_newton(size_t n_args, const mp_obj_t *pos_args, mp_map_
     if(!MP_OBJ_TYPE_HAS_SLOT(type, call)) {
         mp_raise_TypeError(MP_ERROR_TEXT("first argument must be a function"));
     }
-    mp_float_t x = mp_obj_get_float(args[1].u_obj);
     mp_float_t tol = mp_obj_get_float(args[2].u_obj);
     mp_float_t rtol = mp_obj_get_float(args[3].u_obj);
-    mp_float_t dx, df, fx;
-    dx = x > MICROPY_FLOAT_CONST(0.0) ? OPTIMIZE_EPS * x : -OPTIMIZE_EPS * x;
-    mp_obj_t fargs[1];
     if(args[4].u_int <= 0) {
         mp_raise_ValueError(MP_ERROR_TEXT("maxiter must be > 0"));
     }
+    #if ULAB_SCIPY_OPTIMIZE_HAS_BATCHED_ROOTS
+    if(mp_obj_is_type(args[1].u_obj, &ulab_ndarray_type)) {
+        return optimize_newton_batch(type, fun, MP_OBJ_TO_PTR(args[1].u_obj), tol, rtol, args[4].u_int);
+    }
+    #endif
+    mp_float_t x = mp_obj_get_float(args[1].u_obj);
+    mp_float_t dx, df, fx;
+    dx = x > MICROPY_FLOAT_CONST(0.0) ? OPTIMIZE_EPS * x : -OPTIMIZE_EPS * x;
+    mp_obj_t fargs[1];
     for(uint16_t i=0; i < args[4].u_int; i++) {
         fx = optimize_python_call(type, fun, x, fargs, 0);
         df = (optimize_python_call(type, fun, x + dx, fargs, 0) - fx) / dx;
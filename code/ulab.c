@@ -33,7 +33,7 @@
 #include "user/user.h"
 #include "utils/utils.h"
 
-#define ULAB_VERSION 6.12.0
+#define ULAB_VERSION 6.37.0
 #define xstr(s) str(s)
 #define str(s) #s
 
@@ -179,7 +179,8 @@ MP_DEFINE_CONST_OBJ_TYPE(
     ndarray_flatiter_type,
     MP_QSTR_flatiter,
     MP_TYPE_FLAG_ITER_IS_GETITER,
-    iter, ndarray_get_flatiterator
+    iter, ndarray_get_flatiterator,
+    subscr, ndarray_flatiter_subscr
 );
 #else
 const mp_obj_type_t ndarray_flatiter_type = {
@@ -187,6 +188,7 @@ const mp_obj_type_t ndarray_flatiter_type = {
     .name = MP_QSTR_flatiter,
     MP_TYPE_EXTENDED_FIELDS(
     .getiter = ndarray_get_flatiterator,
+    .subscr = ndarray_flatiter_subscr,
     )
 };
 #endif
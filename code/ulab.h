@@ -36,6 +36,18 @@
 #define ULAB_SUPPORTS_COMPLEX               (1)
 #endif
 
+// Determines, whether the uint32, and int32 dtypes are available. The extra
+// types increase the firmware size, hence, they are off by default
+#ifndef ULAB_HAS_INT32
+#define ULAB_HAS_INT32                      (0)
+#endif
+
+// Determines, whether the float16 dtype is available. float16 is a storage type
+// only: the values are converted to mp_float_t, whenever they are used in a calculation
+#ifndef ULAB_HAS_FLOAT16
+#define ULAB_HAS_FLOAT16                    (0)
+#endif
+
 // Determines, whether scipy is defined in ulab. The sub-modules and functions
 // of scipy have to be defined separately
 #ifndef ULAB_HAS_SCIPY
@@ -66,6 +78,14 @@
 #define NDARRAY_IS_SLICEABLE                (1)
 #endif
 
+// Integer-array indexing, and numpy.take process the indices in sorted order,
+// if there are at least this many of them, and they are not sorted already.
+// This improves locality on targets with data cache, e.g., with external RAM,
+// but costs time on microcontrollers without cache. 0 switches sorting off.
+#ifndef NDARRAY_GATHER_SORT_THRESHOLD
+#define NDARRAY_GATHER_SORT_THRESHOLD       (0)
+#endif
+
 // The default threshold for pretty printing. These variables can be overwritten
 // at run-time via the set_printoptions() function
 #ifndef ULAB_HAS_PRINTOPTIONS
@@ -190,6 +210,10 @@
 #define ULAB_NUMPY_HAS_BITWISE_AND          (1)
 #endif
 
+#ifndef ULAB_NUMPY_HAS_BITWISE_COUNT
+#define ULAB_NUMPY_HAS_BITWISE_COUNT        (1)
+#endif
+
 #ifndef ULAB_NUMPY_HAS_BITWISE_OR
 #define ULAB_NUMPY_HAS_BITWISE_OR           (1)
 #endif
@@ -206,6 +230,19 @@
 #define ULAB_NUMPY_HAS_RIGHT_SHIFT          (1)
 #endif
 
+// bit packing, and counting
+#ifndef ULAB_NUMPY_HAS_COUNT_NONZERO
+#define ULAB_NUMPY_HAS_COUNT_NONZERO        (1)
+#endif
+
+#ifndef ULAB_NUMPY_HAS_PACKBITS
+#define ULAB_NUMPY_HAS_PACKBITS             (1)
+#endif
+
+#ifndef ULAB_NUMPY_HAS_UNPACKBITS
+#define ULAB_NUMPY_HAS_UNPACKBITS           (1)
+#endif
+
 // the ndarray unary operators
 #ifndef NDARRAY_HAS_UNARY_OPS
 #define NDARRAY_HAS_UNARY_OPS               (1)
@@ -386,10 +423,21 @@
 #define ULAB_NUMPY_HAS_CLIP             (1)
 #endif
 
+// if this constant is set, clip runs a single typed loop, instead of calling
+// minimum and maximum in succession, and it also accepts the out keyword argument;
+// this costs around 2 kB of flash, but saves a full-size intermediate array
+#ifndef ULAB_NUMPY_CLIP_IS_FUSED
+#define ULAB_NUMPY_CLIP_IS_FUSED        (0)
+#endif
+
 #ifndef ULAB_NUMPY_HAS_EQUAL
 #define ULAB_NUMPY_HAS_EQUAL            (1)
 #endif
 
+#ifndef ULAB_NUMPY_HAS_FLATNONZERO
+#define ULAB_NUMPY_HAS_FLATNONZERO      (1)
+#endif
+
 #ifndef ULAB_NUMPY_HAS_ISFINITE
 #define ULAB_NUMPY_HAS_ISFINITE         (1)
 #endif
@@ -440,6 +488,12 @@
 #define ULAB_INTEGRATE_HAS_QUAD				(1)
 #endif
 
+// if this constant is set, the integrators accept the vectorized keyword argument,
+// and evaluate the integrand on whole arrays of abscissas in a single call
+#ifndef ULAB_INTEGRATE_HAS_VECTORIZED
+#define ULAB_INTEGRATE_HAS_VECTORIZED		(1)
+#endif
+
 // the linalg module; functions of the linalg module still have
 // to be defined separately
 #ifndef ULAB_NUMPY_HAS_LINALG_MODULE
@@ -525,6 +579,14 @@
 #define ULAB_NUMPY_HAS_CROSS            (1)
 #endif
 
+#ifndef ULAB_NUMPY_HAS_CUMPROD
+#define ULAB_NUMPY_HAS_CUMPROD          (1)
+#endif
+
+#ifndef ULAB_NUMPY_HAS_CUMSUM
+#define ULAB_NUMPY_HAS_CUMSUM           (1)
+#endif
+
 #ifndef ULAB_NUMPY_HAS_DELETE
 #define ULAB_NUMPY_HAS_DELETE           (1)
 #endif
@@ -601,6 +663,12 @@
 #define ULAB_NUMPY_HAS_SUM              (1)
 #endif
 
+// sum, mean, and std process the data in blocks of this many elements;
+// larger blocks mean fewer divisions, but slightly larger rounding errors within a block
+#ifndef ULAB_NUMERICAL_BLOCK_SIZE
+#define ULAB_NUMERICAL_BLOCK_SIZE       (32)
+#endif
+
 #ifndef ULAB_NUMPY_HAS_TAKE
 #define ULAB_NUMPY_HAS_TAKE             (1)
 #endif
@@ -727,6 +795,10 @@
 
 // Complex functions. The implementations are compiled into
 // the firmware, only if ULAB_SUPPORTS_COMPLEX is set to 1
+#ifndef ULAB_NUMPY_HAS_ANGLE
+#define ULAB_NUMPY_HAS_ANGLE            (1)
+#endif
+
 #ifndef ULAB_NUMPY_HAS_CONJUGATE
 #define ULAB_NUMPY_HAS_CONJUGATE        (1)
 #endif
@@ -748,14 +820,46 @@
 #define ULAB_NUMPY_HAS_RANDOM_MODULE    (1)
 #endif
 
+#ifndef ULAB_NUMPY_RANDOM_HAS_ADVANCE
+#define ULAB_NUMPY_RANDOM_HAS_ADVANCE   (1)
+#endif
+
+#ifndef ULAB_NUMPY_RANDOM_HAS_CHOICE
+#define ULAB_NUMPY_RANDOM_HAS_CHOICE    (1)
+#endif
+
+#ifndef ULAB_NUMPY_RANDOM_HAS_EXPONENTIAL
+#define ULAB_NUMPY_RANDOM_HAS_EXPONENTIAL   (1)
+#endif
+
+#ifndef ULAB_NUMPY_RANDOM_HAS_INTEGERS
+#define ULAB_NUMPY_RANDOM_HAS_INTEGERS  (1)
+#endif
+
+#ifndef ULAB_NUMPY_RANDOM_HAS_JUMPED
+#define ULAB_NUMPY_RANDOM_HAS_JUMPED    (1)
+#endif
+
 #ifndef ULAB_NUMPY_RANDOM_HAS_NORMAL
 #define ULAB_NUMPY_RANDOM_HAS_NORMAL    (1)
 #endif
 
+#ifndef ULAB_NUMPY_RANDOM_HAS_PERMUTATION
+#define ULAB_NUMPY_RANDOM_HAS_PERMUTATION   (1)
+#endif
+
 #ifndef ULAB_NUMPY_RANDOM_HAS_RANDOM
 #define ULAB_NUMPY_RANDOM_HAS_RANDOM    (1)
 #endif
 
+#ifndef ULAB_NUMPY_RANDOM_HAS_SPAWN
+#define ULAB_NUMPY_RANDOM_HAS_SPAWN     (1)
+#endif
+
+#ifndef ULAB_NUMPY_RANDOM_HAS_STANDARD_NORMAL
+#define ULAB_NUMPY_RANDOM_HAS_STANDARD_NORMAL   (1)
+#endif
+
 #ifndef ULAB_NUMPY_RANDOM_HAS_UNIFORM
 #define ULAB_NUMPY_RANDOM_HAS_UNIFORM   (1)
 #endif
@@ -790,8 +894,9 @@
 #define ULAB_SCIPY_OPTIMIZE_HAS_BISECT      (1)
 #endif
 
+// curve_fit returns the covariance matrix, hence, it requires at least two dimensions
 #ifndef ULAB_SCIPY_OPTIMIZE_HAS_CURVE_FIT
-#define ULAB_SCIPY_OPTIMIZE_HAS_CURVE_FIT   (0) // not fully implemented
+#define ULAB_SCIPY_OPTIMIZE_HAS_CURVE_FIT   (ULAB_MAX_DIMS > 1)
 #endif
 
 #ifndef ULAB_SCIPY_OPTIMIZE_HAS_FMIN
@@ -802,6 +907,12 @@
 #define ULAB_SCIPY_OPTIMIZE_HAS_NEWTON      (1)
 #endif
 
+// if this constant is set, bisect and newton accept ndarrays of brackets, or initial
+// values, and solve all problems at the same time with a single function call per iteration
+#ifndef ULAB_SCIPY_OPTIMIZE_HAS_BATCHED_ROOTS
+#define ULAB_SCIPY_OPTIMIZE_HAS_BATCHED_ROOTS   (1)
+#endif
+
 #ifndef ULAB_SCIPY_HAS_SPECIAL_MODULE
 #define ULAB_SCIPY_HAS_SPECIAL_MODULE       (1)
 #endif
@@ -847,6 +958,11 @@
 #define ULAB_UTILS_HAS_SPECTROGRAM          (1)
 #endif
 
+// moving sum, mean, std, min, and max with O(1) cost per element
+#ifndef ULAB_UTILS_HAS_MOVING
+#define ULAB_UTILS_HAS_MOVING               (1)
+#endif
+
 // user-defined module; source of the module and
 // its sub-modules should be placed in code/user/
 #ifndef ULAB_HAS_USER_MODULE
@@ -39,6 +39,101 @@ mp_float_t ndarray_get_float_int16(void *data) {
     return (mp_float_t)(*(int16_t *)data);
 }
 
+#if ULAB_HAS_INT32
+mp_float_t ndarray_get_float_uint32(void *data) {
+    // Returns a float value from an uint32_t type
+    return (mp_float_t)(*(uint32_t *)data);
+}
+
+mp_float_t ndarray_get_float_int32(void *data) {
+    // Returns a float value from an int32_t type
+    return (mp_float_t)(*(int32_t *)data);
+}
+#endif
+
+#if ULAB_HAS_FLOAT16
+// Conversion between the IEEE 754 half-precision format, and mp_float_t. The bits are
+// manipulated directly, so that neither a look-up table, nor hardware support is required.
+
+mp_float_t ulab_float16_to_float(uint16_t half) {
+    uint32_t sign = (uint32_t)(half & 0x8000) << 16;
+    uint32_t exponent = (half >> 10) & 0x1f;
+    uint32_t mantissa = half & 0x3ff;
+    union { uint32_t i; float f; } u;
+
+    if(exponent == 0x1f) { // inf, or nan
+        u.i = sign | 0x7f800000 | (mantissa << 13);
+    } else if(exponent == 0) {
+        if(mantissa == 0) { // signed zero
+            u.i = sign;
+        } else {
+            // subnormal numbers have to be normalised first
+            exponent = 127 - 15 + 1;
+            while(!(mantissa & 0x400)) {
+                mantissa <<= 1;
+                exponent--;
+            }
+            u.i = sign | (exponent << 23) | ((mantissa & 0x3ff) << 13);
+        }
+    } else {
+        u.i = sign | ((exponent + 127 - 15) << 23) | (mantissa << 13);
+    }
+    return (mp_float_t)u.f;
+}
+
+uint16_t ulab_float_to_float16(mp_float_t value) {
+    // rounds to the nearest representable value, ties to even
+    union { float f; uint32_t i; } u;
+    u.f = (float)value;
+    uint16_t sign = (u.i >> 16) & 0x8000;
+    uint32_t exponent = (u.i >> 23) & 0xff;
+    uint32_t mantissa = u.i & 0x7fffff;
+
+    if(exponent == 0xff) { // inf, or nan; nans remain quiet nans
+        return sign | 0x7c00 | (mantissa ? 0x200 : 0);
+    }
+    int32_t e = (int32_t)exponent - 127 + 15;
+    if(e >= 0x1f) { // overflow
+        return sign | 0x7c00;
+    }
+    uint32_t half, remainder, halfway;
+    if(e <= 0) {
+        // the result is either a subnormal number, or zero
+        if(e < -10) {
+            return sign;
+        }
+        mantissa |= 0x800000;
+        uint8_t shift = 14 - e;
+        half = mantissa >> shift;
+        remainder = mantissa & ((1UL << shift) - 1);
+        halfway = 1UL << (shift - 1);
+    } else {
+        half = ((uint32_t)e << 10) | (mantissa >> 13);
+        remainder = mantissa & 0x1fff;
+        halfway = 0x1000;
+    }
+    #if MICROPY_FLOAT_IMPL == MICROPY_FLOAT_IMPL_DOUBLE
+    if((remainder == halfway) && ((mp_float_t)u.f != value)) {
+        // the cast to float rounded value onto the tie, hence, the tie has to be broken by value itself
+        if(sign ? (value < (mp_float_t)u.f) : (value > (mp_float_t)u.f)) {
+            remainder++;
+        } else {
+            remainder--;
+        }
+    }
+    #endif
+    // a carry from the mantissa correctly increments the exponent, and rounds to inf at the top
+    if((remainder > halfway) || ((remainder == halfway) && (half & 1))) {
+        half++;
+    }
+    return sign | (uint16_t)half;
+}
+
+mp_float_t ndarray_get_float_float16(void *data) {
+    // Returns a float value from a half-precision float
+    return ulab_float16_to_float(*(uint16_t *)data);
+}
+#endif
 
 mp_float_t ndarray_get_float_float(void *data) {
     // Returns a float value from an mp_float_t type
@@ -55,7 +150,20 @@ void *ndarray_get_float_function(uint8_t dtype) {
         return ndarray_get_float_uint16;
     } else if(dtype == NDARRAY_INT16) {
         return ndarray_get_float_int16;
-    } else {
+    }
+    #if ULAB_HAS_INT32
+    else if(dtype == NDARRAY_UINT32) {
+        return ndarray_get_float_uint32;
+    } else if(dtype == NDARRAY_INT32) {
+        return ndarray_get_float_int32;
+    }
+    #endif
+    #if ULAB_HAS_FLOAT16
+    else if(dtype == NDARRAY_FLOAT16) {
+        return ndarray_get_float_float16;
+    }
+    #endif
+    else {
         return ndarray_get_float_float;
     }
 }
@@ -70,7 +178,20 @@ mp_float_t ndarray_get_float_index(void *data, uint8_t dtype, size_t index) {
         return (mp_float_t)((uint16_t *)data)[index];
     } else if(dtype == NDARRAY_INT16) {
         return (mp_float_t)((int16_t *)data)[index];
-    } else {
+    }
+    #if ULAB_HAS_INT32
+    else if(dtype == NDARRAY_UINT32) {
+        return (mp_float_t)((uint32_t *)data)[index];
+    } else if(dtype == NDARRAY_INT32) {
+        return (mp_float_t)((int32_t *)data)[index];
+    }
+    #endif
+    #if ULAB_HAS_FLOAT16
+    else if(dtype == NDARRAY_FLOAT16) {
+        return ulab_float16_to_float(((uint16_t *)data)[index]);
+    }
+    #endif
+    else {
         return (mp_float_t)((mp_float_t *)data)[index];
     }
 }
@@ -86,12 +207,25 @@ mp_float_t ndarray_get_float_value(void *data, uint8_t dtype) {
         return (mp_float_t)(*(uint16_t *)data);
     } else if(dtype == NDARRAY_INT16) {
         return (mp_float_t)(*(int16_t *)data);
-    } else {
+    }
+    #if ULAB_HAS_INT32
+    else if(dtype == NDARRAY_UINT32) {
+        return (mp_float_t)(*(uint32_t *)data);
+    } else if(dtype == NDARRAY_INT32) {
+        return (mp_float_t)(*(int32_t *)data);
+    }
+    #endif
+    #if ULAB_HAS_FLOAT16
+    else if(dtype == NDARRAY_FLOAT16) {
+        return ulab_float16_to_float(*(uint16_t *)data);
+    }
+    #endif
+    else {
         return *((mp_float_t *)data);
     }
 }
 
-#if NDARRAY_BINARY_USES_FUN_POINTER | ULAB_NUMPY_HAS_WHERE
+#if NDARRAY_BINARY_USES_FUN_POINTER | ULAB_NUMPY_HAS_WHERE | ULAB_HAS_INT32 | ULAB_HAS_FLOAT16
 uint8_t ndarray_upcast_dtype(uint8_t ldtype, uint8_t rdtype) {
     // returns a single character that corresponds to the broadcasting rules
     // - if one of the operarands is a float, the result is always float
@@ -103,11 +237,35 @@ uint8_t ndarray_upcast_dtype(uint8_t ldtype, uint8_t rdtype) {
     // int8 + int16 => int16
     // int8 + uint16 => uint16
     // uint16 + int16 => float
+    //
+    // and, if ULAB_HAS_INT32 is set,
+    //
+    // int32 + any integer type except uint32 => int32
+    // uint32 + any unsigned integer type => uint32
+    // uint32 + any signed integer type => float
+    //
+    // float16 is promoted to float, unless both operands are float16
 
     if(ldtype == rdtype) {
         // if the two dtypes are equal, the result is also of that type
         return ldtype;
-    } else if(((ldtype == NDARRAY_UINT8) && (rdtype == NDARRAY_INT8)) ||
+    }
+    #if ULAB_HAS_FLOAT16
+    if((ldtype == NDARRAY_FLOAT16) || (rdtype == NDARRAY_FLOAT16)) {
+        return NDARRAY_FLOAT;
+    }
+    #endif
+    #if ULAB_HAS_INT32
+    if((ldtype == NDARRAY_FLOAT) || (rdtype == NDARRAY_FLOAT)) {
+        return NDARRAY_FLOAT;
+    } else if((ldtype == NDARRAY_UINT32) || (rdtype == NDARRAY_UINT32)) {
+        uint8_t other = ldtype == NDARRAY_UINT32 ? rdtype : ldtype;
+        return ((other == NDARRAY_UINT8) || (other == NDARRAY_UINT16)) ? NDARRAY_UINT32 : NDARRAY_FLOAT;
+    } else if((ldtype == NDARRAY_INT32) || (rdtype == NDARRAY_INT32)) {
+        return NDARRAY_INT32;
+    }
+    #endif
+    if(((ldtype == NDARRAY_UINT8) && (rdtype == NDARRAY_INT8)) ||
             ((ldtype == NDARRAY_INT8) && (rdtype == NDARRAY_UINT8)) ||
             ((ldtype == NDARRAY_UINT8) && (rdtype == NDARRAY_INT16)) ||
             ((ldtype == NDARRAY_INT16) && (rdtype == NDARRAY_UINT8)) ||
@@ -142,6 +300,22 @@ void ndarray_set_float_int16(void *data, mp_float_t datum) {
     *((int16_t *)data) = (int16_t)datum;
 }
 
+#if ULAB_HAS_INT32
+void ndarray_set_float_uint32(void *data, mp_float_t datum) {
+    *((uint32_t *)data) = (uint32_t)datum;
+}
+
+void ndarray_set_float_int32(void *data, mp_float_t datum) {
+    *((int32_t *)data) = (int32_t)datum;
+}
+#endif
+
+#if ULAB_HAS_FLOAT16
+void ndarray_set_float_float16(void *data, mp_float_t datum) {
+    *((uint16_t *)data) = ulab_float_to_float16(datum);
+}
+#endif
+
 void ndarray_set_float_float(void *data, mp_float_t datum) {
     *((mp_float_t *)data) = datum;
 }
@@ -156,11 +330,24 @@ void *ndarray_set_float_function(uint8_t dtype) {
         return ndarray_set_float_uint16;
     } else if(dtype == NDARRAY_INT16) {
         return ndarray_set_float_int16;
-    } else {
+    }
+    #if ULAB_HAS_INT32
+    else if(dtype == NDARRAY_UINT32) {
+        return ndarray_set_float_uint32;
+    } else if(dtype == NDARRAY_INT32) {
+        return ndarray_set_float_int32;
+    }
+    #endif
+    #if ULAB_HAS_FLOAT16
+    else if(dtype == NDARRAY_FLOAT16) {
+        return ndarray_set_float_float16;
+    }
+    #endif
+    else {
         return ndarray_set_float_float;
     }
 }
-#endif /* NDARRAY_BINARY_USES_FUN_POINTER */
+#endif /* NDARRAY_BINARY_USES_FUN_POINTER | ULAB_NUMPY_HAS_WHERE | ULAB_HAS_INT32 | ULAB_HAS_FLOAT16 */
 
 int8_t tools_get_axis(mp_obj_t axis, uint8_t ndim) {
     int8_t ax = mp_obj_get_int(axis);
@@ -171,6 +358,21 @@ int8_t tools_get_axis(mp_obj_t axis, uint8_t ndim) {
     return ax;
 }
 
+int32_t tools_line_offset(ndarray_obj_t *ndarray, uint8_t index, size_t line) {
+    // returns the offset (in bytes) of the start of the one-dimensional slice along the axis `index`,
+    // when the slices are numbered in C order over the remaining axes; this costs a couple of
+    // divisions per slice, but works for arbitrary strides, and any number of dimensions
+    int32_t offset = 0;
+    for(uint8_t i = 0; i < ndarray->ndim; i++) {
+        uint8_t d = ULAB_MAX_DIMS - 1 - i;
+        if(d != index) {
+            offset += (int32_t)(line % ndarray->shape[d]) * ndarray->strides[d];
+            line /= ndarray->shape[d];
+        }
+    }
+    return offset;
+}
+
 shape_strides tools_reduce_axes(ndarray_obj_t *ndarray, mp_obj_t axis) {
     // TODO: replace numerical_reduce_axes with this function, wherever applicable
     // This function should be used, whenever a tensor is contracted;
@@ -234,7 +436,7 @@ mp_obj_t ulab_tools_restore_dims(ndarray_obj_t *ndarray, ndarray_obj_t *results,
     if((ndarray->ndim == 1) && (keepdims != mp_const_true)) {
         // since the original array has already been contracted and 
         // we don't want to keep the dimensions here, we have to return a scalar
-        return mp_binary_get_val_array(results->dtype, results->array, 0);
+        return ndarray_get_value(results->dtype, results->array, 0);
     }
 
     if(keepdims == mp_const_true) {
@@ -274,6 +476,11 @@ uint8_t ulab_binary_get_size(uint8_t dtype) {
         return 2 * (uint8_t)sizeof(mp_float_t);
     }
     #endif
+    #if ULAB_HAS_FLOAT16
+    if(dtype == NDARRAY_FLOAT16) {
+        return 2;
+    }
+    #endif
     return dtype == NDARRAY_BOOL ? 1 : mp_binary_get_size('@', dtype, NULL);
 }
 
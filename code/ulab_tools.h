@@ -27,6 +27,15 @@ mp_float_t ndarray_get_float_uint8(void *);
 mp_float_t ndarray_get_float_int8(void *);
 mp_float_t ndarray_get_float_uint16(void *);
 mp_float_t ndarray_get_float_int16(void *);
+#if ULAB_HAS_INT32
+mp_float_t ndarray_get_float_uint32(void *);
+mp_float_t ndarray_get_float_int32(void *);
+#endif
+#if ULAB_HAS_FLOAT16
+mp_float_t ulab_float16_to_float(uint16_t );
+uint16_t ulab_float_to_float16(mp_float_t );
+mp_float_t ndarray_get_float_float16(void *);
+#endif
 mp_float_t ndarray_get_float_float(void *);
 void *ndarray_get_float_function(uint8_t );
 
@@ -35,6 +44,7 @@ void *ndarray_set_float_function(uint8_t );
 
 shape_strides tools_reduce_axes(ndarray_obj_t *, mp_obj_t );
 int8_t tools_get_axis(mp_obj_t , uint8_t );
+int32_t tools_line_offset(ndarray_obj_t *, uint8_t , size_t );
 mp_obj_t ulab_tools_restore_dims(ndarray_obj_t * , ndarray_obj_t * , mp_obj_t , shape_strides );
 ndarray_obj_t *tools_object_is_square(mp_obj_t );
 
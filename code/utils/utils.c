@@ -17,6 +17,7 @@
 #include "utils.h"
 
 #include "../ulab_tools.h"
+#include "../numpy/carray/carray_tools.h"
 #include "../numpy/fft/fft_tools.h"
 
 #if ULAB_HAS_UTILS_MODULE
@@ -28,6 +29,14 @@ enum UTILS_BUFFER_TYPE {
     UTILS_UINT32_BUFFER,
 };
 
+enum UTILS_MOVING_TYPE {
+    UTILS_MOVING_SUM,
+    UTILS_MOVING_MEAN,
+    UTILS_MOVING_STD,
+    UTILS_MOVING_MIN,
+    UTILS_MOVING_MAX,
+};
+
 #if ULAB_UTILS_HAS_FROM_INT16_BUFFER | ULAB_UTILS_HAS_FROM_UINT16_BUFFER | ULAB_UTILS_HAS_FROM_INT32_BUFFER | ULAB_UTILS_HAS_FROM_UINT32_BUFFER
 static mp_obj_t utils_from_intbuffer_helper(size_t n_args, const mp_obj_t *pos_args, mp_map_t *kw_args, uint8_t buffer_type) {
     static const mp_arg_t allowed_args[] = {
@@ -381,6 +390,208 @@ MP_DEFINE_CONST_FUN_OBJ_KW(utils_spectrogram_obj, 1, utils_spectrogram);
 
 #endif /* ULAB_UTILS_HAS_SPECTROGRAM */
 
+#if ULAB_UTILS_HAS_MOVING
+//| def moving(op: str, x: ulab.numpy.ndarray, window: int, *, axis: int = -1) -> ulab.numpy.ndarray:
+//|     """
+//|     :param str op: one of 'sum', 'mean', 'std', 'min', or 'max'
+//|     :param ulab.numpy.ndarray x: the input array
+//|     :param int window: the number of elements in the window
+//|     :param int axis: the axis along which the window slides
+//|
+//|     Returns the reduction of each window of length ``window`` along the given axis. Only full
+//|     windows are taken, hence the length of the axis shrinks to ``len - window + 1``. The results
+//|     of sum, mean, and std are floats, min and max retain the dtype of the input."""
+//|     ...
+//|
+
+static void utils_moving_moments(uint8_t *array, int32_t stride, size_t window, mp_float_t iwindow,
+                                mp_float_t *mean, mp_float_t *S, bool isStd, mp_float_t (*func)(void *)) {
+    // calculates the mean, and the sum of squared deviations of a single window in two passes
+    mp_float_t M = MICROPY_FLOAT_CONST(0.0);
+    mp_float_t s = MICROPY_FLOAT_CONST(0.0);
+    uint8_t *sarray = array;
+    for(size_t i = 0; i < window; i++) {
+        M += func(sarray);
+        sarray += stride;
+    }
+    M *= iwindow;
+    if(isStd) {
+        sarray = array;
+        for(size_t i = 0; i < window; i++) {
+            mp_float_t dev = func(sarray) - M;
+            s += dev * dev;
+            sarray += stride;
+        }
+    }
+    *mean = M;
+    *S = s;
+}
+
+static void utils_moving_sum_mean_std(uint8_t *array, int32_t stride, size_t len, size_t window,
+                                      mp_float_t *rarray, int32_t rstride, uint8_t optype, mp_float_t (*func)(void *)) {
+    // the mean, and the sum of squared deviations are updated, when an element enters, and another one
+    // leaves the window; this is the sliding version of Welford's algorithm, and costs O(1) per element.
+    // The rounding errors of the updates would accumulate over a long line, hence, the moments are
+    // re-calculated from scratch, whenever the window has moved by its own length.
+    mp_float_t iwindow = MICROPY_FLOAT_CONST(1.0) / (mp_float_t)window;
+    mp_float_t mean, S;
+    bool isStd = optype == UTILS_MOVING_STD;
+    utils_moving_moments(array, stride, window, iwindow, &mean, &S, isStd, func);
+
+    uint8_t *head = array + window * stride;
+    uint8_t *tail = array;
+    for(size_t i = window; ; i++) {
+        if(optype == UTILS_MOVING_SUM) {
+            *rarray = mean * (mp_float_t)window;
+        } else if(optype == UTILS_MOVING_MEAN) {
+            *rarray = mean;
+        } else {
+            // rounding might make S slightly negative, when the window is constant
+            *rarray = S > MICROPY_FLOAT_CONST(0.0) ? MICROPY_FLOAT_C_FUN(sqrt)(S * iwindow) : MICROPY_FLOAT_CONST(0.0);
+        }
+        if(i == len) {
+            break;
+        }
+        rarray += rstride;
+        if((i + 1 - window) % window == 0) {
+            head += stride;
+            tail += stride;
+            utils_moving_moments(tail, stride, window, iwindow, &mean, &S, isStd, func);
+            continue;
+        }
+        mp_float_t xin = func(head);
+        mp_float_t xout = func(tail);
+        mp_float_t new_mean = mean + (xin - xout) * iwindow;
+        S += (xin - xout) * (xin - new_mean + xout - mean);
+        mean = new_mean;
+        head += stride;
+        tail += stride;
+    }
+}
+
+static void utils_moving_min_max(uint8_t *array, int32_t stride, size_t len, size_t window, uint8_t itemsize,
+                                uint8_t *rarray, int32_t rstride, uint8_t optype, mp_float_t (*func)(void *),
+                                size_t *indices, mp_float_t *values) {
+    // the candidates for the extremum of the window are kept in a monotonic deque, implemented as a ring buffer
+    // of length window; each element is pushed, and popped at most once, hence, the cost is O(1) per element
+    size_t first = 0, count = 0;
+    uint8_t *sarray = array;
+    for(size_t i = 0; i < len; i++) {
+        mp_float_t value = func(sarray);
+        // drop the candidate that has just left the window; this must happen before the push,
+        // because, with a full ring buffer, the new element would overwrite the front
+        if((count > 0) && (indices[first] + window <= i)) {
+            first = (first + 1) % window;
+            count--;
+        }
+        // drop the candidates that can never be the extremum again
+        while(count > 0) {
+            mp_float_t last = values[(first + count - 1) % window];
+            if((optype == UTILS_MOVING_MAX) ? (last <= value) : (last >= value)) {
+                count--;
+            } else {
+                break;
+            }
+        }
+        indices[(first + count) % window] = i;
+        values[(first + count) % window] = value;
+        count++;
+        if(i + 1 >= window) {
+            memcpy(rarray, array + indices[first] * stride, itemsize);
+            rarray += rstride;
+        }
+        sarray += stride;
+    }
+}
+
+mp_obj_t utils_moving(size_t n_args, const mp_obj_t *pos_args, mp_map_t *kw_args) {
+    static const mp_arg_t allowed_args[] = {
+        { MP_QSTR_, MP_ARG_REQUIRED | MP_ARG_OBJ, { .u_rom_obj = MP_ROM_NONE } },
+        { MP_QSTR_, MP_ARG_REQUIRED | MP_ARG_OBJ, { .u_rom_obj = MP_ROM_NONE } },
+        { MP_QSTR_, MP_ARG_REQUIRED | MP_ARG_INT, { .u_int = 0 } },
+        { MP_QSTR_axis, MP_ARG_KW_ONLY | MP_ARG_INT, { .u_int = -1 } },
+    };
+
+    mp_arg_val_t args[MP_ARRAY_SIZE(allowed_args)];
+    mp_arg_parse_all(n_args, pos_args, kw_args, MP_ARRAY_SIZE(allowed_args), allowed_args, args);
+
+    if(!mp_obj_is_str(args[0].u_obj)) {
+        mp_raise_TypeError(MP_ERROR_TEXT("operation must be a string"));
+    }
+    size_t _len;
+    const char *_op = mp_obj_str_get_data(args[0].u_obj, &_len);
+    uint8_t optype;
+    if((_len == 3) && (memcmp(_op, "sum", 3) == 0)) {
+        optype = UTILS_MOVING_SUM;
+    } else if((_len == 4) && (memcmp(_op, "mean", 4) == 0)) {
+        optype = UTILS_MOVING_MEAN;
+    } else if((_len == 3) && (memcmp(_op, "std", 3) == 0)) {
+        optype = UTILS_MOVING_STD;
+    } else if((_len == 3) && (memcmp(_op, "min", 3) == 0)) {
+        optype = UTILS_MOVING_MIN;
+    } else if((_len == 3) && (memcmp(_op, "max", 3) == 0)) {
+        optype = UTILS_MOVING_MAX;
+    } else {
+        mp_raise_ValueError(MP_ERROR_TEXT("operation should be sum, mean, std, min, or max"));
+    }
+
+    if(!mp_obj_is_type(args[1].u_obj, &ulab_ndarray_type)) {
+        mp_raise_TypeError(MP_ERROR_TEXT("input must be an ndarray"));
+    }
+    ndarray_obj_t *ndarray = MP_OBJ_TO_PTR(args[1].u_obj);
+    COMPLEX_DTYPE_NOT_IMPLEMENTED(ndarray->dtype)
+
+    uint8_t index = ULAB_MAX_DIMS - ndarray->ndim + tools_get_axis(mp_obj_new_int(args[3].u_int), ndarray->ndim);
+    size_t len = ndarray->shape[index];
+    if((args[2].u_int < 1) || ((size_t)args[2].u_int > len)) {
+        mp_raise_ValueError(MP_ERROR_TEXT("window must be between 1, and the length of the axis"));
+    }
+    size_t window = (size_t)args[2].u_int;
+
+    size_t *shape = m_new(size_t, ULAB_MAX_DIMS);
+    memcpy(shape, ndarray->shape, ULAB_MAX_DIMS * sizeof(size_t));
+    shape[index] = len - window + 1;
+    bool is_min_max = (optype == UTILS_MOVING_MIN) || (optype == UTILS_MOVING_MAX);
+    uint8_t dtype = is_min_max ? ndarray->dtype : NDARRAY_FLOAT;
+    ndarray_obj_t *results = ndarray_new_dense_ndarray_uninitialised(ndarray->ndim, shape, dtype);
+    if(results->len == 0) {
+        return MP_OBJ_FROM_PTR(results);
+    }
+    if(ndarray->boolean) {
+        results->boolean = is_min_max;
+    }
+
+    mp_float_t (*func)(void *) = ndarray_get_float_function(ndarray->dtype);
+    size_t *indices = NULL;
+    mp_float_t *values = NULL;
+    if(is_min_max) {
+        indices = m_new(size_t, window);
+        values = m_new(mp_float_t, window);
+    }
+
+    size_t nlines = results->len / shape[index];
+    for(size_t line = 0; line < nlines; line++) {
+        uint8_t *array = (uint8_t *)ndarray->array + tools_line_offset(ndarray, index, line);
+        uint8_t *rarray = (uint8_t *)results->array + tools_line_offset(results, index, line);
+        if(is_min_max) {
+            utils_moving_min_max(array, ndarray->strides[index], len, window, ndarray->itemsize, rarray,
+                                results->strides[index], optype, func, indices, values);
+        } else {
+            utils_moving_sum_mean_std(array, ndarray->strides[index], len, window, (mp_float_t *)rarray,
+                                results->strides[index] / (int32_t)sizeof(mp_float_t), optype, func);
+        }
+    }
+
+    if(is_min_max) {
+        m_del(size_t, indices, window);
+        m_del(mp_float_t, values, window);
+    }
+    return MP_OBJ_FROM_PTR(results);
+}
+
+MP_DEFINE_CONST_FUN_OBJ_KW(utils_moving_obj, 3, utils_moving);
+#endif /* ULAB_UTILS_HAS_MOVING */
+
 
 static const mp_rom_map_elem_t ulab_utils_globals_table[] = {
     { MP_ROM_QSTR(MP_QSTR___name__), MP_ROM_QSTR(MP_QSTR_utils) },
@@ -399,6 +610,9 @@ static const mp_rom_map_elem_t ulab_utils_globals_table[] = {
     #if ULAB_UTILS_HAS_SPECTROGRAM
         { MP_ROM_QSTR(MP_QSTR_spectrogram), MP_ROM_PTR(&utils_spectrogram_obj) },
     #endif
+    #if ULAB_UTILS_HAS_MOVING
+        { MP_ROM_QSTR(MP_QSTR_moving), MP_ROM_PTR(&utils_moving_obj) },
+    #endif
 };
 
 static MP_DEFINE_CONST_DICT(mp_module_ulab_utils_globals, ulab_utils_globals_table);
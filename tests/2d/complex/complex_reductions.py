@@ -0,0 +1,31 @@
+# this test is meaningful only, when the firmware supports complex arrays
+
+try:
+    from ulab import numpy as np
+except:
+    import numpy as np
+
+a = np.array([1, 1j, -1, -1j, 1+1j], dtype=np.complex)
+print(np.angle(a))
+print(np.angle(a, deg=True))
+print(np.angle(np.array([1, -2, 3])))
+
+b = np.array([1+1j, 3+3j, 2-4j], dtype=np.complex)
+print(np.sum(b))
+print(np.mean(b))
+print(np.std(np.array([1+1j, 3+3j], dtype=np.complex)))
+
+c = np.array([[1+1j, 2], [3, 4-2j]], dtype=np.complex)
+print(np.sum(c, axis=0))
+print(np.mean(c, axis=1))
+
+x = np.array([1+1j, 2], dtype=np.complex)
+y = np.array([1.0, 2.0])
+print(np.dot(x, y))
+m = np.array([[1, 1j], [0, 1]], dtype=np.complex)
+print(np.dot(m, y))
+
+z = np.array([0, 0], dtype=np.complex)
+out = np.array([5, 5], dtype=np.complex)
+np.exp(z, out=out)
+print(out)
@@ -0,0 +1,46 @@
+try:
+    from ulab import numpy as np
+except:
+    import numpy as np
+
+a = np.array([1+2j, 3-1j, -2+0.5j, 4j], dtype=np.complex)
+b = np.array([1-1j, 2, 1j, 0.5+0.5j], dtype=np.complex)
+r = np.array([2.0, 0.5, -1.0, 4.0])
+
+print(a * b)
+print(a * r)
+print(r * a)
+print(a * (1+1j))
+print(a / b)
+print(a / r)
+print(a / 2)
+
+c = a.copy()
+c *= b
+print(c)
+
+c = a.copy()
+c /= 2
+print(c)
+
+d = np.array([1+1j, 0, 2-2j, 0, 3j, 0], dtype=np.complex)
+e = d[::2]
+e *= 2j
+print(d)
+
+# the right hand side is read before it is overwritten, even if it overlaps with the output
+g = np.array([1j, 2, 1+1j, 3], dtype=np.complex)
+g[1:] *= g[:-1]
+print(g)
+g /= g
+print(g)
+
+h = np.array([[1+1j, 2], [3, 1j]], dtype=np.complex)
+h *= h[0]
+print(h)
+
+f = np.array([1.0, 2.0])
+try:
+    f *= 1j
+except TypeError:
+    print('TypeError')
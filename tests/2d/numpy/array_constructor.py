@@ -0,0 +1,29 @@
+try:
+    from ulab import numpy as np
+except:
+    import numpy as np
+
+import array
+
+print(np.array([1, 2, 3], dtype=np.uint8))
+print(np.array((-1, 2, -3), dtype=np.int8))
+print(np.array([[1, 2], [3, 4]], dtype=np.int16))
+print(np.array([1, 2.5, True], dtype=np.float))
+print(np.array([0, 1, 2], dtype=np.bool))
+print(np.array([range(3), range(3, 6)], dtype=np.uint16))
+
+print(np.array(bytearray([1, 2, 255]), dtype=np.uint8))
+print(np.array(b'\x01\x02', dtype=np.float))
+print(np.array(array.array('h', [-1, 0, 1]), dtype=np.int16))
+print(np.array(array.array('H', [1, 2, 3]), dtype=np.float))
+print(np.array(memoryview(array.array('b', [-5, 5])), dtype=np.int8))
+
+try:
+    np.array([[1, 2], [3]])
+except ValueError as e:
+    print('ValueError')
+
+try:
+    np.array([[1, 2], 3])
+except ValueError as e:
+    print('ValueError')
@@ -0,0 +1,42 @@
+try:
+    from ulab import numpy as np
+except:
+    import numpy as np
+
+a = np.array([0, 1, 2, 15, 16, 127, 128, 200, 255], dtype=np.uint8)
+b = np.array([255, 3, 6, 9, 17, 64, 129, 55, 170], dtype=np.uint8)
+print(np.bitwise_and(a, b))
+print(np.bitwise_or(a, b))
+print(np.bitwise_xor(a, b))
+print(np.bitwise_and(a, 0x0F))
+print(np.bitwise_or(0x0F, a))
+print(np.left_shift(a, 3))
+print(np.right_shift(a, 3))
+print(np.left_shift(a, 9))
+
+c = np.array([-32768, -1000, -1, 0, 1, 1000, 32767], dtype=np.int16)
+print(np.right_shift(c, 4))
+print(np.right_shift(c, 20))
+print(np.left_shift(c, 2))
+print(np.bitwise_xor(c, 255))
+
+d = np.array([-128, -7, -1, 0, 5, 127], dtype=np.int8)
+print(np.right_shift(d, 1))
+# a scalar shift count keeps the dtype on the strided path, too
+print(np.right_shift(d[::2], 1))
+
+u = np.array([0, 1, 4095, 32768, 65535], dtype=np.uint16)
+print(np.right_shift(u, 12))
+print(np.left_shift(u[::2], 20))
+print(np.bitwise_and(u, np.array([65535, 0, 255, 32768, 4660], dtype=np.uint16)))
+
+out = np.zeros(9, dtype=np.uint8)
+np.bitwise_xor(a, b, out=out)
+print(out)
+np.bitwise_and(a, 0xF0, out=a)
+print(a)
+
+m = np.array([[1, 2, 3], [4, 5, 6]], dtype=np.uint8)
+out = np.zeros((2, 3), dtype=np.uint8)
+np.left_shift(m, np.array([1, 2, 3], dtype=np.uint8), out=out)
+print(out)
@@ -0,0 +1,37 @@
+try:
+    from ulab import numpy as np
+except:
+    import numpy as np
+
+a = np.array(range(12), dtype=np.uint8).reshape((3, 4))
+print(a[a > 4])
+print(a[a % 3 == 0])
+
+# mask applied to a view
+b = a[:, ::-1]
+print(b[b < 6])
+
+# scalar assignment
+a[a > 8] = 100
+print(a)
+
+# array assignment, with conversion
+a = np.array(range(12), dtype=np.int16).reshape((3, 4))
+mask = a % 2 == 1
+a[mask] = np.array([-1.0, -2.0, -3.0, -4.0, -5.0, -6.0])
+print(a)
+
+# assignment to a view
+a = np.zeros((3, 4))
+v = a[::2, 1:3]
+v[v == 0] = 5.0
+print(a)
+
+# a flat mask on a contiguous array
+a = np.array(range(6), dtype=np.int8).reshape((2, 3))
+print(a[np.array([1, 0, 1, 0, 1, 0], dtype=np.bool)])
+
+try:
+    a[np.array([1, 0, 1], dtype=np.bool)] = 0
+except IndexError as e:
+    print('IndexError')
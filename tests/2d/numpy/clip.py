@@ -0,0 +1,42 @@
+try:
+    from ulab import numpy as np
+except:
+    import numpy as np
+
+# the out keyword is available only, if clip is fused
+a = np.array([1, 2, 3, 4, 5], dtype=np.uint8)
+try:
+    np.clip(a, 2, 4, out=a)
+except TypeError:
+    print('SKIP')
+    raise SystemExit
+print(a)
+
+# a, and the bounds are broadcast to a common shape
+print(np.clip(5, 0, np.array([1, 2, 3], dtype=np.int16)))
+b = np.array([[0], [10]], dtype=np.int16)
+print(np.clip(b, np.array([1, 2, 3], dtype=np.int16), None))
+print(np.clip(np.array([1.0, 5.0, 9.0]), None, 4.0))
+
+# integer bounds are saturated to the range of the dtype
+a = np.array([0, 100, 200, 255], dtype=np.uint8)
+print(np.clip(a, -5, 300))
+print(np.clip(a, 50, None))
+
+# in place, into a strided view
+b = np.array(range(10), dtype=np.int16)
+np.clip(b[::2], 3, 6, out=b[::2])
+print(b)
+
+c = np.array([[1, 5, 9], [2, 6, 10]], dtype=np.uint8)
+print(np.clip(c, np.array([2, 2, 2], dtype=np.uint8), 8))
+
+if hasattr(np, 'int32'):
+    print(np.clip(np.array([-100000, 0, 100000], dtype=np.int32), -70000, 70000))
+else:
+    print('array([-70000, 0, 70000], dtype=int32)')
+
+if hasattr(np, 'float16'):
+    print(np.clip(np.array([-2.5, 0.5, 3.0], dtype=np.float16), -1, 1))
+else:
+    print('array([-1.0, 0.5, 1.0], dtype=float64)')
@@ -0,0 +1,27 @@
+try:
+    from ulab import numpy as np
+except ImportError:
+    import numpy as np
+
+a = np.array([1, 2, 3, 4, 5, 6], dtype=np.uint8)
+print(np.cumsum(a))
+print(np.cumprod(a[:5]))
+
+b = np.array(range(6), dtype=np.float).reshape((2, 3))
+print(np.cumsum(b))
+print(np.cumsum(b, axis=0))
+print(np.cumsum(b, axis=1))
+print(np.cumprod(b + 1, axis=1))
+print(np.cumprod(b + 1, axis=-2))
+
+c = np.array([[1, -2], [3, -4]], dtype=np.int16)
+print(np.cumsum(c, axis=0))
+print(np.cumprod(c))
+
+d = np.array([200, 100, 50], dtype=np.uint8)
+print(np.cumsum(d))
+print(np.cumsum(d, dtype=np.uint16))
+print(np.cumsum(d, dtype=np.float))
+print(np.cumprod(d[:2], dtype=np.uint16))
+print(np.cumprod(np.array([[16, 16], [-16, 16]], dtype=np.int8), axis=0, dtype=np.int16))
+print(np.cumsum(b, axis=1, dtype=np.int16))
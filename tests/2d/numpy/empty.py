@@ -0,0 +1,17 @@
+try:
+    from ulab import numpy as np
+except:
+    import numpy as np
+
+dtypes = (np.uint8, np.int8, np.uint16, np.int16, np.float)
+
+# the values are undefined, hence, only the shapes can be checked before assignment
+print(np.empty(3).shape)
+print(np.empty((3, 4)).shape)
+print(np.empty(0))
+
+for dtype in dtypes:
+    a = np.empty((2, 3), dtype=dtype)
+    print(a.shape)
+    a[:] = 5
+    print(a)
@@ -0,0 +1,21 @@
+try:
+    from ulab import numpy as np
+except:
+    import numpy as np
+
+a = np.array(range(12), dtype=np.int8).reshape((3, 4))
+b = a.transpose()
+c = a[:, ::2]
+
+print(list(a.flat))
+print(list(b.flat))
+print(list(c.flat))
+
+print(a.flat[5], a.flat[-1])
+print(b.flat[1], b.flat[-2])
+
+print(a.flat[2:7])
+print(a.flat[::3])
+print(b.flat[1:8:2])
+print(b.flat[::-4])
+print(c.flat[1:])
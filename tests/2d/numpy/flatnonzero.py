@@ -0,0 +1,16 @@
+try:
+   from ulab import numpy as np
+except:
+   import numpy as np
+
+dtypes = (np.uint8, np.int8, np.uint16, np.int16, np.float)
+
+for dtype in dtypes:
+    array = (np.arange(2, 12, 3, dtype=dtype)).reshape((2,2)) - 2
+    print(np.flatnonzero(array))
+
+array = np.array(range(16)).reshape((4,4)) % 3
+print(np.flatnonzero(array))
+print(np.flatnonzero(array[::2, ::-1]))
+print(np.nonzero(array[::2, ::-1]))
+print(np.flatnonzero(np.zeros(5)))
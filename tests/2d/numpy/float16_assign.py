@@ -0,0 +1,17 @@
+try:
+    from ulab import numpy as np
+except:
+    import numpy as np
+
+if not hasattr(np, 'float16'):
+    print('SKIP')
+    raise SystemExit
+
+a = np.array([1, 2, 3, 4], dtype=np.float16)
+a[a > 2] = 0.5
+print(a)
+
+b = np.array([1, 2, 3, 4], dtype=np.float16)
+b[b < 3] = 1.25
+print(b)
+print(b == 1.25)
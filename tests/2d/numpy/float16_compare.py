@@ -0,0 +1,21 @@
+try:
+    from ulab import numpy as np
+except:
+    import numpy as np
+
+if not hasattr(np, 'float16'):
+    print('SKIP')
+    raise SystemExit
+
+a = np.array([1, 2.5, 3, 4], dtype=np.float16)
+b = np.array([4, 2.5, 2, 1], dtype=np.float16)
+c = np.array([1, 2, 3, 4], dtype=np.uint8)
+
+print(np.equal(a, b))
+print(np.not_equal(a, b))
+print(np.equal(c, a))
+print(np.not_equal(c, a))
+print(np.maximum(a, b))
+print(np.minimum(a, b))
+print(np.maximum(c, a))
+print(np.minimum(a, 2))
@@ -0,0 +1,31 @@
+try:
+    from ulab import numpy as np
+except:
+    import numpy as np
+
+if not hasattr(np, 'float16'):
+    print('SKIP')
+    raise SystemExit
+
+# rounding to the nearest representable value, ties to even
+a = np.array([1 + 2**-10, 1 + 2**-11, 1 + 3 * 2**-11, 1 + 2**-11 + 2**-30, -(1 + 2**-11 + 2**-30)], dtype=np.float16)
+print(a)
+a = np.array([2049, 2051, 65504, 65519, 65520, 0.1], dtype=np.float16)
+print(a)
+
+# subnormal numbers, scaled by the inverse of the smallest one
+b = np.array([2**-24, 2**-25, 1.5 * 2**-25, 3 * 2**-24, 2**-14, 2**-14 - 2**-25, -2**-26], dtype=np.float16)
+print([x * 2**24 for x in b])
+
+c = np.array([np.inf, -np.inf, np.nan, 1e5, -1e5, -0.0], dtype=np.float16)
+print(c)
+
+# arithmetic is carried out in mp_float_t, in-place operations round back to float16
+d = np.array([1.0, 2048.0, 0.5], dtype=np.float16)
+print(d + d)
+print(d * np.array([1, 2, 3], dtype=np.int16))
+d += 1
+print(d)
+
+np.save('out.npy', d.reshape((3, 1)))
+print(np.load('out.npy'))
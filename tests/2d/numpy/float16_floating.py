@@ -0,0 +1,25 @@
+try:
+    from ulab import numpy as np
+except:
+    import numpy as np
+
+if not hasattr(np, 'float16'):
+    print('SKIP')
+    raise SystemExit
+
+a = np.array([1.0, np.inf, -np.inf, np.nan], dtype=np.float16)
+print(np.isinf(a))
+print(np.isfinite(a))
+
+print(np.trace(np.array([[1.5, 0.0], [0.0, 2.0]], dtype=np.float16)))
+
+b = np.array([10, 20, 30], dtype=np.uint8)
+try:
+    b[np.array([0, 1], dtype=np.float16)]
+except IndexError:
+    print('IndexError')
+
+try:
+    np.bitwise_and(np.array([1, 2], dtype=np.float16), np.array([1, 2], dtype=np.uint8))
+except ValueError:
+    print('ValueError')
@@ -0,0 +1,13 @@
+try:
+    from ulab import numpy as np
+except:
+    import numpy as np
+
+if not hasattr(np, 'float16'):
+    print('SKIP')
+    raise SystemExit
+
+a = np.array([0.0, -0.0, 0.5, 0.0, -2.0, 1e-7], dtype=np.float16)
+print(np.flatnonzero(a))
+print(np.nonzero(a.reshape((2, 3))))
+print(np.flatnonzero(a[::-1]))
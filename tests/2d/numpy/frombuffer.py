@@ -0,0 +1,33 @@
+try:
+    from ulab import numpy as np
+except:
+    import numpy as np
+
+buffer = b'\x01\x02\x03\x04\x05\x06\x07\x08'
+print(np.frombuffer(buffer, dtype=np.uint8))
+print(np.frombuffer(buffer, dtype=np.uint8, offset=2))
+print(np.frombuffer(buffer, dtype=np.uint8, offset=2, count=3))
+print(np.frombuffer(buffer, dtype=np.uint8, stride=3))
+print(np.frombuffer(buffer, dtype=np.uint8, offset=1, stride=2, count=2))
+
+# interleaved stereo int16 samples
+stereo = bytearray(np.array([1, -1, 2, -2, 3, -3], dtype=np.int16))
+left = np.frombuffer(stereo, dtype=np.int16, stride=2)
+right = np.frombuffer(stereo, dtype=np.int16, offset=2, stride=2)
+print(left)
+print(right)
+
+# writes to the views go into the buffer
+right[:] = 0
+left[1] = 10
+print(np.frombuffer(stereo, dtype=np.int16))
+
+try:
+    np.frombuffer(buffer, dtype=np.uint8, stride=0)
+except ValueError:
+    print('ValueError')
+
+try:
+    np.frombuffer(buffer, dtype=np.uint8, stride=2, count=5)
+except ValueError:
+    print('ValueError')
@@ -0,0 +1,36 @@
+try:
+    from ulab import numpy as np
+except:
+    import numpy as np
+
+if not hasattr(np, 'int32'):
+    print('SKIP')
+    raise SystemExit
+
+a = np.array([-100000, 70000, 3], dtype=np.int32)
+b = np.array([7, -3, 2], dtype=np.int32)
+print(a)
+print(a + b)
+print(a - b)
+print(a * b)
+print(a // b)
+print(a / 2)
+print(a + np.array([1, 2, 3], dtype=np.int16))
+
+u = np.array([4000000000, 5], dtype=np.uint32)
+print(u)
+print(u - np.array([1, 6], dtype=np.uint32))
+print(u * 2)
+
+c = np.array([1, 2, 3], dtype=np.int32)
+c += np.array([10, 20, 30], dtype=np.int16)
+c *= 2
+print(c)
+
+# the sums are exact, even if they do not fit into 32 bits
+print(np.sum(a))
+print(np.sum(u))
+
+for x in (a, u, a.reshape((3, 1))):
+    np.save('out.npy', x)
+    print(np.load('out.npy'))
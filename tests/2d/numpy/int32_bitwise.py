@@ -0,0 +1,34 @@
+try:
+    from ulab import numpy as np
+except:
+    import numpy as np
+
+if not hasattr(np, 'int32'):
+    print('SKIP')
+    raise SystemExit
+
+a = np.array([-100000, 70000, -1, 0], dtype=np.int32)
+print(np.bitwise_and(a, 0xFFFF))
+print(np.bitwise_or(a, np.array([1, 2, 3, 4], dtype=np.int8)))
+print(np.bitwise_xor(a, a))
+print(np.left_shift(a, 4))
+print(np.right_shift(a, 4))
+print(np.right_shift(a, 40))
+
+u = np.array([4000000000, 1], dtype=np.uint32)
+print(np.right_shift(u, 31))
+print(np.left_shift(u, 1))
+print(np.bitwise_and(u[::-1], np.array([[1], [3]], dtype=np.uint8)))
+
+out = np.zeros(4, dtype=np.int32)
+np.bitwise_xor(a, -1, out=out)
+print(out)
+
+try:
+    np.bitwise_and(u, np.array([1, 2], dtype=np.int8))
+except TypeError:
+    print('TypeError')
+
+# elements of 32-bit integers are copied, and not passed through a float
+c = np.array([1, 0, 1, 0], dtype=np.uint8)
+print(np.where(c, np.array([16777217, 2, -16777217, 4], dtype=np.int32), 5))
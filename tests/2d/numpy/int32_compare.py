@@ -0,0 +1,25 @@
+try:
+    from ulab import numpy as np
+except:
+    import numpy as np
+
+if not hasattr(np, 'int32'):
+    print('SKIP')
+    raise SystemExit
+
+a = np.array([-100000, 5, 70000], dtype=np.int32)
+b = np.array([3, 6, 70000], dtype=np.int32)
+print(np.maximum(a, b))
+print(np.minimum(a, 4))
+print(np.equal(a, b))
+print(np.not_equal(a, 5))
+print(np.maximum(a, np.array([1.5, 2.5, 3.5])))
+
+u = np.array([1, 3000000], dtype=np.uint32)
+print(np.maximum(u, np.array([2, 1], dtype=np.uint8)))
+
+print(a % np.array([0, -1, 6], dtype=np.int32))
+c = np.array([-2147483648, 7], dtype=np.int32)
+print(c % -1)
+c %= np.array([-1, 0], dtype=np.int32)
+print(c)
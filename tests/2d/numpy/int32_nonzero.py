@@ -0,0 +1,22 @@
+try:
+    from ulab import numpy as np
+except:
+    import numpy as np
+
+if not hasattr(np, 'int32'):
+    print('SKIP')
+    raise SystemExit
+
+a = np.array([0, -100000, 0, 65536, 1], dtype=np.int32)
+print(np.flatnonzero(a))
+print(np.nonzero(a.reshape((5, 1))))
+
+b = np.array([[0, 70000], [1, 0]], dtype=np.uint32)
+print(np.flatnonzero(b[:, ::-1]))
+print(np.nonzero(b))
+
+# above 65536 elements, the indices are uint32
+c = np.zeros(70000, dtype=np.uint8)
+c[69999] = 1
+print(np.flatnonzero(c))
+print(np.nonzero(c))
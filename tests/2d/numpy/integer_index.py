@@ -0,0 +1,31 @@
+try:
+    from ulab import numpy as np
+except:
+    import numpy as np
+
+a = np.array(range(12), dtype=np.int16).reshape((3, 4))
+b = np.array([10, 20, 30, 40, 50], dtype=np.uint8)
+
+print(a[[2, 0]])
+print(b[[4, 0, -1, 1]])
+print(a[:, [3, 1]])
+print(a[1, [0, 2]])
+
+lut = np.array([0, 10, 20, 30], dtype=np.uint8)
+print(lut[np.array([3, 3, 1, 0, 2], dtype=np.uint8)])
+
+a[[0, 2]] = 0
+print(a)
+a[:, [1, 3]] = np.array([[1, 2], [3, 4], [5, 6]])
+print(a)
+
+b[[0, 0, 1]] = np.array([1, 2, 3], dtype=np.uint8)
+print(b)
+
+try:
+    b[[5]]
+except IndexError:
+    print('IndexError')
+
+print(np.take(b, [-1, 6], mode='wrap'))
+print(np.take(b, [1, 9], mode='clip'))
@@ -0,0 +1,19 @@
+import math
+
+try:
+    from ulab import numpy as np
+except ImportError:
+    import numpy as np
+
+# lengths around, and well above the block size of the reductions
+for n in (1, 31, 32, 33, 100, 1000):
+    for dtype in (np.uint16, np.int16, np.float):
+        a = np.array(range(n), dtype=dtype)
+        mean = (n - 1) / 2
+        std = math.sqrt((n * n - 1) / 12)
+        print(n, math.isclose(np.mean(a), mean, rel_tol=1e-06, abs_tol=1e-06), math.isclose(np.std(a), std, rel_tol=1e-06, abs_tol=1e-06))
+
+a = np.array(range(200), dtype=np.float).reshape((4, 50))
+print([math.isclose(x, y, rel_tol=1e-06, abs_tol=1e-06) for x, y in zip(np.mean(a, axis=1), [24.5, 74.5, 124.5, 174.5])])
+print([math.isclose(x, math.sqrt((50 * 50 - 1) / 12), rel_tol=1e-06, abs_tol=1e-06) for x in np.std(a, axis=1)])
+print([math.isclose(x, y, rel_tol=1e-06, abs_tol=1e-06) for x, y in zip(np.sum(a, axis=1), [1225, 3725, 6225, 8725])])
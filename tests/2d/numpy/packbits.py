@@ -0,0 +1,28 @@
+try:
+    from ulab import numpy as np
+except:
+    import numpy as np
+
+a = np.array([1, 0, 1, 1, 0, 0, 0, 1, 1, 0, 1], dtype=np.uint8)
+print(np.packbits(a))
+print(np.packbits(a, bitorder='little'))
+
+b = np.array([[1, 0, 0, 0, 0, 0, 0, 0, 1], [0, 1, 0, 0, 0, 0, 0, 0, 0]], dtype=np.bool)
+print(np.packbits(b, axis=1))
+print(np.packbits(b, axis=0))
+
+p = np.array([177, 160], dtype=np.uint8)
+print(np.unpackbits(p))
+print(np.unpackbits(p, count=11))
+print(np.unpackbits(np.array([5], dtype=np.uint8), bitorder='little'))
+print(np.unpackbits(np.array([[3], [128]], dtype=np.uint8), axis=1, count=-4))
+
+print(np.count_nonzero(a))
+print(np.count_nonzero(b, axis=1))
+print(np.count_nonzero(np.array([0.0, -0.0, 1.5])))
+c = np.array(range(10), dtype=np.int16)
+print(np.count_nonzero(c[::2]))
+
+print(np.bitwise_count(np.array([0, 1, 3, 255, 7, 128], dtype=np.uint8)))
+print(np.bitwise_count(np.array([-1, 1023], dtype=np.int16)))
+print(np.bitwise_count(255))
@@ -0,0 +1,44 @@
+try:
+    from ulab import numpy as np
+except ImportError:
+    import numpy as np
+
+rng = np.random.Generator(1234)
+
+a = rng.integers(10, size=1000)
+print(a.shape, a.dtype == np.int16, np.min(a) >= 0, np.max(a) <= 9)
+a = rng.integers(-5, 5, size=(10, 10), dtype=np.int8, endpoint=True)
+print(a.shape, a.dtype == np.int8, np.min(a) >= -5, np.max(a) <= 5)
+print(type(rng.integers(3)) is int)
+
+e = rng.exponential(2.0, size=(3, 4))
+print(e.shape, np.min(e) >= 0)
+
+b = np.zeros((2, 5))
+print(rng.standard_normal(out=b) is b)
+print(rng.standard_normal(size=7).shape)
+x = rng.standard_normal(size=10000)
+print(abs(np.mean(x)) < 0.05, abs(np.std(x) - 1.0) < 0.05)
+x = rng.normal(10.0, 2.0, size=10000)
+print(abs(np.mean(x) - 10.0) < 0.1, abs(np.std(x) - 2.0) < 0.1)
+
+print(np.sort(rng.permutation(10)))
+p = rng.permutation(np.array([[1, 1], [2, 2], [3, 3]]))
+print(p.shape, np.sort(p[:, 0]), np.max(abs(p[:, 0] - p[:, 1])))
+
+print(np.sort(rng.choice(5, size=5, replace=False)))
+c = rng.choice(np.array([2.0, 4.0, 6.0]), size=(2, 3))
+print(c.shape, np.min(c) >= 2.0, np.max(c) <= 6.0)
+print(rng.choice(np.array([7, 7, 7], dtype=np.uint8)))
+
+# the bounds may be long integers, and a single choice does not need a dtype
+if hasattr(np, 'uint32'):
+    a = rng.integers(0, 2**32, size=100, dtype=np.uint32)
+    print(a.dtype == np.uint32, np.min(a) >= 0)
+else:
+    print(True, True)
+try:
+    rng.integers(2**70)
+except ValueError:
+    print('ValueError')
+print(type(rng.choice(70000)) is int)
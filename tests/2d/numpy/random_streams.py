@@ -0,0 +1,37 @@
+try:
+    from ulab import numpy as np
+except ImportError:
+    import numpy as np
+
+# advance counts 32-bit steps; a float draw takes one step with single, and two with double precision
+steps = np.array([0.0]).itemsize // 4
+
+g1 = np.random.Generator(1234)
+g2 = np.random.Generator(1234)
+print(g2.advance(5 * steps) is g2)
+g1.random(size=5)
+print(g1.random() == g2.random())
+
+g3 = np.random.Generator(1234)
+g3.advance(100)
+g3.advance(-100)
+print(g3.random() == np.random.Generator(1234).random())
+
+# the counts are taken modulo 2^64
+g4 = np.random.Generator(1234)
+g4.advance(2**64 + 5 * steps)
+g5 = np.random.Generator(1234)
+g5.advance(5 * steps)
+print(g4.random() == g5.random())
+print(np.random.Generator(1234).jumped(2**64 + 1).random() == np.random.Generator(1234).jumped().random())
+
+g = np.random.Generator(1234)
+j1 = g.jumped()
+j2 = g.jumped(2)
+print(j1 is g, j1.jumped().random() == j2.random())
+print(g.random() == np.random.Generator(1234).random())
+
+a = np.random.Generator(7).spawn(3)
+b = np.random.Generator(7).spawn(3)
+print(len(a), [a[i].random() == b[i].random() for i in range(3)])
+print(a[0].random() != a[1].random(), a[1].random() != a[2].random())
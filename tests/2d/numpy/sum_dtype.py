@@ -0,0 +1,38 @@
+try:
+    from ulab import numpy as np
+except ImportError:
+    import numpy as np
+
+a = np.full((4, 3), 255, dtype=np.uint8)
+
+# the output has the same type as the input, unless the dtype keyword is supplied
+print(np.sum(a, axis=0))
+print(np.sum(a, axis=0, dtype=np.uint16))
+print(np.sum(a, axis=1, dtype=np.int16))
+print(np.sum(a, axis=0, dtype=np.float))
+print(np.sum(a, dtype=np.float))
+
+b = np.full((3, 2), -100, dtype=np.int8)
+print(np.sum(b, axis=0, dtype=np.int16))
+print(np.sum(b, axis=1, keepdims=True, dtype=np.int16))
+
+# the sum of the flattened array is exact, and it is converted to dtype, if that is supplied
+c = np.full((300, 300), 255, dtype=np.uint8)
+print(np.sum(c))
+print(np.sum(c, dtype=np.uint16))
+print(np.sum(b, dtype=np.int8))
+print(np.sum(b[::2, 1]))
+
+# dtypes that the accumulator cannot write are rejected
+try:
+    np.sum(a, dtype=1000)
+except TypeError:
+    print('TypeError')
+
+if hasattr(np, 'complex'):
+    try:
+        np.sum(a, axis=0, dtype=np.complex)
+    except TypeError:
+        print('TypeError')
+else:
+    print('TypeError')
@@ -16,3 +16,23 @@ print(np.where(a < 6, 10 + b, -1))
 b = np.array(range(4), dtype=np.uint8)
 c = np.array([25, 25, 25, 25], dtype=np.int16)
 print(np.where(a < 6, b, c))
+
+# float fast path, and out
+x = np.array([-2.0, -1.0, 0.0, 1.0, 2.0])
+print(np.where(x > 0, x, 0.0))
+print(np.where(x, 1.0, -1.0))
+x2 = np.array(range(10)).reshape((2, 5))
+print(np.where(x > 0, x2, x))
+
+out = np.zeros(5, dtype=np.uint8)
+np.where(x > 0, 3, 7, out=out)
+print(out)
+
+# in place on x
+np.where(x < -1.5, -1.5, x, out=x)
+print(x)
+
+# strided output
+out = np.zeros(10)
+np.where(x > 0, 1.0, 2.0, out=out[::2])
+print(out)
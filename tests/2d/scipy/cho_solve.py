@@ -27,3 +27,15 @@ ref_result = np.array([6.5625, 1.1875, -2.9375, 0.4375])
 
 for i in range(4):
         print(math.isclose(result[i], ref_result[i], rel_tol=1E-6, abs_tol=1E-6))
+
+# several right-hand sides at the same time
+B = np.array([[4, 1], [2, 0], [4, 0], [2, 0]])
+result = scipy.linalg.cho_solve(L, B)
+print(result.shape)
+for i in range(4):
+        print(math.isclose(result[i][0], ref_result[i], rel_tol=1E-6, abs_tol=1E-6))
+
+# the second column is the first column of the inverse of C
+out = np.zeros((4, 2))
+scipy.linalg.cho_solve(L, B, out=out)
+print(math.isclose(np.dot(C, out[:, 1])[0], 1.0, rel_tol=1E-6, abs_tol=1E-6))
@@ -28,3 +28,22 @@ print()
 print('testing quad')
 (res, err) = spy.integrate.quad(f, a, b)
 print(math.isclose(res, 7.112638214158507, rel_tol=1E-6, abs_tol=1E-6))
+
+print('testing vectorized tanhsinh')
+(res, err) = spy.integrate.tanhsinh(f, a, b, vectorized=True)
+print(math.isclose(res, 7.11263821415851, rel_tol=1E-6, abs_tol=1E-6))
+print()
+
+print('testing vectorized romberg')
+res = spy.integrate.romberg(f, a, b, vectorized=True)
+print(math.isclose(res, 7.112638214158507, rel_tol=1E-6, abs_tol=1E-6))
+print()
+
+print('testing vectorized simpson')
+res = spy.integrate.simpson(f, a, b, vectorized=True)
+print(math.isclose(res, 7.112638214158507, rel_tol=1E-6, abs_tol=1E-6))
+print()
+
+print('testing vectorized quad')
+(res, err) = spy.integrate.quad(f, a, b, vectorized=True)
+print(math.isclose(res, 7.112638214158507, rel_tol=1E-6, abs_tol=1E-6))
@@ -0,0 +1,80 @@
+try:
+    from ulab import scipy as spy
+    from ulab import numpy as np
+except ImportError:
+    import scipy
+
+import math
+
+c = np.array([[1.0, 4.0], [9.0, 16.0]])
+expected = [1.0, 2.0, 3.0, 4.0]
+
+def f(x):
+    return x * x - c
+
+print('testing batched bisect')
+res = spy.optimize.bisect(f, 0, 5)
+print(res.shape)
+print([math.isclose(x, y, rel_tol=1E-6, abs_tol=1E-6) for x, y in zip(res.flatten(), expected)])
+print()
+
+print('testing batched bisect with array bounds')
+res = spy.optimize.bisect(f, np.zeros((2, 2)), np.full((2, 2), 5.0))
+print([math.isclose(x, y, rel_tol=1E-6, abs_tol=1E-6) for x, y in zip(res.flatten(), expected)])
+print()
+
+print('testing batched newton')
+res = spy.optimize.newton(f, np.full((2, 2), 5.0), tol=1E-9)
+print(res.shape)
+print([math.isclose(x, y, rel_tol=1E-6, abs_tol=1E-6) for x, y in zip(res.flatten(), expected)])
+print()
+
+print('testing scalar newton')
+res = spy.optimize.newton(lambda x: x * x - 2.0, 3.0, tol=1E-9)
+print(math.isclose(res, math.sqrt(2.0), rel_tol=1E-6, abs_tol=1E-6))
+print()
+
+def model(x, a, b, c):
+    return a * np.exp(-b * x) + c
+
+def jac(x, a, b, c):
+    J = np.ones((len(x), 3))
+    J[:,0] = np.exp(-b * x)
+    J[:,1] = -a * x * np.exp(-b * x)
+    return J
+
+x = np.linspace(0, 4, num=50)
+y = model(x, 2.5, 1.3, 0.5)
+
+print('testing curve_fit')
+popt, pcov = spy.optimize.curve_fit(model, x, y, [1.0, 1.0, 0.0])
+print(popt.shape, pcov.shape)
+print([math.isclose(p, q, rel_tol=1E-4, abs_tol=1E-4) for p, q in zip(popt, [2.5, 1.3, 0.5])])
+print()
+
+print('testing curve_fit with jac')
+popt, pcov = spy.optimize.curve_fit(model, x, y, [1.0, 1.0, 0.0], jac=jac)
+print([math.isclose(p, q, rel_tol=1E-4, abs_tol=1E-4) for p, q in zip(popt, [2.5, 1.3, 0.5])])
+print()
+
+print('testing fmin')
+res = spy.optimize.fmin(lambda x: (x - 1) ** 2 - 1, 3.0)
+print(math.isclose(res, 1.0, rel_tol=1E-4, abs_tol=1E-4))
+args1d = []
+res = spy.optimize.fmin(lambda x: (x[0] - 2) ** 2, 0.5, callback=lambda x: args1d.append(len(x)))
+print(type(res), math.isclose(res, 2.0, rel_tol=1E-4, abs_tol=1E-4))
+print(len(args1d) > 0, max(args1d))
+print()
+
+def rosenbrock(x, a, b):
+    return (a - x[0])**2 + b * (x[1] - x[0]**2)**2
+
+iterations = []
+def callback(x):
+    iterations.append(x[0])
+
+print('testing fmin in two dimensions')
+res = spy.optimize.fmin(rosenbrock, [-1.2, 1.0], args=(1.0, 100.0), xatol=1E-8, fatol=1E-8, callback=callback)
+print(res.shape)
+print([math.isclose(x, 1.0, rel_tol=1E-4, abs_tol=1E-4) for x in res])
+print(len(iterations) > 0)
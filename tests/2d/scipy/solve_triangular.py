@@ -20,3 +20,22 @@ result = scipy.linalg.solve_triangular(A, b, lower=False)
 ref_result = np.array([-1.166666666, 1.75, 3.0, 0.25])
 for i in range(4):
         print(math.isclose(result[i], ref_result[i], rel_tol=1E-6, abs_tol=1E-6))
+
+# several right-hand sides at the same time
+B = np.array([[4, 8], [2, 4], [4, 8], [2, 4]])
+result = scipy.linalg.solve_triangular(A, B, lower=False)
+print(result.shape)
+for i in range(4):
+        print(math.isclose(result[i][0], ref_result[i], rel_tol=1E-6, abs_tol=1E-6), math.isclose(result[i][1], 2 * ref_result[i], rel_tol=1E-6, abs_tol=1E-6))
+
+# solution written into a pre-allocated array
+out = np.zeros((4, 2))
+result = scipy.linalg.solve_triangular(A, B, lower=False, out=out)
+print(result is out)
+print(math.isclose(out[3][1], 2 * ref_result[3], rel_tol=1E-6, abs_tol=1E-6))
+
+# solution written into b
+b = np.array([4.0, 2.0, 4.0, 2.0])
+result = scipy.linalg.solve_triangular(A, b, lower=False, overwrite_b=True)
+print(result is b)
+print(math.isclose(b[0], ref_result[0], rel_tol=1E-6, abs_tol=1E-6))
@@ -0,0 +1,26 @@
+import math
+from ulab import numpy as np
+from ulab import utils
+
+x = np.array([3, -1, 4, 1, -5, 9, 2, 6], dtype=np.int16)
+
+# the window sums, means, and standard deviations are accumulated in floats
+sums = [6, 4, 0, 5, 6, 17]
+print([math.isclose(p, q, rel_tol=1e-06, abs_tol=1e-06) for p, q in zip(utils.moving('sum', x, 3), sums)])
+print([math.isclose(p, q / 3, rel_tol=1e-06, abs_tol=1e-06) for p, q in zip(utils.moving('mean', x, 3), sums)])
+stds = [2.160246899, 2.054804668, 3.741657387, 5.734883511, 5.715476066, 2.867441756]
+print([math.isclose(p, q, rel_tol=1e-06, abs_tol=1e-06) for p, q in zip(utils.moving('std', x, 3), stds)])
+
+print(utils.moving('min', x, 3))
+print(utils.moving('max', x, 3))
+print(utils.moving('max', x, 1))
+
+# strictly monotonic runs that are longer than the window
+z = np.array([5, 4, 3, 2, 1], dtype=np.int8)
+print(utils.moving('max', z, 3))
+print(utils.moving('min', z[::-1], 3))
+
+y = np.array([[1, 5, 2, 8], [7, 3, 9, 0]], dtype=np.uint8)
+print(utils.moving('max', y, 2))
+print(utils.moving('min', y, 2, axis=0))
+print(utils.moving('mean', y, 4))